@@ -0,0 +1,75 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by CMake Version 3.25
+cmake_policy(SET CMP0009 NEW)
+
+# children at CMakeLists.txt:578 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true RELATIVE "/root/repo/ext/SDL2" "/root/repo/ext/SDL2/SDL")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_verify_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# children at CMakeLists.txt:578 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true RELATIVE "/root/repo/ext/SDL2" "/root/repo/ext/SDL2/SDL-*")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_verify_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# children at CMakeLists.txt:578 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true RELATIVE "/root/repo/ext/SDL2" "/root/repo/ext/SDL2/SDL2")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_verify_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# children at CMakeLists.txt:578 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true RELATIVE "/root/repo/ext/SDL2" "/root/repo/ext/SDL2/SDL2-*")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_verify_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# children at CMakeLists.txt:578 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true RELATIVE "/root/repo/ext/SDL2" "/root/repo/ext/SDL2/SDL2_mixer")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_verify_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# children at CMakeLists.txt:578 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true RELATIVE "/root/repo/ext/SDL2" "/root/repo/ext/SDL2/SDL2_mixer-*")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_verify_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# children at CMakeLists.txt:578 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true RELATIVE "/root/repo/ext/SDL2" "/root/repo/ext/SDL2/SDL_mixer")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_verify_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# children at CMakeLists.txt:578 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true RELATIVE "/root/repo/ext/SDL2" "/root/repo/ext/SDL2/SDL_mixer-*")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_verify_build/CMakeFiles/cmake.verify_globs")
+endif()
@@ -0,0 +1,347 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ext/png/png.c" "CMakeFiles/julius.dir/ext/png/png.c.o" "gcc" "CMakeFiles/julius.dir/ext/png/png.c.o.d"
+  "/root/repo/ext/png/pngerror.c" "CMakeFiles/julius.dir/ext/png/pngerror.c.o" "gcc" "CMakeFiles/julius.dir/ext/png/pngerror.c.o.d"
+  "/root/repo/ext/png/pngmem.c" "CMakeFiles/julius.dir/ext/png/pngmem.c.o" "gcc" "CMakeFiles/julius.dir/ext/png/pngmem.c.o.d"
+  "/root/repo/ext/png/pngset.c" "CMakeFiles/julius.dir/ext/png/pngset.c.o" "gcc" "CMakeFiles/julius.dir/ext/png/pngset.c.o.d"
+  "/root/repo/ext/png/pngwio.c" "CMakeFiles/julius.dir/ext/png/pngwio.c.o" "gcc" "CMakeFiles/julius.dir/ext/png/pngwio.c.o.d"
+  "/root/repo/ext/png/pngwrite.c" "CMakeFiles/julius.dir/ext/png/pngwrite.c.o" "gcc" "CMakeFiles/julius.dir/ext/png/pngwrite.c.o.d"
+  "/root/repo/ext/png/pngwutil.c" "CMakeFiles/julius.dir/ext/png/pngwutil.c.o" "gcc" "CMakeFiles/julius.dir/ext/png/pngwutil.c.o.d"
+  "/root/repo/ext/tinyfiledialogs/tinyfiledialogs.c" "CMakeFiles/julius.dir/ext/tinyfiledialogs/tinyfiledialogs.c.o" "gcc" "CMakeFiles/julius.dir/ext/tinyfiledialogs/tinyfiledialogs.c.o.d"
+  "/root/repo/ext/zlib/adler32.c" "CMakeFiles/julius.dir/ext/zlib/adler32.c.o" "gcc" "CMakeFiles/julius.dir/ext/zlib/adler32.c.o.d"
+  "/root/repo/ext/zlib/crc32.c" "CMakeFiles/julius.dir/ext/zlib/crc32.c.o" "gcc" "CMakeFiles/julius.dir/ext/zlib/crc32.c.o.d"
+  "/root/repo/ext/zlib/deflate.c" "CMakeFiles/julius.dir/ext/zlib/deflate.c.o" "gcc" "CMakeFiles/julius.dir/ext/zlib/deflate.c.o.d"
+  "/root/repo/ext/zlib/trees.c" "CMakeFiles/julius.dir/ext/zlib/trees.c.o" "gcc" "CMakeFiles/julius.dir/ext/zlib/trees.c.o.d"
+  "/root/repo/ext/zlib/zutil.c" "CMakeFiles/julius.dir/ext/zlib/zutil.c.o" "gcc" "CMakeFiles/julius.dir/ext/zlib/zutil.c.o.d"
+  "/root/repo/src/building/animation.c" "CMakeFiles/julius.dir/src/building/animation.c.o" "gcc" "CMakeFiles/julius.dir/src/building/animation.c.o.d"
+  "/root/repo/src/building/barracks.c" "CMakeFiles/julius.dir/src/building/barracks.c.o" "gcc" "CMakeFiles/julius.dir/src/building/barracks.c.o.d"
+  "/root/repo/src/building/building.c" "CMakeFiles/julius.dir/src/building/building.c.o" "gcc" "CMakeFiles/julius.dir/src/building/building.c.o.d"
+  "/root/repo/src/building/building_state.c" "CMakeFiles/julius.dir/src/building/building_state.c.o" "gcc" "CMakeFiles/julius.dir/src/building/building_state.c.o.d"
+  "/root/repo/src/building/construction.c" "CMakeFiles/julius.dir/src/building/construction.c.o" "gcc" "CMakeFiles/julius.dir/src/building/construction.c.o.d"
+  "/root/repo/src/building/construction_building.c" "CMakeFiles/julius.dir/src/building/construction_building.c.o" "gcc" "CMakeFiles/julius.dir/src/building/construction_building.c.o.d"
+  "/root/repo/src/building/construction_clear.c" "CMakeFiles/julius.dir/src/building/construction_clear.c.o" "gcc" "CMakeFiles/julius.dir/src/building/construction_clear.c.o.d"
+  "/root/repo/src/building/construction_routed.c" "CMakeFiles/julius.dir/src/building/construction_routed.c.o" "gcc" "CMakeFiles/julius.dir/src/building/construction_routed.c.o.d"
+  "/root/repo/src/building/construction_warning.c" "CMakeFiles/julius.dir/src/building/construction_warning.c.o" "gcc" "CMakeFiles/julius.dir/src/building/construction_warning.c.o.d"
+  "/root/repo/src/building/count.c" "CMakeFiles/julius.dir/src/building/count.c.o" "gcc" "CMakeFiles/julius.dir/src/building/count.c.o.d"
+  "/root/repo/src/building/destruction.c" "CMakeFiles/julius.dir/src/building/destruction.c.o" "gcc" "CMakeFiles/julius.dir/src/building/destruction.c.o.d"
+  "/root/repo/src/building/dock.c" "CMakeFiles/julius.dir/src/building/dock.c.o" "gcc" "CMakeFiles/julius.dir/src/building/dock.c.o.d"
+  "/root/repo/src/building/figure.c" "CMakeFiles/julius.dir/src/building/figure.c.o" "gcc" "CMakeFiles/julius.dir/src/building/figure.c.o.d"
+  "/root/repo/src/building/government.c" "CMakeFiles/julius.dir/src/building/government.c.o" "gcc" "CMakeFiles/julius.dir/src/building/government.c.o.d"
+  "/root/repo/src/building/granary.c" "CMakeFiles/julius.dir/src/building/granary.c.o" "gcc" "CMakeFiles/julius.dir/src/building/granary.c.o.d"
+  "/root/repo/src/building/house.c" "CMakeFiles/julius.dir/src/building/house.c.o" "gcc" "CMakeFiles/julius.dir/src/building/house.c.o.d"
+  "/root/repo/src/building/house_evolution.c" "CMakeFiles/julius.dir/src/building/house_evolution.c.o" "gcc" "CMakeFiles/julius.dir/src/building/house_evolution.c.o.d"
+  "/root/repo/src/building/house_population.c" "CMakeFiles/julius.dir/src/building/house_population.c.o" "gcc" "CMakeFiles/julius.dir/src/building/house_population.c.o.d"
+  "/root/repo/src/building/house_service.c" "CMakeFiles/julius.dir/src/building/house_service.c.o" "gcc" "CMakeFiles/julius.dir/src/building/house_service.c.o.d"
+  "/root/repo/src/building/industry.c" "CMakeFiles/julius.dir/src/building/industry.c.o" "gcc" "CMakeFiles/julius.dir/src/building/industry.c.o.d"
+  "/root/repo/src/building/list.c" "CMakeFiles/julius.dir/src/building/list.c.o" "gcc" "CMakeFiles/julius.dir/src/building/list.c.o.d"
+  "/root/repo/src/building/maintenance.c" "CMakeFiles/julius.dir/src/building/maintenance.c.o" "gcc" "CMakeFiles/julius.dir/src/building/maintenance.c.o.d"
+  "/root/repo/src/building/market.c" "CMakeFiles/julius.dir/src/building/market.c.o" "gcc" "CMakeFiles/julius.dir/src/building/market.c.o.d"
+  "/root/repo/src/building/menu.c" "CMakeFiles/julius.dir/src/building/menu.c.o" "gcc" "CMakeFiles/julius.dir/src/building/menu.c.o.d"
+  "/root/repo/src/building/model.c" "CMakeFiles/julius.dir/src/building/model.c.o" "gcc" "CMakeFiles/julius.dir/src/building/model.c.o.d"
+  "/root/repo/src/building/properties.c" "CMakeFiles/julius.dir/src/building/properties.c.o" "gcc" "CMakeFiles/julius.dir/src/building/properties.c.o.d"
+  "/root/repo/src/building/storage.c" "CMakeFiles/julius.dir/src/building/storage.c.o" "gcc" "CMakeFiles/julius.dir/src/building/storage.c.o.d"
+  "/root/repo/src/building/warehouse.c" "CMakeFiles/julius.dir/src/building/warehouse.c.o" "gcc" "CMakeFiles/julius.dir/src/building/warehouse.c.o.d"
+  "/root/repo/src/city/buildings.c" "CMakeFiles/julius.dir/src/city/buildings.c.o" "gcc" "CMakeFiles/julius.dir/src/city/buildings.c.o.d"
+  "/root/repo/src/city/culture.c" "CMakeFiles/julius.dir/src/city/culture.c.o" "gcc" "CMakeFiles/julius.dir/src/city/culture.c.o.d"
+  "/root/repo/src/city/data.c" "CMakeFiles/julius.dir/src/city/data.c.o" "gcc" "CMakeFiles/julius.dir/src/city/data.c.o.d"
+  "/root/repo/src/city/data_private.c" "CMakeFiles/julius.dir/src/city/data_private.c.o" "gcc" "CMakeFiles/julius.dir/src/city/data_private.c.o.d"
+  "/root/repo/src/city/emperor.c" "CMakeFiles/julius.dir/src/city/emperor.c.o" "gcc" "CMakeFiles/julius.dir/src/city/emperor.c.o.d"
+  "/root/repo/src/city/entertainment.c" "CMakeFiles/julius.dir/src/city/entertainment.c.o" "gcc" "CMakeFiles/julius.dir/src/city/entertainment.c.o.d"
+  "/root/repo/src/city/festival.c" "CMakeFiles/julius.dir/src/city/festival.c.o" "gcc" "CMakeFiles/julius.dir/src/city/festival.c.o.d"
+  "/root/repo/src/city/figures.c" "CMakeFiles/julius.dir/src/city/figures.c.o" "gcc" "CMakeFiles/julius.dir/src/city/figures.c.o.d"
+  "/root/repo/src/city/finance.c" "CMakeFiles/julius.dir/src/city/finance.c.o" "gcc" "CMakeFiles/julius.dir/src/city/finance.c.o.d"
+  "/root/repo/src/city/gods.c" "CMakeFiles/julius.dir/src/city/gods.c.o" "gcc" "CMakeFiles/julius.dir/src/city/gods.c.o.d"
+  "/root/repo/src/city/health.c" "CMakeFiles/julius.dir/src/city/health.c.o" "gcc" "CMakeFiles/julius.dir/src/city/health.c.o.d"
+  "/root/repo/src/city/houses.c" "CMakeFiles/julius.dir/src/city/houses.c.o" "gcc" "CMakeFiles/julius.dir/src/city/houses.c.o.d"
+  "/root/repo/src/city/labor.c" "CMakeFiles/julius.dir/src/city/labor.c.o" "gcc" "CMakeFiles/julius.dir/src/city/labor.c.o.d"
+  "/root/repo/src/city/map.c" "CMakeFiles/julius.dir/src/city/map.c.o" "gcc" "CMakeFiles/julius.dir/src/city/map.c.o.d"
+  "/root/repo/src/city/message.c" "CMakeFiles/julius.dir/src/city/message.c.o" "gcc" "CMakeFiles/julius.dir/src/city/message.c.o.d"
+  "/root/repo/src/city/migration.c" "CMakeFiles/julius.dir/src/city/migration.c.o" "gcc" "CMakeFiles/julius.dir/src/city/migration.c.o.d"
+  "/root/repo/src/city/military.c" "CMakeFiles/julius.dir/src/city/military.c.o" "gcc" "CMakeFiles/julius.dir/src/city/military.c.o.d"
+  "/root/repo/src/city/mission.c" "CMakeFiles/julius.dir/src/city/mission.c.o" "gcc" "CMakeFiles/julius.dir/src/city/mission.c.o.d"
+  "/root/repo/src/city/population.c" "CMakeFiles/julius.dir/src/city/population.c.o" "gcc" "CMakeFiles/julius.dir/src/city/population.c.o.d"
+  "/root/repo/src/city/ratings.c" "CMakeFiles/julius.dir/src/city/ratings.c.o" "gcc" "CMakeFiles/julius.dir/src/city/ratings.c.o.d"
+  "/root/repo/src/city/resource.c" "CMakeFiles/julius.dir/src/city/resource.c.o" "gcc" "CMakeFiles/julius.dir/src/city/resource.c.o.d"
+  "/root/repo/src/city/sentiment.c" "CMakeFiles/julius.dir/src/city/sentiment.c.o" "gcc" "CMakeFiles/julius.dir/src/city/sentiment.c.o.d"
+  "/root/repo/src/city/sound.c" "CMakeFiles/julius.dir/src/city/sound.c.o" "gcc" "CMakeFiles/julius.dir/src/city/sound.c.o.d"
+  "/root/repo/src/city/trade.c" "CMakeFiles/julius.dir/src/city/trade.c.o" "gcc" "CMakeFiles/julius.dir/src/city/trade.c.o.d"
+  "/root/repo/src/city/victory.c" "CMakeFiles/julius.dir/src/city/victory.c.o" "gcc" "CMakeFiles/julius.dir/src/city/victory.c.o.d"
+  "/root/repo/src/city/view.c" "CMakeFiles/julius.dir/src/city/view.c.o" "gcc" "CMakeFiles/julius.dir/src/city/view.c.o.d"
+  "/root/repo/src/city/warning.c" "CMakeFiles/julius.dir/src/city/warning.c.o" "gcc" "CMakeFiles/julius.dir/src/city/warning.c.o.d"
+  "/root/repo/src/core/backtrace.c" "CMakeFiles/julius.dir/src/core/backtrace.c.o" "gcc" "CMakeFiles/julius.dir/src/core/backtrace.c.o.d"
+  "/root/repo/src/core/buffer.c" "CMakeFiles/julius.dir/src/core/buffer.c.o" "gcc" "CMakeFiles/julius.dir/src/core/buffer.c.o.d"
+  "/root/repo/src/core/calc.c" "CMakeFiles/julius.dir/src/core/calc.c.o" "gcc" "CMakeFiles/julius.dir/src/core/calc.c.o.d"
+  "/root/repo/src/core/config.c" "CMakeFiles/julius.dir/src/core/config.c.o" "gcc" "CMakeFiles/julius.dir/src/core/config.c.o.d"
+  "/root/repo/src/core/dir.c" "CMakeFiles/julius.dir/src/core/dir.c.o" "gcc" "CMakeFiles/julius.dir/src/core/dir.c.o.d"
+  "/root/repo/src/core/encoding.c" "CMakeFiles/julius.dir/src/core/encoding.c.o" "gcc" "CMakeFiles/julius.dir/src/core/encoding.c.o.d"
+  "/root/repo/src/core/encoding_multibyte.c" "CMakeFiles/julius.dir/src/core/encoding_multibyte.c.o" "gcc" "CMakeFiles/julius.dir/src/core/encoding_multibyte.c.o.d"
+  "/root/repo/src/core/file.c" "CMakeFiles/julius.dir/src/core/file.c.o" "gcc" "CMakeFiles/julius.dir/src/core/file.c.o.d"
+  "/root/repo/src/core/image.c" "CMakeFiles/julius.dir/src/core/image.c.o" "gcc" "CMakeFiles/julius.dir/src/core/image.c.o.d"
+  "/root/repo/src/core/io.c" "CMakeFiles/julius.dir/src/core/io.c.o" "gcc" "CMakeFiles/julius.dir/src/core/io.c.o.d"
+  "/root/repo/src/core/lang.c" "CMakeFiles/julius.dir/src/core/lang.c.o" "gcc" "CMakeFiles/julius.dir/src/core/lang.c.o.d"
+  "/root/repo/src/core/locale.c" "CMakeFiles/julius.dir/src/core/locale.c.o" "gcc" "CMakeFiles/julius.dir/src/core/locale.c.o.d"
+  "/root/repo/src/core/random.c" "CMakeFiles/julius.dir/src/core/random.c.o" "gcc" "CMakeFiles/julius.dir/src/core/random.c.o.d"
+  "/root/repo/src/core/smacker.c" "CMakeFiles/julius.dir/src/core/smacker.c.o" "gcc" "CMakeFiles/julius.dir/src/core/smacker.c.o.d"
+  "/root/repo/src/core/string.c" "CMakeFiles/julius.dir/src/core/string.c.o" "gcc" "CMakeFiles/julius.dir/src/core/string.c.o.d"
+  "/root/repo/src/core/time.c" "CMakeFiles/julius.dir/src/core/time.c.o" "gcc" "CMakeFiles/julius.dir/src/core/time.c.o.d"
+  "/root/repo/src/core/zip.c" "CMakeFiles/julius.dir/src/core/zip.c.o" "gcc" "CMakeFiles/julius.dir/src/core/zip.c.o.d"
+  "/root/repo/src/editor/editor.c" "CMakeFiles/julius.dir/src/editor/editor.c.o" "gcc" "CMakeFiles/julius.dir/src/editor/editor.c.o.d"
+  "/root/repo/src/editor/tool.c" "CMakeFiles/julius.dir/src/editor/tool.c.o" "gcc" "CMakeFiles/julius.dir/src/editor/tool.c.o.d"
+  "/root/repo/src/editor/tool_restriction.c" "CMakeFiles/julius.dir/src/editor/tool_restriction.c.o" "gcc" "CMakeFiles/julius.dir/src/editor/tool_restriction.c.o.d"
+  "/root/repo/src/empire/city.c" "CMakeFiles/julius.dir/src/empire/city.c.o" "gcc" "CMakeFiles/julius.dir/src/empire/city.c.o.d"
+  "/root/repo/src/empire/empire.c" "CMakeFiles/julius.dir/src/empire/empire.c.o" "gcc" "CMakeFiles/julius.dir/src/empire/empire.c.o.d"
+  "/root/repo/src/empire/object.c" "CMakeFiles/julius.dir/src/empire/object.c.o" "gcc" "CMakeFiles/julius.dir/src/empire/object.c.o.d"
+  "/root/repo/src/empire/trade_prices.c" "CMakeFiles/julius.dir/src/empire/trade_prices.c.o" "gcc" "CMakeFiles/julius.dir/src/empire/trade_prices.c.o.d"
+  "/root/repo/src/empire/trade_route.c" "CMakeFiles/julius.dir/src/empire/trade_route.c.o" "gcc" "CMakeFiles/julius.dir/src/empire/trade_route.c.o.d"
+  "/root/repo/src/figure/action.c" "CMakeFiles/julius.dir/src/figure/action.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/action.c.o.d"
+  "/root/repo/src/figure/combat.c" "CMakeFiles/julius.dir/src/figure/combat.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/combat.c.o.d"
+  "/root/repo/src/figure/enemy_army.c" "CMakeFiles/julius.dir/src/figure/enemy_army.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/enemy_army.c.o.d"
+  "/root/repo/src/figure/figure.c" "CMakeFiles/julius.dir/src/figure/figure.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/figure.c.o.d"
+  "/root/repo/src/figure/formation.c" "CMakeFiles/julius.dir/src/figure/formation.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/formation.c.o.d"
+  "/root/repo/src/figure/formation_enemy.c" "CMakeFiles/julius.dir/src/figure/formation_enemy.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/formation_enemy.c.o.d"
+  "/root/repo/src/figure/formation_herd.c" "CMakeFiles/julius.dir/src/figure/formation_herd.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/formation_herd.c.o.d"
+  "/root/repo/src/figure/formation_layout.c" "CMakeFiles/julius.dir/src/figure/formation_layout.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/formation_layout.c.o.d"
+  "/root/repo/src/figure/formation_legion.c" "CMakeFiles/julius.dir/src/figure/formation_legion.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/formation_legion.c.o.d"
+  "/root/repo/src/figure/image.c" "CMakeFiles/julius.dir/src/figure/image.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/image.c.o.d"
+  "/root/repo/src/figure/intent.c" "CMakeFiles/julius.dir/src/figure/intent.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/intent.c.o.d"
+  "/root/repo/src/figure/movement.c" "CMakeFiles/julius.dir/src/figure/movement.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/movement.c.o.d"
+  "/root/repo/src/figure/name.c" "CMakeFiles/julius.dir/src/figure/name.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/name.c.o.d"
+  "/root/repo/src/figure/phrase.c" "CMakeFiles/julius.dir/src/figure/phrase.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/phrase.c.o.d"
+  "/root/repo/src/figure/properties.c" "CMakeFiles/julius.dir/src/figure/properties.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/properties.c.o.d"
+  "/root/repo/src/figure/route.c" "CMakeFiles/julius.dir/src/figure/route.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/route.c.o.d"
+  "/root/repo/src/figure/service.c" "CMakeFiles/julius.dir/src/figure/service.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/service.c.o.d"
+  "/root/repo/src/figure/sound.c" "CMakeFiles/julius.dir/src/figure/sound.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/sound.c.o.d"
+  "/root/repo/src/figure/trader.c" "CMakeFiles/julius.dir/src/figure/trader.c.o" "gcc" "CMakeFiles/julius.dir/src/figure/trader.c.o.d"
+  "/root/repo/src/figuretype/animal.c" "CMakeFiles/julius.dir/src/figuretype/animal.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/animal.c.o.d"
+  "/root/repo/src/figuretype/cartpusher.c" "CMakeFiles/julius.dir/src/figuretype/cartpusher.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/cartpusher.c.o.d"
+  "/root/repo/src/figuretype/crime.c" "CMakeFiles/julius.dir/src/figuretype/crime.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/crime.c.o.d"
+  "/root/repo/src/figuretype/docker.c" "CMakeFiles/julius.dir/src/figuretype/docker.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/docker.c.o.d"
+  "/root/repo/src/figuretype/editor.c" "CMakeFiles/julius.dir/src/figuretype/editor.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/editor.c.o.d"
+  "/root/repo/src/figuretype/enemy.c" "CMakeFiles/julius.dir/src/figuretype/enemy.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/enemy.c.o.d"
+  "/root/repo/src/figuretype/entertainer.c" "CMakeFiles/julius.dir/src/figuretype/entertainer.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/entertainer.c.o.d"
+  "/root/repo/src/figuretype/maintenance.c" "CMakeFiles/julius.dir/src/figuretype/maintenance.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/maintenance.c.o.d"
+  "/root/repo/src/figuretype/market.c" "CMakeFiles/julius.dir/src/figuretype/market.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/market.c.o.d"
+  "/root/repo/src/figuretype/migrant.c" "CMakeFiles/julius.dir/src/figuretype/migrant.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/migrant.c.o.d"
+  "/root/repo/src/figuretype/missile.c" "CMakeFiles/julius.dir/src/figuretype/missile.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/missile.c.o.d"
+  "/root/repo/src/figuretype/native.c" "CMakeFiles/julius.dir/src/figuretype/native.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/native.c.o.d"
+  "/root/repo/src/figuretype/service.c" "CMakeFiles/julius.dir/src/figuretype/service.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/service.c.o.d"
+  "/root/repo/src/figuretype/soldier.c" "CMakeFiles/julius.dir/src/figuretype/soldier.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/soldier.c.o.d"
+  "/root/repo/src/figuretype/trader.c" "CMakeFiles/julius.dir/src/figuretype/trader.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/trader.c.o.d"
+  "/root/repo/src/figuretype/wall.c" "CMakeFiles/julius.dir/src/figuretype/wall.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/wall.c.o.d"
+  "/root/repo/src/figuretype/water.c" "CMakeFiles/julius.dir/src/figuretype/water.c.o" "gcc" "CMakeFiles/julius.dir/src/figuretype/water.c.o.d"
+  "/root/repo/src/game/animation.c" "CMakeFiles/julius.dir/src/game/animation.c.o" "gcc" "CMakeFiles/julius.dir/src/game/animation.c.o.d"
+  "/root/repo/src/game/difficulty.c" "CMakeFiles/julius.dir/src/game/difficulty.c.o" "gcc" "CMakeFiles/julius.dir/src/game/difficulty.c.o.d"
+  "/root/repo/src/game/file.c" "CMakeFiles/julius.dir/src/game/file.c.o" "gcc" "CMakeFiles/julius.dir/src/game/file.c.o.d"
+  "/root/repo/src/game/file_editor.c" "CMakeFiles/julius.dir/src/game/file_editor.c.o" "gcc" "CMakeFiles/julius.dir/src/game/file_editor.c.o.d"
+  "/root/repo/src/game/file_io.c" "CMakeFiles/julius.dir/src/game/file_io.c.o" "gcc" "CMakeFiles/julius.dir/src/game/file_io.c.o.d"
+  "/root/repo/src/game/game.c" "CMakeFiles/julius.dir/src/game/game.c.o" "gcc" "CMakeFiles/julius.dir/src/game/game.c.o.d"
+  "/root/repo/src/game/mission.c" "CMakeFiles/julius.dir/src/game/mission.c.o" "gcc" "CMakeFiles/julius.dir/src/game/mission.c.o.d"
+  "/root/repo/src/game/orientation.c" "CMakeFiles/julius.dir/src/game/orientation.c.o" "gcc" "CMakeFiles/julius.dir/src/game/orientation.c.o.d"
+  "/root/repo/src/game/replay.c" "CMakeFiles/julius.dir/src/game/replay.c.o" "gcc" "CMakeFiles/julius.dir/src/game/replay.c.o.d"
+  "/root/repo/src/game/resource.c" "CMakeFiles/julius.dir/src/game/resource.c.o" "gcc" "CMakeFiles/julius.dir/src/game/resource.c.o.d"
+  "/root/repo/src/game/rewind.c" "CMakeFiles/julius.dir/src/game/rewind.c.o" "gcc" "CMakeFiles/julius.dir/src/game/rewind.c.o.d"
+  "/root/repo/src/game/settings.c" "CMakeFiles/julius.dir/src/game/settings.c.o" "gcc" "CMakeFiles/julius.dir/src/game/settings.c.o.d"
+  "/root/repo/src/game/state.c" "CMakeFiles/julius.dir/src/game/state.c.o" "gcc" "CMakeFiles/julius.dir/src/game/state.c.o.d"
+  "/root/repo/src/game/tick.c" "CMakeFiles/julius.dir/src/game/tick.c.o" "gcc" "CMakeFiles/julius.dir/src/game/tick.c.o.d"
+  "/root/repo/src/game/time.c" "CMakeFiles/julius.dir/src/game/time.c.o" "gcc" "CMakeFiles/julius.dir/src/game/time.c.o.d"
+  "/root/repo/src/game/tutorial.c" "CMakeFiles/julius.dir/src/game/tutorial.c.o" "gcc" "CMakeFiles/julius.dir/src/game/tutorial.c.o.d"
+  "/root/repo/src/game/undo.c" "CMakeFiles/julius.dir/src/game/undo.c.o" "gcc" "CMakeFiles/julius.dir/src/game/undo.c.o.d"
+  "/root/repo/src/graphics/arrow_button.c" "CMakeFiles/julius.dir/src/graphics/arrow_button.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/arrow_button.c.o.d"
+  "/root/repo/src/graphics/button.c" "CMakeFiles/julius.dir/src/graphics/button.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/button.c.o.d"
+  "/root/repo/src/graphics/city_bands.c" "CMakeFiles/julius.dir/src/graphics/city_bands.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/city_bands.c.o.d"
+  "/root/repo/src/graphics/font.c" "CMakeFiles/julius.dir/src/graphics/font.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/font.c.o.d"
+  "/root/repo/src/graphics/generic_button.c" "CMakeFiles/julius.dir/src/graphics/generic_button.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/generic_button.c.o.d"
+  "/root/repo/src/graphics/graphics.c" "CMakeFiles/julius.dir/src/graphics/graphics.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/graphics.c.o.d"
+  "/root/repo/src/graphics/image.c" "CMakeFiles/julius.dir/src/graphics/image.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/image.c.o.d"
+  "/root/repo/src/graphics/image_button.c" "CMakeFiles/julius.dir/src/graphics/image_button.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/image_button.c.o.d"
+  "/root/repo/src/graphics/lang_text.c" "CMakeFiles/julius.dir/src/graphics/lang_text.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/lang_text.c.o.d"
+  "/root/repo/src/graphics/menu.c" "CMakeFiles/julius.dir/src/graphics/menu.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/menu.c.o.d"
+  "/root/repo/src/graphics/panel.c" "CMakeFiles/julius.dir/src/graphics/panel.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/panel.c.o.d"
+  "/root/repo/src/graphics/rich_text.c" "CMakeFiles/julius.dir/src/graphics/rich_text.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/rich_text.c.o.d"
+  "/root/repo/src/graphics/screen.c" "CMakeFiles/julius.dir/src/graphics/screen.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/screen.c.o.d"
+  "/root/repo/src/graphics/screenshot.c" "CMakeFiles/julius.dir/src/graphics/screenshot.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/screenshot.c.o.d"
+  "/root/repo/src/graphics/text.c" "CMakeFiles/julius.dir/src/graphics/text.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/text.c.o.d"
+  "/root/repo/src/graphics/tile_export.c" "CMakeFiles/julius.dir/src/graphics/tile_export.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/tile_export.c.o.d"
+  "/root/repo/src/graphics/tooltip.c" "CMakeFiles/julius.dir/src/graphics/tooltip.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/tooltip.c.o.d"
+  "/root/repo/src/graphics/video.c" "CMakeFiles/julius.dir/src/graphics/video.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/video.c.o.d"
+  "/root/repo/src/graphics/warning.c" "CMakeFiles/julius.dir/src/graphics/warning.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/warning.c.o.d"
+  "/root/repo/src/graphics/window.c" "CMakeFiles/julius.dir/src/graphics/window.c.o" "gcc" "CMakeFiles/julius.dir/src/graphics/window.c.o.d"
+  "/root/repo/src/input/cursor.c" "CMakeFiles/julius.dir/src/input/cursor.c.o" "gcc" "CMakeFiles/julius.dir/src/input/cursor.c.o.d"
+  "/root/repo/src/input/hotkey.c" "CMakeFiles/julius.dir/src/input/hotkey.c.o" "gcc" "CMakeFiles/julius.dir/src/input/hotkey.c.o.d"
+  "/root/repo/src/input/keyboard.c" "CMakeFiles/julius.dir/src/input/keyboard.c.o" "gcc" "CMakeFiles/julius.dir/src/input/keyboard.c.o.d"
+  "/root/repo/src/input/mouse.c" "CMakeFiles/julius.dir/src/input/mouse.c.o" "gcc" "CMakeFiles/julius.dir/src/input/mouse.c.o.d"
+  "/root/repo/src/input/scroll.c" "CMakeFiles/julius.dir/src/input/scroll.c.o" "gcc" "CMakeFiles/julius.dir/src/input/scroll.c.o.d"
+  "/root/repo/src/input/touch.c" "CMakeFiles/julius.dir/src/input/touch.c.o" "gcc" "CMakeFiles/julius.dir/src/input/touch.c.o.d"
+  "/root/repo/src/map/aqueduct.c" "CMakeFiles/julius.dir/src/map/aqueduct.c.o" "gcc" "CMakeFiles/julius.dir/src/map/aqueduct.c.o.d"
+  "/root/repo/src/map/bookmark.c" "CMakeFiles/julius.dir/src/map/bookmark.c.o" "gcc" "CMakeFiles/julius.dir/src/map/bookmark.c.o.d"
+  "/root/repo/src/map/bridge.c" "CMakeFiles/julius.dir/src/map/bridge.c.o" "gcc" "CMakeFiles/julius.dir/src/map/bridge.c.o.d"
+  "/root/repo/src/map/building.c" "CMakeFiles/julius.dir/src/map/building.c.o" "gcc" "CMakeFiles/julius.dir/src/map/building.c.o.d"
+  "/root/repo/src/map/building_tiles.c" "CMakeFiles/julius.dir/src/map/building_tiles.c.o" "gcc" "CMakeFiles/julius.dir/src/map/building_tiles.c.o.d"
+  "/root/repo/src/map/desirability.c" "CMakeFiles/julius.dir/src/map/desirability.c.o" "gcc" "CMakeFiles/julius.dir/src/map/desirability.c.o.d"
+  "/root/repo/src/map/elevation.c" "CMakeFiles/julius.dir/src/map/elevation.c.o" "gcc" "CMakeFiles/julius.dir/src/map/elevation.c.o.d"
+  "/root/repo/src/map/figure.c" "CMakeFiles/julius.dir/src/map/figure.c.o" "gcc" "CMakeFiles/julius.dir/src/map/figure.c.o.d"
+  "/root/repo/src/map/grid.c" "CMakeFiles/julius.dir/src/map/grid.c.o" "gcc" "CMakeFiles/julius.dir/src/map/grid.c.o.d"
+  "/root/repo/src/map/house_service.c" "CMakeFiles/julius.dir/src/map/house_service.c.o" "gcc" "CMakeFiles/julius.dir/src/map/house_service.c.o.d"
+  "/root/repo/src/map/image.c" "CMakeFiles/julius.dir/src/map/image.c.o" "gcc" "CMakeFiles/julius.dir/src/map/image.c.o.d"
+  "/root/repo/src/map/image_context.c" "CMakeFiles/julius.dir/src/map/image_context.c.o" "gcc" "CMakeFiles/julius.dir/src/map/image_context.c.o.d"
+  "/root/repo/src/map/natives.c" "CMakeFiles/julius.dir/src/map/natives.c.o" "gcc" "CMakeFiles/julius.dir/src/map/natives.c.o.d"
+  "/root/repo/src/map/orientation.c" "CMakeFiles/julius.dir/src/map/orientation.c.o" "gcc" "CMakeFiles/julius.dir/src/map/orientation.c.o.d"
+  "/root/repo/src/map/point.c" "CMakeFiles/julius.dir/src/map/point.c.o" "gcc" "CMakeFiles/julius.dir/src/map/point.c.o.d"
+  "/root/repo/src/map/property.c" "CMakeFiles/julius.dir/src/map/property.c.o" "gcc" "CMakeFiles/julius.dir/src/map/property.c.o.d"
+  "/root/repo/src/map/random.c" "CMakeFiles/julius.dir/src/map/random.c.o" "gcc" "CMakeFiles/julius.dir/src/map/random.c.o.d"
+  "/root/repo/src/map/ring.c" "CMakeFiles/julius.dir/src/map/ring.c.o" "gcc" "CMakeFiles/julius.dir/src/map/ring.c.o.d"
+  "/root/repo/src/map/road_access.c" "CMakeFiles/julius.dir/src/map/road_access.c.o" "gcc" "CMakeFiles/julius.dir/src/map/road_access.c.o.d"
+  "/root/repo/src/map/road_aqueduct.c" "CMakeFiles/julius.dir/src/map/road_aqueduct.c.o" "gcc" "CMakeFiles/julius.dir/src/map/road_aqueduct.c.o.d"
+  "/root/repo/src/map/road_network.c" "CMakeFiles/julius.dir/src/map/road_network.c.o" "gcc" "CMakeFiles/julius.dir/src/map/road_network.c.o.d"
+  "/root/repo/src/map/routing.c" "CMakeFiles/julius.dir/src/map/routing.c.o" "gcc" "CMakeFiles/julius.dir/src/map/routing.c.o.d"
+  "/root/repo/src/map/routing_data.c" "CMakeFiles/julius.dir/src/map/routing_data.c.o" "gcc" "CMakeFiles/julius.dir/src/map/routing_data.c.o.d"
+  "/root/repo/src/map/routing_path.c" "CMakeFiles/julius.dir/src/map/routing_path.c.o" "gcc" "CMakeFiles/julius.dir/src/map/routing_path.c.o.d"
+  "/root/repo/src/map/routing_terrain.c" "CMakeFiles/julius.dir/src/map/routing_terrain.c.o" "gcc" "CMakeFiles/julius.dir/src/map/routing_terrain.c.o.d"
+  "/root/repo/src/map/soldier_strength.c" "CMakeFiles/julius.dir/src/map/soldier_strength.c.o" "gcc" "CMakeFiles/julius.dir/src/map/soldier_strength.c.o.d"
+  "/root/repo/src/map/sprite.c" "CMakeFiles/julius.dir/src/map/sprite.c.o" "gcc" "CMakeFiles/julius.dir/src/map/sprite.c.o.d"
+  "/root/repo/src/map/terrain.c" "CMakeFiles/julius.dir/src/map/terrain.c.o" "gcc" "CMakeFiles/julius.dir/src/map/terrain.c.o.d"
+  "/root/repo/src/map/tiles.c" "CMakeFiles/julius.dir/src/map/tiles.c.o" "gcc" "CMakeFiles/julius.dir/src/map/tiles.c.o.d"
+  "/root/repo/src/map/water.c" "CMakeFiles/julius.dir/src/map/water.c.o" "gcc" "CMakeFiles/julius.dir/src/map/water.c.o.d"
+  "/root/repo/src/map/water_supply.c" "CMakeFiles/julius.dir/src/map/water_supply.c.o" "gcc" "CMakeFiles/julius.dir/src/map/water_supply.c.o.d"
+  "/root/repo/src/platform/arguments.c" "CMakeFiles/julius.dir/src/platform/arguments.c.o" "gcc" "CMakeFiles/julius.dir/src/platform/arguments.c.o.d"
+  "/root/repo/src/platform/cursor.c" "CMakeFiles/julius.dir/src/platform/cursor.c.o" "gcc" "CMakeFiles/julius.dir/src/platform/cursor.c.o.d"
+  "/root/repo/src/platform/julius.c" "CMakeFiles/julius.dir/src/platform/julius.c.o" "gcc" "CMakeFiles/julius.dir/src/platform/julius.c.o.d"
+  "/root/repo/src/platform/keyboard_input.c" "CMakeFiles/julius.dir/src/platform/keyboard_input.c.o" "gcc" "CMakeFiles/julius.dir/src/platform/keyboard_input.c.o.d"
+  "/root/repo/src/platform/log.c" "CMakeFiles/julius.dir/src/platform/log.c.o" "gcc" "CMakeFiles/julius.dir/src/platform/log.c.o.d"
+  "/root/repo/src/platform/prefs.c" "CMakeFiles/julius.dir/src/platform/prefs.c.o" "gcc" "CMakeFiles/julius.dir/src/platform/prefs.c.o.d"
+  "/root/repo/src/platform/screen.c" "CMakeFiles/julius.dir/src/platform/screen.c.o" "gcc" "CMakeFiles/julius.dir/src/platform/screen.c.o.d"
+  "/root/repo/src/platform/sound_device.c" "CMakeFiles/julius.dir/src/platform/sound_device.c.o" "gcc" "CMakeFiles/julius.dir/src/platform/sound_device.c.o.d"
+  "/root/repo/src/platform/touch.c" "CMakeFiles/julius.dir/src/platform/touch.c.o" "gcc" "CMakeFiles/julius.dir/src/platform/touch.c.o.d"
+  "/root/repo/src/scenario/building.c" "CMakeFiles/julius.dir/src/scenario/building.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/building.c.o.d"
+  "/root/repo/src/scenario/criteria.c" "CMakeFiles/julius.dir/src/scenario/criteria.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/criteria.c.o.d"
+  "/root/repo/src/scenario/demand_change.c" "CMakeFiles/julius.dir/src/scenario/demand_change.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/demand_change.c.o.d"
+  "/root/repo/src/scenario/distant_battle.c" "CMakeFiles/julius.dir/src/scenario/distant_battle.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/distant_battle.c.o.d"
+  "/root/repo/src/scenario/earthquake.c" "CMakeFiles/julius.dir/src/scenario/earthquake.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/earthquake.c.o.d"
+  "/root/repo/src/scenario/editor.c" "CMakeFiles/julius.dir/src/scenario/editor.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/editor.c.o.d"
+  "/root/repo/src/scenario/editor_events.c" "CMakeFiles/julius.dir/src/scenario/editor_events.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/editor_events.c.o.d"
+  "/root/repo/src/scenario/editor_map.c" "CMakeFiles/julius.dir/src/scenario/editor_map.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/editor_map.c.o.d"
+  "/root/repo/src/scenario/emperor_change.c" "CMakeFiles/julius.dir/src/scenario/emperor_change.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/emperor_change.c.o.d"
+  "/root/repo/src/scenario/empire.c" "CMakeFiles/julius.dir/src/scenario/empire.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/empire.c.o.d"
+  "/root/repo/src/scenario/gladiator_revolt.c" "CMakeFiles/julius.dir/src/scenario/gladiator_revolt.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/gladiator_revolt.c.o.d"
+  "/root/repo/src/scenario/invasion.c" "CMakeFiles/julius.dir/src/scenario/invasion.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/invasion.c.o.d"
+  "/root/repo/src/scenario/map.c" "CMakeFiles/julius.dir/src/scenario/map.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/map.c.o.d"
+  "/root/repo/src/scenario/price_change.c" "CMakeFiles/julius.dir/src/scenario/price_change.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/price_change.c.o.d"
+  "/root/repo/src/scenario/property.c" "CMakeFiles/julius.dir/src/scenario/property.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/property.c.o.d"
+  "/root/repo/src/scenario/random_event.c" "CMakeFiles/julius.dir/src/scenario/random_event.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/random_event.c.o.d"
+  "/root/repo/src/scenario/request.c" "CMakeFiles/julius.dir/src/scenario/request.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/request.c.o.d"
+  "/root/repo/src/scenario/scenario.c" "CMakeFiles/julius.dir/src/scenario/scenario.c.o" "gcc" "CMakeFiles/julius.dir/src/scenario/scenario.c.o.d"
+  "/root/repo/src/sound/city.c" "CMakeFiles/julius.dir/src/sound/city.c.o" "gcc" "CMakeFiles/julius.dir/src/sound/city.c.o.d"
+  "/root/repo/src/sound/effect.c" "CMakeFiles/julius.dir/src/sound/effect.c.o" "gcc" "CMakeFiles/julius.dir/src/sound/effect.c.o.d"
+  "/root/repo/src/sound/music.c" "CMakeFiles/julius.dir/src/sound/music.c.o" "gcc" "CMakeFiles/julius.dir/src/sound/music.c.o.d"
+  "/root/repo/src/sound/speech.c" "CMakeFiles/julius.dir/src/sound/speech.c.o" "gcc" "CMakeFiles/julius.dir/src/sound/speech.c.o.d"
+  "/root/repo/src/sound/system.c" "CMakeFiles/julius.dir/src/sound/system.c.o" "gcc" "CMakeFiles/julius.dir/src/sound/system.c.o.d"
+  "/root/repo/src/widget/city.c" "CMakeFiles/julius.dir/src/widget/city.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/city.c.o.d"
+  "/root/repo/src/widget/city_bridge.c" "CMakeFiles/julius.dir/src/widget/city_bridge.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/city_bridge.c.o.d"
+  "/root/repo/src/widget/city_building_ghost.c" "CMakeFiles/julius.dir/src/widget/city_building_ghost.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/city_building_ghost.c.o.d"
+  "/root/repo/src/widget/city_figure.c" "CMakeFiles/julius.dir/src/widget/city_figure.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/city_figure.c.o.d"
+  "/root/repo/src/widget/city_overlay_education.c" "CMakeFiles/julius.dir/src/widget/city_overlay_education.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/city_overlay_education.c.o.d"
+  "/root/repo/src/widget/city_overlay_entertainment.c" "CMakeFiles/julius.dir/src/widget/city_overlay_entertainment.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/city_overlay_entertainment.c.o.d"
+  "/root/repo/src/widget/city_overlay_health.c" "CMakeFiles/julius.dir/src/widget/city_overlay_health.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/city_overlay_health.c.o.d"
+  "/root/repo/src/widget/city_overlay_other.c" "CMakeFiles/julius.dir/src/widget/city_overlay_other.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/city_overlay_other.c.o.d"
+  "/root/repo/src/widget/city_overlay_risks.c" "CMakeFiles/julius.dir/src/widget/city_overlay_risks.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/city_overlay_risks.c.o.d"
+  "/root/repo/src/widget/city_with_overlay.c" "CMakeFiles/julius.dir/src/widget/city_with_overlay.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/city_with_overlay.c.o.d"
+  "/root/repo/src/widget/city_without_overlay.c" "CMakeFiles/julius.dir/src/widget/city_without_overlay.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/city_without_overlay.c.o.d"
+  "/root/repo/src/widget/map_editor.c" "CMakeFiles/julius.dir/src/widget/map_editor.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/map_editor.c.o.d"
+  "/root/repo/src/widget/map_editor_tool.c" "CMakeFiles/julius.dir/src/widget/map_editor_tool.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/map_editor_tool.c.o.d"
+  "/root/repo/src/widget/minimap.c" "CMakeFiles/julius.dir/src/widget/minimap.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/minimap.c.o.d"
+  "/root/repo/src/widget/sidebar.c" "CMakeFiles/julius.dir/src/widget/sidebar.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/sidebar.c.o.d"
+  "/root/repo/src/widget/sidebar_editor.c" "CMakeFiles/julius.dir/src/widget/sidebar_editor.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/sidebar_editor.c.o.d"
+  "/root/repo/src/widget/top_menu.c" "CMakeFiles/julius.dir/src/widget/top_menu.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/top_menu.c.o.d"
+  "/root/repo/src/widget/top_menu_editor.c" "CMakeFiles/julius.dir/src/widget/top_menu_editor.c.o" "gcc" "CMakeFiles/julius.dir/src/widget/top_menu_editor.c.o.d"
+  "/root/repo/src/window/advisor/chief.c" "CMakeFiles/julius.dir/src/window/advisor/chief.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/chief.c.o.d"
+  "/root/repo/src/window/advisor/education.c" "CMakeFiles/julius.dir/src/window/advisor/education.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/education.c.o.d"
+  "/root/repo/src/window/advisor/entertainment.c" "CMakeFiles/julius.dir/src/window/advisor/entertainment.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/entertainment.c.o.d"
+  "/root/repo/src/window/advisor/financial.c" "CMakeFiles/julius.dir/src/window/advisor/financial.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/financial.c.o.d"
+  "/root/repo/src/window/advisor/health.c" "CMakeFiles/julius.dir/src/window/advisor/health.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/health.c.o.d"
+  "/root/repo/src/window/advisor/imperial.c" "CMakeFiles/julius.dir/src/window/advisor/imperial.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/imperial.c.o.d"
+  "/root/repo/src/window/advisor/labor.c" "CMakeFiles/julius.dir/src/window/advisor/labor.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/labor.c.o.d"
+  "/root/repo/src/window/advisor/military.c" "CMakeFiles/julius.dir/src/window/advisor/military.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/military.c.o.d"
+  "/root/repo/src/window/advisor/population.c" "CMakeFiles/julius.dir/src/window/advisor/population.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/population.c.o.d"
+  "/root/repo/src/window/advisor/ratings.c" "CMakeFiles/julius.dir/src/window/advisor/ratings.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/ratings.c.o.d"
+  "/root/repo/src/window/advisor/religion.c" "CMakeFiles/julius.dir/src/window/advisor/religion.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/religion.c.o.d"
+  "/root/repo/src/window/advisor/trade.c" "CMakeFiles/julius.dir/src/window/advisor/trade.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisor/trade.c.o.d"
+  "/root/repo/src/window/advisors.c" "CMakeFiles/julius.dir/src/window/advisors.c.o" "gcc" "CMakeFiles/julius.dir/src/window/advisors.c.o.d"
+  "/root/repo/src/window/build_menu.c" "CMakeFiles/julius.dir/src/window/build_menu.c.o" "gcc" "CMakeFiles/julius.dir/src/window/build_menu.c.o.d"
+  "/root/repo/src/window/building/common.c" "CMakeFiles/julius.dir/src/window/building/common.c.o" "gcc" "CMakeFiles/julius.dir/src/window/building/common.c.o.d"
+  "/root/repo/src/window/building/culture.c" "CMakeFiles/julius.dir/src/window/building/culture.c.o" "gcc" "CMakeFiles/julius.dir/src/window/building/culture.c.o.d"
+  "/root/repo/src/window/building/distribution.c" "CMakeFiles/julius.dir/src/window/building/distribution.c.o" "gcc" "CMakeFiles/julius.dir/src/window/building/distribution.c.o.d"
+  "/root/repo/src/window/building/figures.c" "CMakeFiles/julius.dir/src/window/building/figures.c.o" "gcc" "CMakeFiles/julius.dir/src/window/building/figures.c.o.d"
+  "/root/repo/src/window/building/government.c" "CMakeFiles/julius.dir/src/window/building/government.c.o" "gcc" "CMakeFiles/julius.dir/src/window/building/government.c.o.d"
+  "/root/repo/src/window/building/house.c" "CMakeFiles/julius.dir/src/window/building/house.c.o" "gcc" "CMakeFiles/julius.dir/src/window/building/house.c.o.d"
+  "/root/repo/src/window/building/industry.c" "CMakeFiles/julius.dir/src/window/building/industry.c.o" "gcc" "CMakeFiles/julius.dir/src/window/building/industry.c.o.d"
+  "/root/repo/src/window/building/military.c" "CMakeFiles/julius.dir/src/window/building/military.c.o" "gcc" "CMakeFiles/julius.dir/src/window/building/military.c.o.d"
+  "/root/repo/src/window/building/terrain.c" "CMakeFiles/julius.dir/src/window/building/terrain.c.o" "gcc" "CMakeFiles/julius.dir/src/window/building/terrain.c.o.d"
+  "/root/repo/src/window/building/utility.c" "CMakeFiles/julius.dir/src/window/building/utility.c.o" "gcc" "CMakeFiles/julius.dir/src/window/building/utility.c.o.d"
+  "/root/repo/src/window/building_info.c" "CMakeFiles/julius.dir/src/window/building_info.c.o" "gcc" "CMakeFiles/julius.dir/src/window/building_info.c.o.d"
+  "/root/repo/src/window/cck_selection.c" "CMakeFiles/julius.dir/src/window/cck_selection.c.o" "gcc" "CMakeFiles/julius.dir/src/window/cck_selection.c.o.d"
+  "/root/repo/src/window/city.c" "CMakeFiles/julius.dir/src/window/city.c.o" "gcc" "CMakeFiles/julius.dir/src/window/city.c.o.d"
+  "/root/repo/src/window/config.c" "CMakeFiles/julius.dir/src/window/config.c.o" "gcc" "CMakeFiles/julius.dir/src/window/config.c.o.d"
+  "/root/repo/src/window/difficulty_options.c" "CMakeFiles/julius.dir/src/window/difficulty_options.c.o" "gcc" "CMakeFiles/julius.dir/src/window/difficulty_options.c.o.d"
+  "/root/repo/src/window/display_options.c" "CMakeFiles/julius.dir/src/window/display_options.c.o" "gcc" "CMakeFiles/julius.dir/src/window/display_options.c.o.d"
+  "/root/repo/src/window/donate_to_city.c" "CMakeFiles/julius.dir/src/window/donate_to_city.c.o" "gcc" "CMakeFiles/julius.dir/src/window/donate_to_city.c.o.d"
+  "/root/repo/src/window/editor/allowed_buildings.c" "CMakeFiles/julius.dir/src/window/editor/allowed_buildings.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/allowed_buildings.c.o.d"
+  "/root/repo/src/window/editor/attributes.c" "CMakeFiles/julius.dir/src/window/editor/attributes.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/attributes.c.o.d"
+  "/root/repo/src/window/editor/build_menu.c" "CMakeFiles/julius.dir/src/window/editor/build_menu.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/build_menu.c.o.d"
+  "/root/repo/src/window/editor/demand_changes.c" "CMakeFiles/julius.dir/src/window/editor/demand_changes.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/demand_changes.c.o.d"
+  "/root/repo/src/window/editor/edit_demand_change.c" "CMakeFiles/julius.dir/src/window/editor/edit_demand_change.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/edit_demand_change.c.o.d"
+  "/root/repo/src/window/editor/edit_invasion.c" "CMakeFiles/julius.dir/src/window/editor/edit_invasion.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/edit_invasion.c.o.d"
+  "/root/repo/src/window/editor/edit_price_change.c" "CMakeFiles/julius.dir/src/window/editor/edit_price_change.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/edit_price_change.c.o.d"
+  "/root/repo/src/window/editor/edit_request.c" "CMakeFiles/julius.dir/src/window/editor/edit_request.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/edit_request.c.o.d"
+  "/root/repo/src/window/editor/empire.c" "CMakeFiles/julius.dir/src/window/editor/empire.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/empire.c.o.d"
+  "/root/repo/src/window/editor/invasions.c" "CMakeFiles/julius.dir/src/window/editor/invasions.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/invasions.c.o.d"
+  "/root/repo/src/window/editor/map.c" "CMakeFiles/julius.dir/src/window/editor/map.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/map.c.o.d"
+  "/root/repo/src/window/editor/price_changes.c" "CMakeFiles/julius.dir/src/window/editor/price_changes.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/price_changes.c.o.d"
+  "/root/repo/src/window/editor/requests.c" "CMakeFiles/julius.dir/src/window/editor/requests.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/requests.c.o.d"
+  "/root/repo/src/window/editor/special_events.c" "CMakeFiles/julius.dir/src/window/editor/special_events.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/special_events.c.o.d"
+  "/root/repo/src/window/editor/start_year.c" "CMakeFiles/julius.dir/src/window/editor/start_year.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/start_year.c.o.d"
+  "/root/repo/src/window/editor/starting_conditions.c" "CMakeFiles/julius.dir/src/window/editor/starting_conditions.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/starting_conditions.c.o.d"
+  "/root/repo/src/window/editor/win_criteria.c" "CMakeFiles/julius.dir/src/window/editor/win_criteria.c.o" "gcc" "CMakeFiles/julius.dir/src/window/editor/win_criteria.c.o.d"
+  "/root/repo/src/window/empire.c" "CMakeFiles/julius.dir/src/window/empire.c.o" "gcc" "CMakeFiles/julius.dir/src/window/empire.c.o.d"
+  "/root/repo/src/window/file_dialog.c" "CMakeFiles/julius.dir/src/window/file_dialog.c.o" "gcc" "CMakeFiles/julius.dir/src/window/file_dialog.c.o.d"
+  "/root/repo/src/window/gift_to_emperor.c" "CMakeFiles/julius.dir/src/window/gift_to_emperor.c.o" "gcc" "CMakeFiles/julius.dir/src/window/gift_to_emperor.c.o.d"
+  "/root/repo/src/window/hold_festival.c" "CMakeFiles/julius.dir/src/window/hold_festival.c.o" "gcc" "CMakeFiles/julius.dir/src/window/hold_festival.c.o.d"
+  "/root/repo/src/window/intermezzo.c" "CMakeFiles/julius.dir/src/window/intermezzo.c.o" "gcc" "CMakeFiles/julius.dir/src/window/intermezzo.c.o.d"
+  "/root/repo/src/window/intro_video.c" "CMakeFiles/julius.dir/src/window/intro_video.c.o" "gcc" "CMakeFiles/julius.dir/src/window/intro_video.c.o.d"
+  "/root/repo/src/window/labor_priority.c" "CMakeFiles/julius.dir/src/window/labor_priority.c.o" "gcc" "CMakeFiles/julius.dir/src/window/labor_priority.c.o.d"
+  "/root/repo/src/window/logo.c" "CMakeFiles/julius.dir/src/window/logo.c.o" "gcc" "CMakeFiles/julius.dir/src/window/logo.c.o.d"
+  "/root/repo/src/window/main_menu.c" "CMakeFiles/julius.dir/src/window/main_menu.c.o" "gcc" "CMakeFiles/julius.dir/src/window/main_menu.c.o.d"
+  "/root/repo/src/window/message_dialog.c" "CMakeFiles/julius.dir/src/window/message_dialog.c.o" "gcc" "CMakeFiles/julius.dir/src/window/message_dialog.c.o.d"
+  "/root/repo/src/window/message_list.c" "CMakeFiles/julius.dir/src/window/message_list.c.o" "gcc" "CMakeFiles/julius.dir/src/window/message_list.c.o.d"
+  "/root/repo/src/window/mission_briefing.c" "CMakeFiles/julius.dir/src/window/mission_briefing.c.o" "gcc" "CMakeFiles/julius.dir/src/window/mission_briefing.c.o.d"
+  "/root/repo/src/window/mission_end.c" "CMakeFiles/julius.dir/src/window/mission_end.c.o" "gcc" "CMakeFiles/julius.dir/src/window/mission_end.c.o.d"
+  "/root/repo/src/window/mission_selection.c" "CMakeFiles/julius.dir/src/window/mission_selection.c.o" "gcc" "CMakeFiles/julius.dir/src/window/mission_selection.c.o.d"
+  "/root/repo/src/window/new_career.c" "CMakeFiles/julius.dir/src/window/new_career.c.o" "gcc" "CMakeFiles/julius.dir/src/window/new_career.c.o.d"
+  "/root/repo/src/window/numeric_input.c" "CMakeFiles/julius.dir/src/window/numeric_input.c.o" "gcc" "CMakeFiles/julius.dir/src/window/numeric_input.c.o.d"
+  "/root/repo/src/window/overlay_menu.c" "CMakeFiles/julius.dir/src/window/overlay_menu.c.o" "gcc" "CMakeFiles/julius.dir/src/window/overlay_menu.c.o.d"
+  "/root/repo/src/window/plain_message_dialog.c" "CMakeFiles/julius.dir/src/window/plain_message_dialog.c.o" "gcc" "CMakeFiles/julius.dir/src/window/plain_message_dialog.c.o.d"
+  "/root/repo/src/window/popup_dialog.c" "CMakeFiles/julius.dir/src/window/popup_dialog.c.o" "gcc" "CMakeFiles/julius.dir/src/window/popup_dialog.c.o.d"
+  "/root/repo/src/window/resource_settings.c" "CMakeFiles/julius.dir/src/window/resource_settings.c.o" "gcc" "CMakeFiles/julius.dir/src/window/resource_settings.c.o.d"
+  "/root/repo/src/window/select_list.c" "CMakeFiles/julius.dir/src/window/select_list.c.o" "gcc" "CMakeFiles/julius.dir/src/window/select_list.c.o.d"
+  "/root/repo/src/window/set_salary.c" "CMakeFiles/julius.dir/src/window/set_salary.c.o" "gcc" "CMakeFiles/julius.dir/src/window/set_salary.c.o.d"
+  "/root/repo/src/window/sound_options.c" "CMakeFiles/julius.dir/src/window/sound_options.c.o" "gcc" "CMakeFiles/julius.dir/src/window/sound_options.c.o.d"
+  "/root/repo/src/window/speed_options.c" "CMakeFiles/julius.dir/src/window/speed_options.c.o" "gcc" "CMakeFiles/julius.dir/src/window/speed_options.c.o.d"
+  "/root/repo/src/window/trade_opened.c" "CMakeFiles/julius.dir/src/window/trade_opened.c.o" "gcc" "CMakeFiles/julius.dir/src/window/trade_opened.c.o.d"
+  "/root/repo/src/window/trade_prices.c" "CMakeFiles/julius.dir/src/window/trade_prices.c.o" "gcc" "CMakeFiles/julius.dir/src/window/trade_prices.c.o.d"
+  "/root/repo/src/window/victory_dialog.c" "CMakeFiles/julius.dir/src/window/victory_dialog.c.o" "gcc" "CMakeFiles/julius.dir/src/window/victory_dialog.c.o.d"
+  "/root/repo/src/window/victory_video.c" "CMakeFiles/julius.dir/src/window/victory_video.c.o" "gcc" "CMakeFiles/julius.dir/src/window/victory_video.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
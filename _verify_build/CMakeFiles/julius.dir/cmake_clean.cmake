@@ -0,0 +1,667 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/julius.dir/ext/png/png.c.o"
+  "CMakeFiles/julius.dir/ext/png/png.c.o.d"
+  "CMakeFiles/julius.dir/ext/png/pngerror.c.o"
+  "CMakeFiles/julius.dir/ext/png/pngerror.c.o.d"
+  "CMakeFiles/julius.dir/ext/png/pngmem.c.o"
+  "CMakeFiles/julius.dir/ext/png/pngmem.c.o.d"
+  "CMakeFiles/julius.dir/ext/png/pngset.c.o"
+  "CMakeFiles/julius.dir/ext/png/pngset.c.o.d"
+  "CMakeFiles/julius.dir/ext/png/pngwio.c.o"
+  "CMakeFiles/julius.dir/ext/png/pngwio.c.o.d"
+  "CMakeFiles/julius.dir/ext/png/pngwrite.c.o"
+  "CMakeFiles/julius.dir/ext/png/pngwrite.c.o.d"
+  "CMakeFiles/julius.dir/ext/png/pngwutil.c.o"
+  "CMakeFiles/julius.dir/ext/png/pngwutil.c.o.d"
+  "CMakeFiles/julius.dir/ext/tinyfiledialogs/tinyfiledialogs.c.o"
+  "CMakeFiles/julius.dir/ext/tinyfiledialogs/tinyfiledialogs.c.o.d"
+  "CMakeFiles/julius.dir/ext/zlib/adler32.c.o"
+  "CMakeFiles/julius.dir/ext/zlib/adler32.c.o.d"
+  "CMakeFiles/julius.dir/ext/zlib/crc32.c.o"
+  "CMakeFiles/julius.dir/ext/zlib/crc32.c.o.d"
+  "CMakeFiles/julius.dir/ext/zlib/deflate.c.o"
+  "CMakeFiles/julius.dir/ext/zlib/deflate.c.o.d"
+  "CMakeFiles/julius.dir/ext/zlib/trees.c.o"
+  "CMakeFiles/julius.dir/ext/zlib/trees.c.o.d"
+  "CMakeFiles/julius.dir/ext/zlib/zutil.c.o"
+  "CMakeFiles/julius.dir/ext/zlib/zutil.c.o.d"
+  "CMakeFiles/julius.dir/src/building/animation.c.o"
+  "CMakeFiles/julius.dir/src/building/animation.c.o.d"
+  "CMakeFiles/julius.dir/src/building/barracks.c.o"
+  "CMakeFiles/julius.dir/src/building/barracks.c.o.d"
+  "CMakeFiles/julius.dir/src/building/building.c.o"
+  "CMakeFiles/julius.dir/src/building/building.c.o.d"
+  "CMakeFiles/julius.dir/src/building/building_state.c.o"
+  "CMakeFiles/julius.dir/src/building/building_state.c.o.d"
+  "CMakeFiles/julius.dir/src/building/construction.c.o"
+  "CMakeFiles/julius.dir/src/building/construction.c.o.d"
+  "CMakeFiles/julius.dir/src/building/construction_building.c.o"
+  "CMakeFiles/julius.dir/src/building/construction_building.c.o.d"
+  "CMakeFiles/julius.dir/src/building/construction_clear.c.o"
+  "CMakeFiles/julius.dir/src/building/construction_clear.c.o.d"
+  "CMakeFiles/julius.dir/src/building/construction_routed.c.o"
+  "CMakeFiles/julius.dir/src/building/construction_routed.c.o.d"
+  "CMakeFiles/julius.dir/src/building/construction_warning.c.o"
+  "CMakeFiles/julius.dir/src/building/construction_warning.c.o.d"
+  "CMakeFiles/julius.dir/src/building/count.c.o"
+  "CMakeFiles/julius.dir/src/building/count.c.o.d"
+  "CMakeFiles/julius.dir/src/building/destruction.c.o"
+  "CMakeFiles/julius.dir/src/building/destruction.c.o.d"
+  "CMakeFiles/julius.dir/src/building/dock.c.o"
+  "CMakeFiles/julius.dir/src/building/dock.c.o.d"
+  "CMakeFiles/julius.dir/src/building/figure.c.o"
+  "CMakeFiles/julius.dir/src/building/figure.c.o.d"
+  "CMakeFiles/julius.dir/src/building/government.c.o"
+  "CMakeFiles/julius.dir/src/building/government.c.o.d"
+  "CMakeFiles/julius.dir/src/building/granary.c.o"
+  "CMakeFiles/julius.dir/src/building/granary.c.o.d"
+  "CMakeFiles/julius.dir/src/building/house.c.o"
+  "CMakeFiles/julius.dir/src/building/house.c.o.d"
+  "CMakeFiles/julius.dir/src/building/house_evolution.c.o"
+  "CMakeFiles/julius.dir/src/building/house_evolution.c.o.d"
+  "CMakeFiles/julius.dir/src/building/house_population.c.o"
+  "CMakeFiles/julius.dir/src/building/house_population.c.o.d"
+  "CMakeFiles/julius.dir/src/building/house_service.c.o"
+  "CMakeFiles/julius.dir/src/building/house_service.c.o.d"
+  "CMakeFiles/julius.dir/src/building/industry.c.o"
+  "CMakeFiles/julius.dir/src/building/industry.c.o.d"
+  "CMakeFiles/julius.dir/src/building/list.c.o"
+  "CMakeFiles/julius.dir/src/building/list.c.o.d"
+  "CMakeFiles/julius.dir/src/building/maintenance.c.o"
+  "CMakeFiles/julius.dir/src/building/maintenance.c.o.d"
+  "CMakeFiles/julius.dir/src/building/market.c.o"
+  "CMakeFiles/julius.dir/src/building/market.c.o.d"
+  "CMakeFiles/julius.dir/src/building/menu.c.o"
+  "CMakeFiles/julius.dir/src/building/menu.c.o.d"
+  "CMakeFiles/julius.dir/src/building/model.c.o"
+  "CMakeFiles/julius.dir/src/building/model.c.o.d"
+  "CMakeFiles/julius.dir/src/building/properties.c.o"
+  "CMakeFiles/julius.dir/src/building/properties.c.o.d"
+  "CMakeFiles/julius.dir/src/building/storage.c.o"
+  "CMakeFiles/julius.dir/src/building/storage.c.o.d"
+  "CMakeFiles/julius.dir/src/building/warehouse.c.o"
+  "CMakeFiles/julius.dir/src/building/warehouse.c.o.d"
+  "CMakeFiles/julius.dir/src/city/buildings.c.o"
+  "CMakeFiles/julius.dir/src/city/buildings.c.o.d"
+  "CMakeFiles/julius.dir/src/city/culture.c.o"
+  "CMakeFiles/julius.dir/src/city/culture.c.o.d"
+  "CMakeFiles/julius.dir/src/city/data.c.o"
+  "CMakeFiles/julius.dir/src/city/data.c.o.d"
+  "CMakeFiles/julius.dir/src/city/data_private.c.o"
+  "CMakeFiles/julius.dir/src/city/data_private.c.o.d"
+  "CMakeFiles/julius.dir/src/city/emperor.c.o"
+  "CMakeFiles/julius.dir/src/city/emperor.c.o.d"
+  "CMakeFiles/julius.dir/src/city/entertainment.c.o"
+  "CMakeFiles/julius.dir/src/city/entertainment.c.o.d"
+  "CMakeFiles/julius.dir/src/city/festival.c.o"
+  "CMakeFiles/julius.dir/src/city/festival.c.o.d"
+  "CMakeFiles/julius.dir/src/city/figures.c.o"
+  "CMakeFiles/julius.dir/src/city/figures.c.o.d"
+  "CMakeFiles/julius.dir/src/city/finance.c.o"
+  "CMakeFiles/julius.dir/src/city/finance.c.o.d"
+  "CMakeFiles/julius.dir/src/city/gods.c.o"
+  "CMakeFiles/julius.dir/src/city/gods.c.o.d"
+  "CMakeFiles/julius.dir/src/city/health.c.o"
+  "CMakeFiles/julius.dir/src/city/health.c.o.d"
+  "CMakeFiles/julius.dir/src/city/houses.c.o"
+  "CMakeFiles/julius.dir/src/city/houses.c.o.d"
+  "CMakeFiles/julius.dir/src/city/labor.c.o"
+  "CMakeFiles/julius.dir/src/city/labor.c.o.d"
+  "CMakeFiles/julius.dir/src/city/map.c.o"
+  "CMakeFiles/julius.dir/src/city/map.c.o.d"
+  "CMakeFiles/julius.dir/src/city/message.c.o"
+  "CMakeFiles/julius.dir/src/city/message.c.o.d"
+  "CMakeFiles/julius.dir/src/city/migration.c.o"
+  "CMakeFiles/julius.dir/src/city/migration.c.o.d"
+  "CMakeFiles/julius.dir/src/city/military.c.o"
+  "CMakeFiles/julius.dir/src/city/military.c.o.d"
+  "CMakeFiles/julius.dir/src/city/mission.c.o"
+  "CMakeFiles/julius.dir/src/city/mission.c.o.d"
+  "CMakeFiles/julius.dir/src/city/population.c.o"
+  "CMakeFiles/julius.dir/src/city/population.c.o.d"
+  "CMakeFiles/julius.dir/src/city/ratings.c.o"
+  "CMakeFiles/julius.dir/src/city/ratings.c.o.d"
+  "CMakeFiles/julius.dir/src/city/resource.c.o"
+  "CMakeFiles/julius.dir/src/city/resource.c.o.d"
+  "CMakeFiles/julius.dir/src/city/sentiment.c.o"
+  "CMakeFiles/julius.dir/src/city/sentiment.c.o.d"
+  "CMakeFiles/julius.dir/src/city/sound.c.o"
+  "CMakeFiles/julius.dir/src/city/sound.c.o.d"
+  "CMakeFiles/julius.dir/src/city/trade.c.o"
+  "CMakeFiles/julius.dir/src/city/trade.c.o.d"
+  "CMakeFiles/julius.dir/src/city/victory.c.o"
+  "CMakeFiles/julius.dir/src/city/victory.c.o.d"
+  "CMakeFiles/julius.dir/src/city/view.c.o"
+  "CMakeFiles/julius.dir/src/city/view.c.o.d"
+  "CMakeFiles/julius.dir/src/city/warning.c.o"
+  "CMakeFiles/julius.dir/src/city/warning.c.o.d"
+  "CMakeFiles/julius.dir/src/core/backtrace.c.o"
+  "CMakeFiles/julius.dir/src/core/backtrace.c.o.d"
+  "CMakeFiles/julius.dir/src/core/buffer.c.o"
+  "CMakeFiles/julius.dir/src/core/buffer.c.o.d"
+  "CMakeFiles/julius.dir/src/core/calc.c.o"
+  "CMakeFiles/julius.dir/src/core/calc.c.o.d"
+  "CMakeFiles/julius.dir/src/core/config.c.o"
+  "CMakeFiles/julius.dir/src/core/config.c.o.d"
+  "CMakeFiles/julius.dir/src/core/dir.c.o"
+  "CMakeFiles/julius.dir/src/core/dir.c.o.d"
+  "CMakeFiles/julius.dir/src/core/encoding.c.o"
+  "CMakeFiles/julius.dir/src/core/encoding.c.o.d"
+  "CMakeFiles/julius.dir/src/core/encoding_multibyte.c.o"
+  "CMakeFiles/julius.dir/src/core/encoding_multibyte.c.o.d"
+  "CMakeFiles/julius.dir/src/core/file.c.o"
+  "CMakeFiles/julius.dir/src/core/file.c.o.d"
+  "CMakeFiles/julius.dir/src/core/image.c.o"
+  "CMakeFiles/julius.dir/src/core/image.c.o.d"
+  "CMakeFiles/julius.dir/src/core/io.c.o"
+  "CMakeFiles/julius.dir/src/core/io.c.o.d"
+  "CMakeFiles/julius.dir/src/core/lang.c.o"
+  "CMakeFiles/julius.dir/src/core/lang.c.o.d"
+  "CMakeFiles/julius.dir/src/core/locale.c.o"
+  "CMakeFiles/julius.dir/src/core/locale.c.o.d"
+  "CMakeFiles/julius.dir/src/core/random.c.o"
+  "CMakeFiles/julius.dir/src/core/random.c.o.d"
+  "CMakeFiles/julius.dir/src/core/smacker.c.o"
+  "CMakeFiles/julius.dir/src/core/smacker.c.o.d"
+  "CMakeFiles/julius.dir/src/core/string.c.o"
+  "CMakeFiles/julius.dir/src/core/string.c.o.d"
+  "CMakeFiles/julius.dir/src/core/time.c.o"
+  "CMakeFiles/julius.dir/src/core/time.c.o.d"
+  "CMakeFiles/julius.dir/src/core/zip.c.o"
+  "CMakeFiles/julius.dir/src/core/zip.c.o.d"
+  "CMakeFiles/julius.dir/src/editor/editor.c.o"
+  "CMakeFiles/julius.dir/src/editor/editor.c.o.d"
+  "CMakeFiles/julius.dir/src/editor/tool.c.o"
+  "CMakeFiles/julius.dir/src/editor/tool.c.o.d"
+  "CMakeFiles/julius.dir/src/editor/tool_restriction.c.o"
+  "CMakeFiles/julius.dir/src/editor/tool_restriction.c.o.d"
+  "CMakeFiles/julius.dir/src/empire/city.c.o"
+  "CMakeFiles/julius.dir/src/empire/city.c.o.d"
+  "CMakeFiles/julius.dir/src/empire/empire.c.o"
+  "CMakeFiles/julius.dir/src/empire/empire.c.o.d"
+  "CMakeFiles/julius.dir/src/empire/object.c.o"
+  "CMakeFiles/julius.dir/src/empire/object.c.o.d"
+  "CMakeFiles/julius.dir/src/empire/trade_prices.c.o"
+  "CMakeFiles/julius.dir/src/empire/trade_prices.c.o.d"
+  "CMakeFiles/julius.dir/src/empire/trade_route.c.o"
+  "CMakeFiles/julius.dir/src/empire/trade_route.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/action.c.o"
+  "CMakeFiles/julius.dir/src/figure/action.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/combat.c.o"
+  "CMakeFiles/julius.dir/src/figure/combat.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/enemy_army.c.o"
+  "CMakeFiles/julius.dir/src/figure/enemy_army.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/figure.c.o"
+  "CMakeFiles/julius.dir/src/figure/figure.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/formation.c.o"
+  "CMakeFiles/julius.dir/src/figure/formation.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/formation_enemy.c.o"
+  "CMakeFiles/julius.dir/src/figure/formation_enemy.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/formation_herd.c.o"
+  "CMakeFiles/julius.dir/src/figure/formation_herd.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/formation_layout.c.o"
+  "CMakeFiles/julius.dir/src/figure/formation_layout.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/formation_legion.c.o"
+  "CMakeFiles/julius.dir/src/figure/formation_legion.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/image.c.o"
+  "CMakeFiles/julius.dir/src/figure/image.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/intent.c.o"
+  "CMakeFiles/julius.dir/src/figure/intent.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/movement.c.o"
+  "CMakeFiles/julius.dir/src/figure/movement.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/name.c.o"
+  "CMakeFiles/julius.dir/src/figure/name.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/phrase.c.o"
+  "CMakeFiles/julius.dir/src/figure/phrase.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/properties.c.o"
+  "CMakeFiles/julius.dir/src/figure/properties.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/route.c.o"
+  "CMakeFiles/julius.dir/src/figure/route.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/service.c.o"
+  "CMakeFiles/julius.dir/src/figure/service.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/sound.c.o"
+  "CMakeFiles/julius.dir/src/figure/sound.c.o.d"
+  "CMakeFiles/julius.dir/src/figure/trader.c.o"
+  "CMakeFiles/julius.dir/src/figure/trader.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/animal.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/animal.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/cartpusher.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/cartpusher.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/crime.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/crime.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/docker.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/docker.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/editor.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/editor.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/enemy.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/enemy.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/entertainer.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/entertainer.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/maintenance.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/maintenance.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/market.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/market.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/migrant.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/migrant.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/missile.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/missile.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/native.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/native.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/service.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/service.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/soldier.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/soldier.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/trader.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/trader.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/wall.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/wall.c.o.d"
+  "CMakeFiles/julius.dir/src/figuretype/water.c.o"
+  "CMakeFiles/julius.dir/src/figuretype/water.c.o.d"
+  "CMakeFiles/julius.dir/src/game/animation.c.o"
+  "CMakeFiles/julius.dir/src/game/animation.c.o.d"
+  "CMakeFiles/julius.dir/src/game/difficulty.c.o"
+  "CMakeFiles/julius.dir/src/game/difficulty.c.o.d"
+  "CMakeFiles/julius.dir/src/game/file.c.o"
+  "CMakeFiles/julius.dir/src/game/file.c.o.d"
+  "CMakeFiles/julius.dir/src/game/file_editor.c.o"
+  "CMakeFiles/julius.dir/src/game/file_editor.c.o.d"
+  "CMakeFiles/julius.dir/src/game/file_io.c.o"
+  "CMakeFiles/julius.dir/src/game/file_io.c.o.d"
+  "CMakeFiles/julius.dir/src/game/game.c.o"
+  "CMakeFiles/julius.dir/src/game/game.c.o.d"
+  "CMakeFiles/julius.dir/src/game/mission.c.o"
+  "CMakeFiles/julius.dir/src/game/mission.c.o.d"
+  "CMakeFiles/julius.dir/src/game/orientation.c.o"
+  "CMakeFiles/julius.dir/src/game/orientation.c.o.d"
+  "CMakeFiles/julius.dir/src/game/replay.c.o"
+  "CMakeFiles/julius.dir/src/game/replay.c.o.d"
+  "CMakeFiles/julius.dir/src/game/resource.c.o"
+  "CMakeFiles/julius.dir/src/game/resource.c.o.d"
+  "CMakeFiles/julius.dir/src/game/rewind.c.o"
+  "CMakeFiles/julius.dir/src/game/rewind.c.o.d"
+  "CMakeFiles/julius.dir/src/game/settings.c.o"
+  "CMakeFiles/julius.dir/src/game/settings.c.o.d"
+  "CMakeFiles/julius.dir/src/game/state.c.o"
+  "CMakeFiles/julius.dir/src/game/state.c.o.d"
+  "CMakeFiles/julius.dir/src/game/tick.c.o"
+  "CMakeFiles/julius.dir/src/game/tick.c.o.d"
+  "CMakeFiles/julius.dir/src/game/time.c.o"
+  "CMakeFiles/julius.dir/src/game/time.c.o.d"
+  "CMakeFiles/julius.dir/src/game/tutorial.c.o"
+  "CMakeFiles/julius.dir/src/game/tutorial.c.o.d"
+  "CMakeFiles/julius.dir/src/game/undo.c.o"
+  "CMakeFiles/julius.dir/src/game/undo.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/arrow_button.c.o"
+  "CMakeFiles/julius.dir/src/graphics/arrow_button.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/button.c.o"
+  "CMakeFiles/julius.dir/src/graphics/button.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/city_bands.c.o"
+  "CMakeFiles/julius.dir/src/graphics/city_bands.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/font.c.o"
+  "CMakeFiles/julius.dir/src/graphics/font.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/generic_button.c.o"
+  "CMakeFiles/julius.dir/src/graphics/generic_button.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/graphics.c.o"
+  "CMakeFiles/julius.dir/src/graphics/graphics.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/image.c.o"
+  "CMakeFiles/julius.dir/src/graphics/image.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/image_button.c.o"
+  "CMakeFiles/julius.dir/src/graphics/image_button.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/lang_text.c.o"
+  "CMakeFiles/julius.dir/src/graphics/lang_text.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/menu.c.o"
+  "CMakeFiles/julius.dir/src/graphics/menu.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/panel.c.o"
+  "CMakeFiles/julius.dir/src/graphics/panel.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/rich_text.c.o"
+  "CMakeFiles/julius.dir/src/graphics/rich_text.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/screen.c.o"
+  "CMakeFiles/julius.dir/src/graphics/screen.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/screenshot.c.o"
+  "CMakeFiles/julius.dir/src/graphics/screenshot.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/text.c.o"
+  "CMakeFiles/julius.dir/src/graphics/text.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/tile_export.c.o"
+  "CMakeFiles/julius.dir/src/graphics/tile_export.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/tooltip.c.o"
+  "CMakeFiles/julius.dir/src/graphics/tooltip.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/video.c.o"
+  "CMakeFiles/julius.dir/src/graphics/video.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/warning.c.o"
+  "CMakeFiles/julius.dir/src/graphics/warning.c.o.d"
+  "CMakeFiles/julius.dir/src/graphics/window.c.o"
+  "CMakeFiles/julius.dir/src/graphics/window.c.o.d"
+  "CMakeFiles/julius.dir/src/input/cursor.c.o"
+  "CMakeFiles/julius.dir/src/input/cursor.c.o.d"
+  "CMakeFiles/julius.dir/src/input/hotkey.c.o"
+  "CMakeFiles/julius.dir/src/input/hotkey.c.o.d"
+  "CMakeFiles/julius.dir/src/input/keyboard.c.o"
+  "CMakeFiles/julius.dir/src/input/keyboard.c.o.d"
+  "CMakeFiles/julius.dir/src/input/mouse.c.o"
+  "CMakeFiles/julius.dir/src/input/mouse.c.o.d"
+  "CMakeFiles/julius.dir/src/input/scroll.c.o"
+  "CMakeFiles/julius.dir/src/input/scroll.c.o.d"
+  "CMakeFiles/julius.dir/src/input/touch.c.o"
+  "CMakeFiles/julius.dir/src/input/touch.c.o.d"
+  "CMakeFiles/julius.dir/src/map/aqueduct.c.o"
+  "CMakeFiles/julius.dir/src/map/aqueduct.c.o.d"
+  "CMakeFiles/julius.dir/src/map/bookmark.c.o"
+  "CMakeFiles/julius.dir/src/map/bookmark.c.o.d"
+  "CMakeFiles/julius.dir/src/map/bridge.c.o"
+  "CMakeFiles/julius.dir/src/map/bridge.c.o.d"
+  "CMakeFiles/julius.dir/src/map/building.c.o"
+  "CMakeFiles/julius.dir/src/map/building.c.o.d"
+  "CMakeFiles/julius.dir/src/map/building_tiles.c.o"
+  "CMakeFiles/julius.dir/src/map/building_tiles.c.o.d"
+  "CMakeFiles/julius.dir/src/map/desirability.c.o"
+  "CMakeFiles/julius.dir/src/map/desirability.c.o.d"
+  "CMakeFiles/julius.dir/src/map/elevation.c.o"
+  "CMakeFiles/julius.dir/src/map/elevation.c.o.d"
+  "CMakeFiles/julius.dir/src/map/figure.c.o"
+  "CMakeFiles/julius.dir/src/map/figure.c.o.d"
+  "CMakeFiles/julius.dir/src/map/grid.c.o"
+  "CMakeFiles/julius.dir/src/map/grid.c.o.d"
+  "CMakeFiles/julius.dir/src/map/house_service.c.o"
+  "CMakeFiles/julius.dir/src/map/house_service.c.o.d"
+  "CMakeFiles/julius.dir/src/map/image.c.o"
+  "CMakeFiles/julius.dir/src/map/image.c.o.d"
+  "CMakeFiles/julius.dir/src/map/image_context.c.o"
+  "CMakeFiles/julius.dir/src/map/image_context.c.o.d"
+  "CMakeFiles/julius.dir/src/map/natives.c.o"
+  "CMakeFiles/julius.dir/src/map/natives.c.o.d"
+  "CMakeFiles/julius.dir/src/map/orientation.c.o"
+  "CMakeFiles/julius.dir/src/map/orientation.c.o.d"
+  "CMakeFiles/julius.dir/src/map/point.c.o"
+  "CMakeFiles/julius.dir/src/map/point.c.o.d"
+  "CMakeFiles/julius.dir/src/map/property.c.o"
+  "CMakeFiles/julius.dir/src/map/property.c.o.d"
+  "CMakeFiles/julius.dir/src/map/random.c.o"
+  "CMakeFiles/julius.dir/src/map/random.c.o.d"
+  "CMakeFiles/julius.dir/src/map/ring.c.o"
+  "CMakeFiles/julius.dir/src/map/ring.c.o.d"
+  "CMakeFiles/julius.dir/src/map/road_access.c.o"
+  "CMakeFiles/julius.dir/src/map/road_access.c.o.d"
+  "CMakeFiles/julius.dir/src/map/road_aqueduct.c.o"
+  "CMakeFiles/julius.dir/src/map/road_aqueduct.c.o.d"
+  "CMakeFiles/julius.dir/src/map/road_network.c.o"
+  "CMakeFiles/julius.dir/src/map/road_network.c.o.d"
+  "CMakeFiles/julius.dir/src/map/routing.c.o"
+  "CMakeFiles/julius.dir/src/map/routing.c.o.d"
+  "CMakeFiles/julius.dir/src/map/routing_data.c.o"
+  "CMakeFiles/julius.dir/src/map/routing_data.c.o.d"
+  "CMakeFiles/julius.dir/src/map/routing_path.c.o"
+  "CMakeFiles/julius.dir/src/map/routing_path.c.o.d"
+  "CMakeFiles/julius.dir/src/map/routing_terrain.c.o"
+  "CMakeFiles/julius.dir/src/map/routing_terrain.c.o.d"
+  "CMakeFiles/julius.dir/src/map/soldier_strength.c.o"
+  "CMakeFiles/julius.dir/src/map/soldier_strength.c.o.d"
+  "CMakeFiles/julius.dir/src/map/sprite.c.o"
+  "CMakeFiles/julius.dir/src/map/sprite.c.o.d"
+  "CMakeFiles/julius.dir/src/map/terrain.c.o"
+  "CMakeFiles/julius.dir/src/map/terrain.c.o.d"
+  "CMakeFiles/julius.dir/src/map/tiles.c.o"
+  "CMakeFiles/julius.dir/src/map/tiles.c.o.d"
+  "CMakeFiles/julius.dir/src/map/water.c.o"
+  "CMakeFiles/julius.dir/src/map/water.c.o.d"
+  "CMakeFiles/julius.dir/src/map/water_supply.c.o"
+  "CMakeFiles/julius.dir/src/map/water_supply.c.o.d"
+  "CMakeFiles/julius.dir/src/platform/arguments.c.o"
+  "CMakeFiles/julius.dir/src/platform/arguments.c.o.d"
+  "CMakeFiles/julius.dir/src/platform/cursor.c.o"
+  "CMakeFiles/julius.dir/src/platform/cursor.c.o.d"
+  "CMakeFiles/julius.dir/src/platform/julius.c.o"
+  "CMakeFiles/julius.dir/src/platform/julius.c.o.d"
+  "CMakeFiles/julius.dir/src/platform/keyboard_input.c.o"
+  "CMakeFiles/julius.dir/src/platform/keyboard_input.c.o.d"
+  "CMakeFiles/julius.dir/src/platform/log.c.o"
+  "CMakeFiles/julius.dir/src/platform/log.c.o.d"
+  "CMakeFiles/julius.dir/src/platform/prefs.c.o"
+  "CMakeFiles/julius.dir/src/platform/prefs.c.o.d"
+  "CMakeFiles/julius.dir/src/platform/screen.c.o"
+  "CMakeFiles/julius.dir/src/platform/screen.c.o.d"
+  "CMakeFiles/julius.dir/src/platform/sound_device.c.o"
+  "CMakeFiles/julius.dir/src/platform/sound_device.c.o.d"
+  "CMakeFiles/julius.dir/src/platform/touch.c.o"
+  "CMakeFiles/julius.dir/src/platform/touch.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/building.c.o"
+  "CMakeFiles/julius.dir/src/scenario/building.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/criteria.c.o"
+  "CMakeFiles/julius.dir/src/scenario/criteria.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/demand_change.c.o"
+  "CMakeFiles/julius.dir/src/scenario/demand_change.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/distant_battle.c.o"
+  "CMakeFiles/julius.dir/src/scenario/distant_battle.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/earthquake.c.o"
+  "CMakeFiles/julius.dir/src/scenario/earthquake.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/editor.c.o"
+  "CMakeFiles/julius.dir/src/scenario/editor.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/editor_events.c.o"
+  "CMakeFiles/julius.dir/src/scenario/editor_events.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/editor_map.c.o"
+  "CMakeFiles/julius.dir/src/scenario/editor_map.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/emperor_change.c.o"
+  "CMakeFiles/julius.dir/src/scenario/emperor_change.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/empire.c.o"
+  "CMakeFiles/julius.dir/src/scenario/empire.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/gladiator_revolt.c.o"
+  "CMakeFiles/julius.dir/src/scenario/gladiator_revolt.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/invasion.c.o"
+  "CMakeFiles/julius.dir/src/scenario/invasion.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/map.c.o"
+  "CMakeFiles/julius.dir/src/scenario/map.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/price_change.c.o"
+  "CMakeFiles/julius.dir/src/scenario/price_change.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/property.c.o"
+  "CMakeFiles/julius.dir/src/scenario/property.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/random_event.c.o"
+  "CMakeFiles/julius.dir/src/scenario/random_event.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/request.c.o"
+  "CMakeFiles/julius.dir/src/scenario/request.c.o.d"
+  "CMakeFiles/julius.dir/src/scenario/scenario.c.o"
+  "CMakeFiles/julius.dir/src/scenario/scenario.c.o.d"
+  "CMakeFiles/julius.dir/src/sound/city.c.o"
+  "CMakeFiles/julius.dir/src/sound/city.c.o.d"
+  "CMakeFiles/julius.dir/src/sound/effect.c.o"
+  "CMakeFiles/julius.dir/src/sound/effect.c.o.d"
+  "CMakeFiles/julius.dir/src/sound/music.c.o"
+  "CMakeFiles/julius.dir/src/sound/music.c.o.d"
+  "CMakeFiles/julius.dir/src/sound/speech.c.o"
+  "CMakeFiles/julius.dir/src/sound/speech.c.o.d"
+  "CMakeFiles/julius.dir/src/sound/system.c.o"
+  "CMakeFiles/julius.dir/src/sound/system.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/city.c.o"
+  "CMakeFiles/julius.dir/src/widget/city.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/city_bridge.c.o"
+  "CMakeFiles/julius.dir/src/widget/city_bridge.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/city_building_ghost.c.o"
+  "CMakeFiles/julius.dir/src/widget/city_building_ghost.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/city_figure.c.o"
+  "CMakeFiles/julius.dir/src/widget/city_figure.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/city_overlay_education.c.o"
+  "CMakeFiles/julius.dir/src/widget/city_overlay_education.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/city_overlay_entertainment.c.o"
+  "CMakeFiles/julius.dir/src/widget/city_overlay_entertainment.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/city_overlay_health.c.o"
+  "CMakeFiles/julius.dir/src/widget/city_overlay_health.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/city_overlay_other.c.o"
+  "CMakeFiles/julius.dir/src/widget/city_overlay_other.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/city_overlay_risks.c.o"
+  "CMakeFiles/julius.dir/src/widget/city_overlay_risks.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/city_with_overlay.c.o"
+  "CMakeFiles/julius.dir/src/widget/city_with_overlay.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/city_without_overlay.c.o"
+  "CMakeFiles/julius.dir/src/widget/city_without_overlay.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/map_editor.c.o"
+  "CMakeFiles/julius.dir/src/widget/map_editor.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/map_editor_tool.c.o"
+  "CMakeFiles/julius.dir/src/widget/map_editor_tool.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/minimap.c.o"
+  "CMakeFiles/julius.dir/src/widget/minimap.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/sidebar.c.o"
+  "CMakeFiles/julius.dir/src/widget/sidebar.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/sidebar_editor.c.o"
+  "CMakeFiles/julius.dir/src/widget/sidebar_editor.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/top_menu.c.o"
+  "CMakeFiles/julius.dir/src/widget/top_menu.c.o.d"
+  "CMakeFiles/julius.dir/src/widget/top_menu_editor.c.o"
+  "CMakeFiles/julius.dir/src/widget/top_menu_editor.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/chief.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/chief.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/education.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/education.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/entertainment.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/entertainment.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/financial.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/financial.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/health.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/health.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/imperial.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/imperial.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/labor.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/labor.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/military.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/military.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/population.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/population.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/ratings.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/ratings.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/religion.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/religion.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisor/trade.c.o"
+  "CMakeFiles/julius.dir/src/window/advisor/trade.c.o.d"
+  "CMakeFiles/julius.dir/src/window/advisors.c.o"
+  "CMakeFiles/julius.dir/src/window/advisors.c.o.d"
+  "CMakeFiles/julius.dir/src/window/build_menu.c.o"
+  "CMakeFiles/julius.dir/src/window/build_menu.c.o.d"
+  "CMakeFiles/julius.dir/src/window/building/common.c.o"
+  "CMakeFiles/julius.dir/src/window/building/common.c.o.d"
+  "CMakeFiles/julius.dir/src/window/building/culture.c.o"
+  "CMakeFiles/julius.dir/src/window/building/culture.c.o.d"
+  "CMakeFiles/julius.dir/src/window/building/distribution.c.o"
+  "CMakeFiles/julius.dir/src/window/building/distribution.c.o.d"
+  "CMakeFiles/julius.dir/src/window/building/figures.c.o"
+  "CMakeFiles/julius.dir/src/window/building/figures.c.o.d"
+  "CMakeFiles/julius.dir/src/window/building/government.c.o"
+  "CMakeFiles/julius.dir/src/window/building/government.c.o.d"
+  "CMakeFiles/julius.dir/src/window/building/house.c.o"
+  "CMakeFiles/julius.dir/src/window/building/house.c.o.d"
+  "CMakeFiles/julius.dir/src/window/building/industry.c.o"
+  "CMakeFiles/julius.dir/src/window/building/industry.c.o.d"
+  "CMakeFiles/julius.dir/src/window/building/military.c.o"
+  "CMakeFiles/julius.dir/src/window/building/military.c.o.d"
+  "CMakeFiles/julius.dir/src/window/building/terrain.c.o"
+  "CMakeFiles/julius.dir/src/window/building/terrain.c.o.d"
+  "CMakeFiles/julius.dir/src/window/building/utility.c.o"
+  "CMakeFiles/julius.dir/src/window/building/utility.c.o.d"
+  "CMakeFiles/julius.dir/src/window/building_info.c.o"
+  "CMakeFiles/julius.dir/src/window/building_info.c.o.d"
+  "CMakeFiles/julius.dir/src/window/cck_selection.c.o"
+  "CMakeFiles/julius.dir/src/window/cck_selection.c.o.d"
+  "CMakeFiles/julius.dir/src/window/city.c.o"
+  "CMakeFiles/julius.dir/src/window/city.c.o.d"
+  "CMakeFiles/julius.dir/src/window/config.c.o"
+  "CMakeFiles/julius.dir/src/window/config.c.o.d"
+  "CMakeFiles/julius.dir/src/window/difficulty_options.c.o"
+  "CMakeFiles/julius.dir/src/window/difficulty_options.c.o.d"
+  "CMakeFiles/julius.dir/src/window/display_options.c.o"
+  "CMakeFiles/julius.dir/src/window/display_options.c.o.d"
+  "CMakeFiles/julius.dir/src/window/donate_to_city.c.o"
+  "CMakeFiles/julius.dir/src/window/donate_to_city.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/allowed_buildings.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/allowed_buildings.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/attributes.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/attributes.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/build_menu.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/build_menu.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/demand_changes.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/demand_changes.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/edit_demand_change.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/edit_demand_change.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/edit_invasion.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/edit_invasion.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/edit_price_change.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/edit_price_change.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/edit_request.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/edit_request.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/empire.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/empire.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/invasions.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/invasions.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/map.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/map.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/price_changes.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/price_changes.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/requests.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/requests.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/special_events.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/special_events.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/start_year.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/start_year.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/starting_conditions.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/starting_conditions.c.o.d"
+  "CMakeFiles/julius.dir/src/window/editor/win_criteria.c.o"
+  "CMakeFiles/julius.dir/src/window/editor/win_criteria.c.o.d"
+  "CMakeFiles/julius.dir/src/window/empire.c.o"
+  "CMakeFiles/julius.dir/src/window/empire.c.o.d"
+  "CMakeFiles/julius.dir/src/window/file_dialog.c.o"
+  "CMakeFiles/julius.dir/src/window/file_dialog.c.o.d"
+  "CMakeFiles/julius.dir/src/window/gift_to_emperor.c.o"
+  "CMakeFiles/julius.dir/src/window/gift_to_emperor.c.o.d"
+  "CMakeFiles/julius.dir/src/window/hold_festival.c.o"
+  "CMakeFiles/julius.dir/src/window/hold_festival.c.o.d"
+  "CMakeFiles/julius.dir/src/window/intermezzo.c.o"
+  "CMakeFiles/julius.dir/src/window/intermezzo.c.o.d"
+  "CMakeFiles/julius.dir/src/window/intro_video.c.o"
+  "CMakeFiles/julius.dir/src/window/intro_video.c.o.d"
+  "CMakeFiles/julius.dir/src/window/labor_priority.c.o"
+  "CMakeFiles/julius.dir/src/window/labor_priority.c.o.d"
+  "CMakeFiles/julius.dir/src/window/logo.c.o"
+  "CMakeFiles/julius.dir/src/window/logo.c.o.d"
+  "CMakeFiles/julius.dir/src/window/main_menu.c.o"
+  "CMakeFiles/julius.dir/src/window/main_menu.c.o.d"
+  "CMakeFiles/julius.dir/src/window/message_dialog.c.o"
+  "CMakeFiles/julius.dir/src/window/message_dialog.c.o.d"
+  "CMakeFiles/julius.dir/src/window/message_list.c.o"
+  "CMakeFiles/julius.dir/src/window/message_list.c.o.d"
+  "CMakeFiles/julius.dir/src/window/mission_briefing.c.o"
+  "CMakeFiles/julius.dir/src/window/mission_briefing.c.o.d"
+  "CMakeFiles/julius.dir/src/window/mission_end.c.o"
+  "CMakeFiles/julius.dir/src/window/mission_end.c.o.d"
+  "CMakeFiles/julius.dir/src/window/mission_selection.c.o"
+  "CMakeFiles/julius.dir/src/window/mission_selection.c.o.d"
+  "CMakeFiles/julius.dir/src/window/new_career.c.o"
+  "CMakeFiles/julius.dir/src/window/new_career.c.o.d"
+  "CMakeFiles/julius.dir/src/window/numeric_input.c.o"
+  "CMakeFiles/julius.dir/src/window/numeric_input.c.o.d"
+  "CMakeFiles/julius.dir/src/window/overlay_menu.c.o"
+  "CMakeFiles/julius.dir/src/window/overlay_menu.c.o.d"
+  "CMakeFiles/julius.dir/src/window/plain_message_dialog.c.o"
+  "CMakeFiles/julius.dir/src/window/plain_message_dialog.c.o.d"
+  "CMakeFiles/julius.dir/src/window/popup_dialog.c.o"
+  "CMakeFiles/julius.dir/src/window/popup_dialog.c.o.d"
+  "CMakeFiles/julius.dir/src/window/resource_settings.c.o"
+  "CMakeFiles/julius.dir/src/window/resource_settings.c.o.d"
+  "CMakeFiles/julius.dir/src/window/select_list.c.o"
+  "CMakeFiles/julius.dir/src/window/select_list.c.o.d"
+  "CMakeFiles/julius.dir/src/window/set_salary.c.o"
+  "CMakeFiles/julius.dir/src/window/set_salary.c.o.d"
+  "CMakeFiles/julius.dir/src/window/sound_options.c.o"
+  "CMakeFiles/julius.dir/src/window/sound_options.c.o.d"
+  "CMakeFiles/julius.dir/src/window/speed_options.c.o"
+  "CMakeFiles/julius.dir/src/window/speed_options.c.o.d"
+  "CMakeFiles/julius.dir/src/window/trade_opened.c.o"
+  "CMakeFiles/julius.dir/src/window/trade_opened.c.o.d"
+  "CMakeFiles/julius.dir/src/window/trade_prices.c.o"
+  "CMakeFiles/julius.dir/src/window/trade_prices.c.o.d"
+  "CMakeFiles/julius.dir/src/window/victory_dialog.c.o"
+  "CMakeFiles/julius.dir/src/window/victory_dialog.c.o.d"
+  "CMakeFiles/julius.dir/src/window/victory_video.c.o"
+  "CMakeFiles/julius.dir/src/window/victory_video.c.o.d"
+  "julius"
+  "julius.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/julius.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/zip.c" "test/CMakeFiles/compare.dir/__/src/core/zip.c.o" "gcc" "test/CMakeFiles/compare.dir/__/src/core/zip.c.o.d"
+  "/root/repo/test/sav/compare.c" "test/CMakeFiles/compare.dir/sav/compare.c.o" "gcc" "test/CMakeFiles/compare.dir/sav/compare.c.o.d"
+  "/root/repo/test/sav/sav_compare.c" "test/CMakeFiles/compare.dir/sav/sav_compare.c.o" "gcc" "test/CMakeFiles/compare.dir/sav/sav_compare.c.o.d"
+  "/root/repo/test/stub/log.c" "test/CMakeFiles/compare.dir/stub/log.c.o" "gcc" "test/CMakeFiles/compare.dir/stub/log.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
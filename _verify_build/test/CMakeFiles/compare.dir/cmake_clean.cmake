@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compare.dir/__/src/core/zip.c.o"
+  "CMakeFiles/compare.dir/__/src/core/zip.c.o.d"
+  "CMakeFiles/compare.dir/sav/compare.c.o"
+  "CMakeFiles/compare.dir/sav/compare.c.o.d"
+  "CMakeFiles/compare.dir/sav/sav_compare.c.o"
+  "CMakeFiles/compare.dir/sav/sav_compare.c.o.d"
+  "CMakeFiles/compare.dir/stub/log.c.o"
+  "CMakeFiles/compare.dir/stub/log.c.o.d"
+  "compare"
+  "compare.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/compare.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
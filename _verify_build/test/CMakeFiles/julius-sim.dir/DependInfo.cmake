@@ -0,0 +1,212 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/building/animation.c" "test/CMakeFiles/julius-sim.dir/__/src/building/animation.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/animation.c.o.d"
+  "/root/repo/src/building/barracks.c" "test/CMakeFiles/julius-sim.dir/__/src/building/barracks.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/barracks.c.o.d"
+  "/root/repo/src/building/building.c" "test/CMakeFiles/julius-sim.dir/__/src/building/building.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/building.c.o.d"
+  "/root/repo/src/building/building_state.c" "test/CMakeFiles/julius-sim.dir/__/src/building/building_state.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/building_state.c.o.d"
+  "/root/repo/src/building/construction.c" "test/CMakeFiles/julius-sim.dir/__/src/building/construction.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/construction.c.o.d"
+  "/root/repo/src/building/construction_building.c" "test/CMakeFiles/julius-sim.dir/__/src/building/construction_building.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/construction_building.c.o.d"
+  "/root/repo/src/building/construction_clear.c" "test/CMakeFiles/julius-sim.dir/__/src/building/construction_clear.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/construction_clear.c.o.d"
+  "/root/repo/src/building/construction_routed.c" "test/CMakeFiles/julius-sim.dir/__/src/building/construction_routed.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/construction_routed.c.o.d"
+  "/root/repo/src/building/construction_warning.c" "test/CMakeFiles/julius-sim.dir/__/src/building/construction_warning.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/construction_warning.c.o.d"
+  "/root/repo/src/building/count.c" "test/CMakeFiles/julius-sim.dir/__/src/building/count.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/count.c.o.d"
+  "/root/repo/src/building/destruction.c" "test/CMakeFiles/julius-sim.dir/__/src/building/destruction.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/destruction.c.o.d"
+  "/root/repo/src/building/dock.c" "test/CMakeFiles/julius-sim.dir/__/src/building/dock.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/dock.c.o.d"
+  "/root/repo/src/building/figure.c" "test/CMakeFiles/julius-sim.dir/__/src/building/figure.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/figure.c.o.d"
+  "/root/repo/src/building/government.c" "test/CMakeFiles/julius-sim.dir/__/src/building/government.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/government.c.o.d"
+  "/root/repo/src/building/granary.c" "test/CMakeFiles/julius-sim.dir/__/src/building/granary.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/granary.c.o.d"
+  "/root/repo/src/building/house.c" "test/CMakeFiles/julius-sim.dir/__/src/building/house.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/house.c.o.d"
+  "/root/repo/src/building/house_evolution.c" "test/CMakeFiles/julius-sim.dir/__/src/building/house_evolution.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/house_evolution.c.o.d"
+  "/root/repo/src/building/house_population.c" "test/CMakeFiles/julius-sim.dir/__/src/building/house_population.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/house_population.c.o.d"
+  "/root/repo/src/building/house_service.c" "test/CMakeFiles/julius-sim.dir/__/src/building/house_service.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/house_service.c.o.d"
+  "/root/repo/src/building/industry.c" "test/CMakeFiles/julius-sim.dir/__/src/building/industry.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/industry.c.o.d"
+  "/root/repo/src/building/list.c" "test/CMakeFiles/julius-sim.dir/__/src/building/list.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/list.c.o.d"
+  "/root/repo/src/building/maintenance.c" "test/CMakeFiles/julius-sim.dir/__/src/building/maintenance.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/maintenance.c.o.d"
+  "/root/repo/src/building/market.c" "test/CMakeFiles/julius-sim.dir/__/src/building/market.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/market.c.o.d"
+  "/root/repo/src/building/menu.c" "test/CMakeFiles/julius-sim.dir/__/src/building/menu.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/menu.c.o.d"
+  "/root/repo/src/building/properties.c" "test/CMakeFiles/julius-sim.dir/__/src/building/properties.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/properties.c.o.d"
+  "/root/repo/src/building/storage.c" "test/CMakeFiles/julius-sim.dir/__/src/building/storage.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/storage.c.o.d"
+  "/root/repo/src/building/warehouse.c" "test/CMakeFiles/julius-sim.dir/__/src/building/warehouse.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/building/warehouse.c.o.d"
+  "/root/repo/src/city/buildings.c" "test/CMakeFiles/julius-sim.dir/__/src/city/buildings.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/buildings.c.o.d"
+  "/root/repo/src/city/culture.c" "test/CMakeFiles/julius-sim.dir/__/src/city/culture.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/culture.c.o.d"
+  "/root/repo/src/city/data.c" "test/CMakeFiles/julius-sim.dir/__/src/city/data.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/data.c.o.d"
+  "/root/repo/src/city/data_private.c" "test/CMakeFiles/julius-sim.dir/__/src/city/data_private.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/data_private.c.o.d"
+  "/root/repo/src/city/emperor.c" "test/CMakeFiles/julius-sim.dir/__/src/city/emperor.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/emperor.c.o.d"
+  "/root/repo/src/city/entertainment.c" "test/CMakeFiles/julius-sim.dir/__/src/city/entertainment.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/entertainment.c.o.d"
+  "/root/repo/src/city/festival.c" "test/CMakeFiles/julius-sim.dir/__/src/city/festival.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/festival.c.o.d"
+  "/root/repo/src/city/figures.c" "test/CMakeFiles/julius-sim.dir/__/src/city/figures.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/figures.c.o.d"
+  "/root/repo/src/city/finance.c" "test/CMakeFiles/julius-sim.dir/__/src/city/finance.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/finance.c.o.d"
+  "/root/repo/src/city/gods.c" "test/CMakeFiles/julius-sim.dir/__/src/city/gods.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/gods.c.o.d"
+  "/root/repo/src/city/health.c" "test/CMakeFiles/julius-sim.dir/__/src/city/health.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/health.c.o.d"
+  "/root/repo/src/city/houses.c" "test/CMakeFiles/julius-sim.dir/__/src/city/houses.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/houses.c.o.d"
+  "/root/repo/src/city/labor.c" "test/CMakeFiles/julius-sim.dir/__/src/city/labor.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/labor.c.o.d"
+  "/root/repo/src/city/map.c" "test/CMakeFiles/julius-sim.dir/__/src/city/map.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/map.c.o.d"
+  "/root/repo/src/city/message.c" "test/CMakeFiles/julius-sim.dir/__/src/city/message.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/message.c.o.d"
+  "/root/repo/src/city/migration.c" "test/CMakeFiles/julius-sim.dir/__/src/city/migration.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/migration.c.o.d"
+  "/root/repo/src/city/military.c" "test/CMakeFiles/julius-sim.dir/__/src/city/military.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/military.c.o.d"
+  "/root/repo/src/city/mission.c" "test/CMakeFiles/julius-sim.dir/__/src/city/mission.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/mission.c.o.d"
+  "/root/repo/src/city/population.c" "test/CMakeFiles/julius-sim.dir/__/src/city/population.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/population.c.o.d"
+  "/root/repo/src/city/ratings.c" "test/CMakeFiles/julius-sim.dir/__/src/city/ratings.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/ratings.c.o.d"
+  "/root/repo/src/city/resource.c" "test/CMakeFiles/julius-sim.dir/__/src/city/resource.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/resource.c.o.d"
+  "/root/repo/src/city/sentiment.c" "test/CMakeFiles/julius-sim.dir/__/src/city/sentiment.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/sentiment.c.o.d"
+  "/root/repo/src/city/sound.c" "test/CMakeFiles/julius-sim.dir/__/src/city/sound.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/sound.c.o.d"
+  "/root/repo/src/city/trade.c" "test/CMakeFiles/julius-sim.dir/__/src/city/trade.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/trade.c.o.d"
+  "/root/repo/src/city/victory.c" "test/CMakeFiles/julius-sim.dir/__/src/city/victory.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/victory.c.o.d"
+  "/root/repo/src/city/view.c" "test/CMakeFiles/julius-sim.dir/__/src/city/view.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/view.c.o.d"
+  "/root/repo/src/city/warning.c" "test/CMakeFiles/julius-sim.dir/__/src/city/warning.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/city/warning.c.o.d"
+  "/root/repo/src/core/backtrace.c" "test/CMakeFiles/julius-sim.dir/__/src/core/backtrace.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/backtrace.c.o.d"
+  "/root/repo/src/core/buffer.c" "test/CMakeFiles/julius-sim.dir/__/src/core/buffer.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/buffer.c.o.d"
+  "/root/repo/src/core/calc.c" "test/CMakeFiles/julius-sim.dir/__/src/core/calc.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/calc.c.o.d"
+  "/root/repo/src/core/config.c" "test/CMakeFiles/julius-sim.dir/__/src/core/config.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/config.c.o.d"
+  "/root/repo/src/core/dir.c" "test/CMakeFiles/julius-sim.dir/__/src/core/dir.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/dir.c.o.d"
+  "/root/repo/src/core/encoding.c" "test/CMakeFiles/julius-sim.dir/__/src/core/encoding.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/encoding.c.o.d"
+  "/root/repo/src/core/encoding_multibyte.c" "test/CMakeFiles/julius-sim.dir/__/src/core/encoding_multibyte.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/encoding_multibyte.c.o.d"
+  "/root/repo/src/core/file.c" "test/CMakeFiles/julius-sim.dir/__/src/core/file.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/file.c.o.d"
+  "/root/repo/src/core/io.c" "test/CMakeFiles/julius-sim.dir/__/src/core/io.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/io.c.o.d"
+  "/root/repo/src/core/locale.c" "test/CMakeFiles/julius-sim.dir/__/src/core/locale.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/locale.c.o.d"
+  "/root/repo/src/core/random.c" "test/CMakeFiles/julius-sim.dir/__/src/core/random.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/random.c.o.d"
+  "/root/repo/src/core/smacker.c" "test/CMakeFiles/julius-sim.dir/__/src/core/smacker.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/smacker.c.o.d"
+  "/root/repo/src/core/string.c" "test/CMakeFiles/julius-sim.dir/__/src/core/string.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/string.c.o.d"
+  "/root/repo/src/core/time.c" "test/CMakeFiles/julius-sim.dir/__/src/core/time.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/time.c.o.d"
+  "/root/repo/src/core/zip.c" "test/CMakeFiles/julius-sim.dir/__/src/core/zip.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/core/zip.c.o.d"
+  "/root/repo/src/editor/editor.c" "test/CMakeFiles/julius-sim.dir/__/src/editor/editor.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/editor/editor.c.o.d"
+  "/root/repo/src/editor/tool.c" "test/CMakeFiles/julius-sim.dir/__/src/editor/tool.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/editor/tool.c.o.d"
+  "/root/repo/src/editor/tool_restriction.c" "test/CMakeFiles/julius-sim.dir/__/src/editor/tool_restriction.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/editor/tool_restriction.c.o.d"
+  "/root/repo/src/empire/city.c" "test/CMakeFiles/julius-sim.dir/__/src/empire/city.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/empire/city.c.o.d"
+  "/root/repo/src/empire/empire.c" "test/CMakeFiles/julius-sim.dir/__/src/empire/empire.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/empire/empire.c.o.d"
+  "/root/repo/src/empire/object.c" "test/CMakeFiles/julius-sim.dir/__/src/empire/object.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/empire/object.c.o.d"
+  "/root/repo/src/empire/trade_prices.c" "test/CMakeFiles/julius-sim.dir/__/src/empire/trade_prices.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/empire/trade_prices.c.o.d"
+  "/root/repo/src/empire/trade_route.c" "test/CMakeFiles/julius-sim.dir/__/src/empire/trade_route.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/empire/trade_route.c.o.d"
+  "/root/repo/src/figure/action.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/action.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/action.c.o.d"
+  "/root/repo/src/figure/combat.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/combat.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/combat.c.o.d"
+  "/root/repo/src/figure/enemy_army.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/enemy_army.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/enemy_army.c.o.d"
+  "/root/repo/src/figure/figure.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/figure.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/figure.c.o.d"
+  "/root/repo/src/figure/formation.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/formation.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/formation.c.o.d"
+  "/root/repo/src/figure/formation_enemy.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/formation_enemy.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/formation_enemy.c.o.d"
+  "/root/repo/src/figure/formation_herd.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/formation_herd.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/formation_herd.c.o.d"
+  "/root/repo/src/figure/formation_layout.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/formation_layout.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/formation_layout.c.o.d"
+  "/root/repo/src/figure/formation_legion.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/formation_legion.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/formation_legion.c.o.d"
+  "/root/repo/src/figure/image.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/image.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/image.c.o.d"
+  "/root/repo/src/figure/intent.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/intent.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/intent.c.o.d"
+  "/root/repo/src/figure/movement.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/movement.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/movement.c.o.d"
+  "/root/repo/src/figure/name.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/name.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/name.c.o.d"
+  "/root/repo/src/figure/phrase.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/phrase.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/phrase.c.o.d"
+  "/root/repo/src/figure/properties.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/properties.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/properties.c.o.d"
+  "/root/repo/src/figure/route.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/route.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/route.c.o.d"
+  "/root/repo/src/figure/service.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/service.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/service.c.o.d"
+  "/root/repo/src/figure/sound.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/sound.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/sound.c.o.d"
+  "/root/repo/src/figure/trader.c" "test/CMakeFiles/julius-sim.dir/__/src/figure/trader.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figure/trader.c.o.d"
+  "/root/repo/src/figuretype/animal.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/animal.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/animal.c.o.d"
+  "/root/repo/src/figuretype/cartpusher.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/cartpusher.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/cartpusher.c.o.d"
+  "/root/repo/src/figuretype/crime.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/crime.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/crime.c.o.d"
+  "/root/repo/src/figuretype/docker.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/docker.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/docker.c.o.d"
+  "/root/repo/src/figuretype/editor.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/editor.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/editor.c.o.d"
+  "/root/repo/src/figuretype/enemy.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/enemy.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/enemy.c.o.d"
+  "/root/repo/src/figuretype/entertainer.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/entertainer.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/entertainer.c.o.d"
+  "/root/repo/src/figuretype/maintenance.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/maintenance.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/maintenance.c.o.d"
+  "/root/repo/src/figuretype/market.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/market.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/market.c.o.d"
+  "/root/repo/src/figuretype/migrant.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/migrant.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/migrant.c.o.d"
+  "/root/repo/src/figuretype/missile.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/missile.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/missile.c.o.d"
+  "/root/repo/src/figuretype/native.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/native.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/native.c.o.d"
+  "/root/repo/src/figuretype/service.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/service.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/service.c.o.d"
+  "/root/repo/src/figuretype/soldier.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/soldier.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/soldier.c.o.d"
+  "/root/repo/src/figuretype/trader.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/trader.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/trader.c.o.d"
+  "/root/repo/src/figuretype/wall.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/wall.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/wall.c.o.d"
+  "/root/repo/src/figuretype/water.c" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/water.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/figuretype/water.c.o.d"
+  "/root/repo/src/game/animation.c" "test/CMakeFiles/julius-sim.dir/__/src/game/animation.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/animation.c.o.d"
+  "/root/repo/src/game/difficulty.c" "test/CMakeFiles/julius-sim.dir/__/src/game/difficulty.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/difficulty.c.o.d"
+  "/root/repo/src/game/file.c" "test/CMakeFiles/julius-sim.dir/__/src/game/file.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/file.c.o.d"
+  "/root/repo/src/game/file_editor.c" "test/CMakeFiles/julius-sim.dir/__/src/game/file_editor.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/file_editor.c.o.d"
+  "/root/repo/src/game/file_io.c" "test/CMakeFiles/julius-sim.dir/__/src/game/file_io.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/file_io.c.o.d"
+  "/root/repo/src/game/game.c" "test/CMakeFiles/julius-sim.dir/__/src/game/game.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/game.c.o.d"
+  "/root/repo/src/game/mission.c" "test/CMakeFiles/julius-sim.dir/__/src/game/mission.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/mission.c.o.d"
+  "/root/repo/src/game/orientation.c" "test/CMakeFiles/julius-sim.dir/__/src/game/orientation.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/orientation.c.o.d"
+  "/root/repo/src/game/replay.c" "test/CMakeFiles/julius-sim.dir/__/src/game/replay.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/replay.c.o.d"
+  "/root/repo/src/game/resource.c" "test/CMakeFiles/julius-sim.dir/__/src/game/resource.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/resource.c.o.d"
+  "/root/repo/src/game/rewind.c" "test/CMakeFiles/julius-sim.dir/__/src/game/rewind.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/rewind.c.o.d"
+  "/root/repo/src/game/settings.c" "test/CMakeFiles/julius-sim.dir/__/src/game/settings.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/settings.c.o.d"
+  "/root/repo/src/game/state.c" "test/CMakeFiles/julius-sim.dir/__/src/game/state.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/state.c.o.d"
+  "/root/repo/src/game/tick.c" "test/CMakeFiles/julius-sim.dir/__/src/game/tick.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/tick.c.o.d"
+  "/root/repo/src/game/time.c" "test/CMakeFiles/julius-sim.dir/__/src/game/time.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/time.c.o.d"
+  "/root/repo/src/game/tutorial.c" "test/CMakeFiles/julius-sim.dir/__/src/game/tutorial.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/tutorial.c.o.d"
+  "/root/repo/src/game/undo.c" "test/CMakeFiles/julius-sim.dir/__/src/game/undo.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/game/undo.c.o.d"
+  "/root/repo/src/map/aqueduct.c" "test/CMakeFiles/julius-sim.dir/__/src/map/aqueduct.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/aqueduct.c.o.d"
+  "/root/repo/src/map/bookmark.c" "test/CMakeFiles/julius-sim.dir/__/src/map/bookmark.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/bookmark.c.o.d"
+  "/root/repo/src/map/bridge.c" "test/CMakeFiles/julius-sim.dir/__/src/map/bridge.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/bridge.c.o.d"
+  "/root/repo/src/map/building.c" "test/CMakeFiles/julius-sim.dir/__/src/map/building.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/building.c.o.d"
+  "/root/repo/src/map/building_tiles.c" "test/CMakeFiles/julius-sim.dir/__/src/map/building_tiles.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/building_tiles.c.o.d"
+  "/root/repo/src/map/desirability.c" "test/CMakeFiles/julius-sim.dir/__/src/map/desirability.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/desirability.c.o.d"
+  "/root/repo/src/map/elevation.c" "test/CMakeFiles/julius-sim.dir/__/src/map/elevation.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/elevation.c.o.d"
+  "/root/repo/src/map/figure.c" "test/CMakeFiles/julius-sim.dir/__/src/map/figure.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/figure.c.o.d"
+  "/root/repo/src/map/grid.c" "test/CMakeFiles/julius-sim.dir/__/src/map/grid.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/grid.c.o.d"
+  "/root/repo/src/map/house_service.c" "test/CMakeFiles/julius-sim.dir/__/src/map/house_service.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/house_service.c.o.d"
+  "/root/repo/src/map/image.c" "test/CMakeFiles/julius-sim.dir/__/src/map/image.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/image.c.o.d"
+  "/root/repo/src/map/image_context.c" "test/CMakeFiles/julius-sim.dir/__/src/map/image_context.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/image_context.c.o.d"
+  "/root/repo/src/map/natives.c" "test/CMakeFiles/julius-sim.dir/__/src/map/natives.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/natives.c.o.d"
+  "/root/repo/src/map/orientation.c" "test/CMakeFiles/julius-sim.dir/__/src/map/orientation.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/orientation.c.o.d"
+  "/root/repo/src/map/point.c" "test/CMakeFiles/julius-sim.dir/__/src/map/point.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/point.c.o.d"
+  "/root/repo/src/map/property.c" "test/CMakeFiles/julius-sim.dir/__/src/map/property.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/property.c.o.d"
+  "/root/repo/src/map/random.c" "test/CMakeFiles/julius-sim.dir/__/src/map/random.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/random.c.o.d"
+  "/root/repo/src/map/ring.c" "test/CMakeFiles/julius-sim.dir/__/src/map/ring.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/ring.c.o.d"
+  "/root/repo/src/map/road_access.c" "test/CMakeFiles/julius-sim.dir/__/src/map/road_access.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/road_access.c.o.d"
+  "/root/repo/src/map/road_aqueduct.c" "test/CMakeFiles/julius-sim.dir/__/src/map/road_aqueduct.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/road_aqueduct.c.o.d"
+  "/root/repo/src/map/road_network.c" "test/CMakeFiles/julius-sim.dir/__/src/map/road_network.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/road_network.c.o.d"
+  "/root/repo/src/map/routing.c" "test/CMakeFiles/julius-sim.dir/__/src/map/routing.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/routing.c.o.d"
+  "/root/repo/src/map/routing_data.c" "test/CMakeFiles/julius-sim.dir/__/src/map/routing_data.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/routing_data.c.o.d"
+  "/root/repo/src/map/routing_path.c" "test/CMakeFiles/julius-sim.dir/__/src/map/routing_path.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/routing_path.c.o.d"
+  "/root/repo/src/map/routing_terrain.c" "test/CMakeFiles/julius-sim.dir/__/src/map/routing_terrain.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/routing_terrain.c.o.d"
+  "/root/repo/src/map/soldier_strength.c" "test/CMakeFiles/julius-sim.dir/__/src/map/soldier_strength.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/soldier_strength.c.o.d"
+  "/root/repo/src/map/sprite.c" "test/CMakeFiles/julius-sim.dir/__/src/map/sprite.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/sprite.c.o.d"
+  "/root/repo/src/map/terrain.c" "test/CMakeFiles/julius-sim.dir/__/src/map/terrain.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/terrain.c.o.d"
+  "/root/repo/src/map/tiles.c" "test/CMakeFiles/julius-sim.dir/__/src/map/tiles.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/tiles.c.o.d"
+  "/root/repo/src/map/water.c" "test/CMakeFiles/julius-sim.dir/__/src/map/water.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/water.c.o.d"
+  "/root/repo/src/map/water_supply.c" "test/CMakeFiles/julius-sim.dir/__/src/map/water_supply.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/map/water_supply.c.o.d"
+  "/root/repo/src/scenario/building.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/building.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/building.c.o.d"
+  "/root/repo/src/scenario/criteria.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/criteria.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/criteria.c.o.d"
+  "/root/repo/src/scenario/demand_change.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/demand_change.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/demand_change.c.o.d"
+  "/root/repo/src/scenario/distant_battle.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/distant_battle.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/distant_battle.c.o.d"
+  "/root/repo/src/scenario/earthquake.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/earthquake.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/earthquake.c.o.d"
+  "/root/repo/src/scenario/editor.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/editor.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/editor.c.o.d"
+  "/root/repo/src/scenario/editor_events.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/editor_events.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/editor_events.c.o.d"
+  "/root/repo/src/scenario/editor_map.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/editor_map.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/editor_map.c.o.d"
+  "/root/repo/src/scenario/emperor_change.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/emperor_change.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/emperor_change.c.o.d"
+  "/root/repo/src/scenario/empire.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/empire.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/empire.c.o.d"
+  "/root/repo/src/scenario/gladiator_revolt.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/gladiator_revolt.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/gladiator_revolt.c.o.d"
+  "/root/repo/src/scenario/invasion.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/invasion.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/invasion.c.o.d"
+  "/root/repo/src/scenario/map.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/map.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/map.c.o.d"
+  "/root/repo/src/scenario/price_change.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/price_change.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/price_change.c.o.d"
+  "/root/repo/src/scenario/property.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/property.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/property.c.o.d"
+  "/root/repo/src/scenario/random_event.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/random_event.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/random_event.c.o.d"
+  "/root/repo/src/scenario/request.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/request.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/request.c.o.d"
+  "/root/repo/src/scenario/scenario.c" "test/CMakeFiles/julius-sim.dir/__/src/scenario/scenario.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/scenario/scenario.c.o.d"
+  "/root/repo/src/sound/city.c" "test/CMakeFiles/julius-sim.dir/__/src/sound/city.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/sound/city.c.o.d"
+  "/root/repo/src/sound/effect.c" "test/CMakeFiles/julius-sim.dir/__/src/sound/effect.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/sound/effect.c.o.d"
+  "/root/repo/src/sound/music.c" "test/CMakeFiles/julius-sim.dir/__/src/sound/music.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/sound/music.c.o.d"
+  "/root/repo/src/sound/speech.c" "test/CMakeFiles/julius-sim.dir/__/src/sound/speech.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/sound/speech.c.o.d"
+  "/root/repo/src/sound/system.c" "test/CMakeFiles/julius-sim.dir/__/src/sound/system.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/__/src/sound/system.c.o.d"
+  "/root/repo/test/sav/sim.c" "test/CMakeFiles/julius-sim.dir/sav/sim.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/sav/sim.c.o.d"
+  "/root/repo/test/stub/image.c" "test/CMakeFiles/julius-sim.dir/stub/image.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/stub/image.c.o.d"
+  "/root/repo/test/stub/input.c" "test/CMakeFiles/julius-sim.dir/stub/input.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/stub/input.c.o.d"
+  "/root/repo/test/stub/lang.c" "test/CMakeFiles/julius-sim.dir/stub/lang.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/stub/lang.c.o.d"
+  "/root/repo/test/stub/log.c" "test/CMakeFiles/julius-sim.dir/stub/log.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/stub/log.c.o.d"
+  "/root/repo/test/stub/model.c" "test/CMakeFiles/julius-sim.dir/stub/model.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/stub/model.c.o.d"
+  "/root/repo/test/stub/sound_device.c" "test/CMakeFiles/julius-sim.dir/stub/sound_device.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/stub/sound_device.c.o.d"
+  "/root/repo/test/stub/system.c" "test/CMakeFiles/julius-sim.dir/stub/system.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/stub/system.c.o.d"
+  "/root/repo/test/stub/ui.c" "test/CMakeFiles/julius-sim.dir/stub/ui.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/stub/ui.c.o.d"
+  "/root/repo/test/stub/video.c" "test/CMakeFiles/julius-sim.dir/stub/video.c.o" "gcc" "test/CMakeFiles/julius-sim.dir/stub/video.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
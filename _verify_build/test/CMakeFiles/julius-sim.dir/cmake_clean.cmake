@@ -0,0 +1,397 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/julius-sim.dir/__/src/building/animation.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/animation.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/barracks.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/barracks.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/building.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/building.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/building_state.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/building_state.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/construction.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/construction.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/construction_building.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/construction_building.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/construction_clear.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/construction_clear.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/construction_routed.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/construction_routed.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/construction_warning.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/construction_warning.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/count.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/count.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/destruction.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/destruction.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/dock.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/dock.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/figure.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/figure.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/government.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/government.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/granary.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/granary.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/house.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/house.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/house_evolution.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/house_evolution.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/house_population.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/house_population.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/house_service.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/house_service.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/industry.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/industry.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/list.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/list.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/maintenance.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/maintenance.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/market.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/market.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/menu.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/menu.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/properties.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/properties.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/storage.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/storage.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/building/warehouse.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/building/warehouse.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/buildings.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/buildings.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/culture.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/culture.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/data.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/data.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/data_private.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/data_private.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/emperor.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/emperor.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/entertainment.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/entertainment.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/festival.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/festival.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/figures.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/figures.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/finance.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/finance.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/gods.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/gods.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/health.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/health.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/houses.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/houses.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/labor.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/labor.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/map.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/map.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/message.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/message.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/migration.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/migration.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/military.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/military.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/mission.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/mission.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/population.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/population.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/ratings.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/ratings.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/resource.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/resource.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/sentiment.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/sentiment.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/sound.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/sound.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/trade.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/trade.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/victory.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/victory.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/view.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/view.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/city/warning.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/city/warning.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/backtrace.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/backtrace.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/buffer.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/buffer.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/calc.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/calc.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/config.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/config.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/dir.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/dir.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/encoding.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/encoding.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/encoding_multibyte.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/encoding_multibyte.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/file.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/file.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/io.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/io.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/locale.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/locale.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/random.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/random.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/smacker.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/smacker.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/string.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/string.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/time.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/time.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/core/zip.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/core/zip.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/editor/editor.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/editor/editor.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/editor/tool.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/editor/tool.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/editor/tool_restriction.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/editor/tool_restriction.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/empire/city.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/empire/city.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/empire/empire.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/empire/empire.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/empire/object.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/empire/object.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/empire/trade_prices.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/empire/trade_prices.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/empire/trade_route.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/empire/trade_route.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/action.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/action.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/combat.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/combat.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/enemy_army.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/enemy_army.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/figure.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/figure.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/formation.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/formation.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/formation_enemy.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/formation_enemy.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/formation_herd.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/formation_herd.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/formation_layout.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/formation_layout.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/formation_legion.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/formation_legion.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/image.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/image.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/intent.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/intent.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/movement.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/movement.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/name.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/name.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/phrase.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/phrase.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/properties.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/properties.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/route.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/route.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/service.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/service.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/sound.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/sound.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figure/trader.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figure/trader.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/animal.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/animal.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/cartpusher.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/cartpusher.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/crime.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/crime.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/docker.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/docker.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/editor.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/editor.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/enemy.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/enemy.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/entertainer.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/entertainer.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/maintenance.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/maintenance.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/market.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/market.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/migrant.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/migrant.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/missile.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/missile.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/native.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/native.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/service.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/service.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/soldier.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/soldier.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/trader.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/trader.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/wall.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/wall.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/water.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/figuretype/water.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/animation.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/animation.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/difficulty.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/difficulty.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/file.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/file.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/file_editor.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/file_editor.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/file_io.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/file_io.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/game.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/game.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/mission.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/mission.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/orientation.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/orientation.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/replay.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/replay.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/resource.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/resource.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/rewind.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/rewind.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/settings.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/settings.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/state.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/state.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/tick.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/tick.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/time.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/time.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/tutorial.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/tutorial.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/game/undo.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/game/undo.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/aqueduct.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/aqueduct.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/bookmark.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/bookmark.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/bridge.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/bridge.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/building.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/building.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/building_tiles.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/building_tiles.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/desirability.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/desirability.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/elevation.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/elevation.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/figure.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/figure.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/grid.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/grid.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/house_service.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/house_service.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/image.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/image.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/image_context.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/image_context.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/natives.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/natives.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/orientation.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/orientation.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/point.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/point.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/property.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/property.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/random.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/random.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/ring.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/ring.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/road_access.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/road_access.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/road_aqueduct.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/road_aqueduct.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/road_network.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/road_network.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/routing.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/routing.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/routing_data.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/routing_data.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/routing_path.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/routing_path.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/routing_terrain.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/routing_terrain.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/soldier_strength.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/soldier_strength.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/sprite.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/sprite.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/terrain.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/terrain.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/tiles.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/tiles.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/water.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/water.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/map/water_supply.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/map/water_supply.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/building.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/building.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/criteria.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/criteria.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/demand_change.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/demand_change.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/distant_battle.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/distant_battle.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/earthquake.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/earthquake.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/editor.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/editor.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/editor_events.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/editor_events.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/editor_map.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/editor_map.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/emperor_change.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/emperor_change.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/empire.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/empire.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/gladiator_revolt.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/gladiator_revolt.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/invasion.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/invasion.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/map.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/map.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/price_change.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/price_change.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/property.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/property.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/random_event.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/random_event.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/request.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/request.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/scenario.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/scenario/scenario.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/sound/city.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/sound/city.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/sound/effect.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/sound/effect.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/sound/music.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/sound/music.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/sound/speech.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/sound/speech.c.o.d"
+  "CMakeFiles/julius-sim.dir/__/src/sound/system.c.o"
+  "CMakeFiles/julius-sim.dir/__/src/sound/system.c.o.d"
+  "CMakeFiles/julius-sim.dir/sav/sim.c.o"
+  "CMakeFiles/julius-sim.dir/sav/sim.c.o.d"
+  "CMakeFiles/julius-sim.dir/stub/image.c.o"
+  "CMakeFiles/julius-sim.dir/stub/image.c.o.d"
+  "CMakeFiles/julius-sim.dir/stub/input.c.o"
+  "CMakeFiles/julius-sim.dir/stub/input.c.o.d"
+  "CMakeFiles/julius-sim.dir/stub/lang.c.o"
+  "CMakeFiles/julius-sim.dir/stub/lang.c.o.d"
+  "CMakeFiles/julius-sim.dir/stub/log.c.o"
+  "CMakeFiles/julius-sim.dir/stub/log.c.o.d"
+  "CMakeFiles/julius-sim.dir/stub/model.c.o"
+  "CMakeFiles/julius-sim.dir/stub/model.c.o.d"
+  "CMakeFiles/julius-sim.dir/stub/sound_device.c.o"
+  "CMakeFiles/julius-sim.dir/stub/sound_device.c.o.d"
+  "CMakeFiles/julius-sim.dir/stub/system.c.o"
+  "CMakeFiles/julius-sim.dir/stub/system.c.o.d"
+  "CMakeFiles/julius-sim.dir/stub/ui.c.o"
+  "CMakeFiles/julius-sim.dir/stub/ui.c.o.d"
+  "CMakeFiles/julius-sim.dir/stub/video.c.o"
+  "CMakeFiles/julius-sim.dir/stub/video.c.o.d"
+  "julius-sim"
+  "julius-sim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/julius-sim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
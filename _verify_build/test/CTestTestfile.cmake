@@ -0,0 +1,92 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_verify_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(sav_tower "/root/repo/_verify_build/test/autopilot" "tower.sav" "tower2-actual.sav" "tower2.sav" "1785")
+set_tests_properties(sav_tower PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;95;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_replay_tower "/root/repo/_verify_build/test/autopilot" "tower.sav" "tower_replay-actual.sav" "tower_replay.sav" "0" "tower_replay.txt")
+set_tests_properties(sav_replay_tower PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;92;add_test;/root/repo/test/CMakeLists.txt;96;add_replay_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sim_smoke "/root/repo/_verify_build/test/julius-sim" "--ticks" "100" "--jobs" "2" "--spawn-costs" "tower.sav" "earthquake.sav")
+set_tests_properties(sim_smoke PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_record_tower "/root/repo/_verify_build/test/autopilot" "--record" "tower_record.txt" "tower.sav" "1000")
+set_tests_properties(sav_record_tower PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;101;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_record_replay_tower "/root/repo/_verify_build/test/autopilot" "tower_record.txt.sav" "tower_record-replayed.sav" "tower_record.txt-end.sav" "0" "tower_record.txt")
+set_tests_properties(sav_record_replay_tower PROPERTIES  DEPENDS "sav_record_tower" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;102;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_request1 "/root/repo/_verify_build/test/autopilot" "request_start.sav" "request_orig-actual.sav" "request_orig.sav" "908")
+set_tests_properties(sav_request1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;105;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_request2 "/root/repo/_verify_build/test/autopilot" "request_start.sav" "request_orig2-actual.sav" "request_orig2.sav" "6556")
+set_tests_properties(sav_request2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;106;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_caesar1 "/root/repo/_verify_build/test/autopilot" "kknight.sav" "kknight2-actual.sav" "kknight2.sav" "686")
+set_tests_properties(sav_caesar1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;109;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_caesar2 "/root/repo/_verify_build/test/autopilot" "kknight.sav" "kknight3-actual.sav" "kknight3.sav" "1087")
+set_tests_properties(sav_caesar2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;110;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_caesar3 "/root/repo/_verify_build/test/autopilot" "kknight.sav" "kknight4-actual.sav" "kknight4.sav" "1287")
+set_tests_properties(sav_caesar3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;111;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_caesar4 "/root/repo/_verify_build/test/autopilot" "kknight.sav" "kknight5-actual.sav" "kknight5.sav" "1494")
+set_tests_properties(sav_caesar4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;112;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_invasion1 "/root/repo/_verify_build/test/autopilot" "inv0.sav" "inv1-actual.sav" "inv1.sav" "1973")
+set_tests_properties(sav_invasion1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;115;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_invasion2 "/root/repo/_verify_build/test/autopilot" "inv0.sav" "inv2-actual.sav" "inv2.sav" "3521")
+set_tests_properties(sav_invasion2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;116;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_invasion3 "/root/repo/_verify_build/test/autopilot" "inv0.sav" "inv3-actual.sav" "inv3.sav" "5105")
+set_tests_properties(sav_invasion3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;117;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_invasion4 "/root/repo/_verify_build/test/autopilot" "inv0.sav" "inv4-actual.sav" "inv4.sav" "6777")
+set_tests_properties(sav_invasion4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;118;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_invasion5 "/root/repo/_verify_build/test/autopilot" "inv0.sav" "inv5-actual.sav" "inv5.sav" "8563")
+set_tests_properties(sav_invasion5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;119;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_distantbattle1 "/root/repo/_verify_build/test/autopilot" "db-fort1.sav" "db-fort1-done-actual.sav" "db-fort1-done.sav" "6328")
+set_tests_properties(sav_distantbattle1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;122;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_distantbattle2 "/root/repo/_verify_build/test/autopilot" "db-fort2.sav" "db-fort2-done-actual.sav" "db-fort2-done.sav" "6335")
+set_tests_properties(sav_distantbattle2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;123;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_distantbattle3 "/root/repo/_verify_build/test/autopilot" "db-fort2.sav" "db-fort2-done2-actual.sav" "db-fort2-done2.sav" "11197")
+set_tests_properties(sav_distantbattle3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;124;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_routing_full "/root/repo/_verify_build/test/autopilot" "routing-full.sav" "routing-full-kill-actual.sav" "routing-full-kill.sav" "7")
+set_tests_properties(sav_routing_full PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;127;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_curses1 "/root/repo/_verify_build/test/autopilot" "curses.sav" "curses-done-actual.sav" "curses-done.sav" "13350")
+set_tests_properties(sav_curses1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;130;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_curses2 "/root/repo/_verify_build/test/autopilot" "mars-wrath.sav" "mars-wrath-after-actual.sav" "mars-wrath-after.sav" "1016")
+set_tests_properties(sav_curses2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;131;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_earthquake0 "/root/repo/_verify_build/test/autopilot" "earthquake.sav" "earthquake-start-actual.sav" "earthquake-start.sav" "371")
+set_tests_properties(sav_earthquake0 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;134;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_earthquake1 "/root/repo/_verify_build/test/autopilot" "earthquake.sav" "earthquake-during1-actual.sav" "earthquake-during1.sav" "551")
+set_tests_properties(sav_earthquake1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;135;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_earthquake2 "/root/repo/_verify_build/test/autopilot" "earthquake.sav" "earthquake-during2-actual.sav" "earthquake-during2.sav" "1071")
+set_tests_properties(sav_earthquake2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;136;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_earthquake3 "/root/repo/_verify_build/test/autopilot" "earthquake.sav" "earthquake-during3-actual.sav" "earthquake-during3.sav" "1602")
+set_tests_properties(sav_earthquake3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;137;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_earthquake4 "/root/repo/_verify_build/test/autopilot" "earthquake.sav" "earthquake-during4-actual.sav" "earthquake-during4.sav" "2155")
+set_tests_properties(sav_earthquake4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;138;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_earthquake5 "/root/repo/_verify_build/test/autopilot" "earthquake.sav" "earthquake-after-actual.sav" "earthquake-after.sav" "3748")
+set_tests_properties(sav_earthquake5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;139;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_edge1 "/root/repo/_verify_build/test/autopilot" "edge-start.sav" "edge-battle-before-actual.sav" "edge-battle-before.sav" "835")
+set_tests_properties(sav_edge1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;142;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_edge2 "/root/repo/_verify_build/test/autopilot" "edge-start.sav" "edge-battle-start-actual.sav" "edge-battle-start.sav" "1278")
+set_tests_properties(sav_edge2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;143;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_edge3 "/root/repo/_verify_build/test/autopilot" "edge-start.sav" "edge-battle-during-actual.sav" "edge-battle-during.sav" "1513")
+set_tests_properties(sav_edge3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;144;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_edge4 "/root/repo/_verify_build/test/autopilot" "edge-start.sav" "edge-battle-after-actual.sav" "edge-battle-after.sav" "1890")
+set_tests_properties(sav_edge4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;145;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_massilia1 "/root/repo/_verify_build/test/autopilot" "brugle-massilia-start.sav" "brugle-massilia-1-actual.sav" "brugle-massilia-1.sav" "4")
+set_tests_properties(sav_massilia1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;148;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_massilia2 "/root/repo/_verify_build/test/autopilot" "brugle-massilia-start.sav" "brugle-massilia-2-actual.sav" "brugle-massilia-2.sav" "57")
+set_tests_properties(sav_massilia2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;149;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_massilia3 "/root/repo/_verify_build/test/autopilot" "brugle-massilia-start.sav" "brugle-massilia-3-actual.sav" "brugle-massilia-3.sav" "391")
+set_tests_properties(sav_massilia3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;150;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_valentia1 "/root/repo/_verify_build/test/autopilot" "valentia57.sav" "valentia57-after-actual.sav" "valentia57-after.sav" "1026")
+set_tests_properties(sav_valentia1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;152;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_lugdunum1 "/root/repo/_verify_build/test/autopilot" "brugle-lugdunum.sav" "brugle-lugdunum-after-actual.sav" "brugle-lugdunum-after.sav" "1176")
+set_tests_properties(sav_lugdunum1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;153;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_native1 "/root/repo/_verify_build/test/autopilot" "brugle-lugdunum-native.sav" "brugle-lugdunum-native-after-actual.sav" "brugle-lugdunum-native-after.sav" "1678")
+set_tests_properties(sav_native1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;155;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_native2 "/root/repo/_verify_build/test/autopilot" "cicero-lugdunum-trade.sav" "cicero-lugdunum-trade-after-actual.sav" "cicero-lugdunum-trade-after.sav" "926")
+set_tests_properties(sav_native2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;156;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_palace1 "/root/repo/_verify_build/test/autopilot" "brugle-palacepeaks.sav" "brugle-palacepeaks-2-actual.sav" "brugle-palacepeaks-2.sav" "2562")
+set_tests_properties(sav_palace1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;158;add_integration_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_threads_tower "/root/repo/_verify_build/test/autopilot" "--figure-threads" "4" "--min-figures-per-thread" "1" "tower.sav" "tower2-threads.sav" "tower2.sav" "1785")
+set_tests_properties(sav_threads_tower PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;83;add_test;/root/repo/test/CMakeLists.txt;161;add_figure_threads_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_threads_earthquake "/root/repo/_verify_build/test/autopilot" "--figure-threads" "4" "--min-figures-per-thread" "1" "earthquake.sav" "earthquake-after-threads.sav" "earthquake-after.sav" "3748")
+set_tests_properties(sav_threads_earthquake PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;83;add_test;/root/repo/test/CMakeLists.txt;162;add_figure_threads_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sav_threads_lugdunum1 "/root/repo/_verify_build/test/autopilot" "--figure-threads" "4" "--min-figures-per-thread" "1" "brugle-lugdunum.sav" "brugle-lugdunum-after-threads.sav" "brugle-lugdunum-after.sav" "1176")
+set_tests_properties(sav_threads_lugdunum1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;83;add_test;/root/repo/test/CMakeLists.txt;163;add_figure_threads_test;/root/repo/test/CMakeLists.txt;0;")
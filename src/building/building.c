@@ -1,11 +1,13 @@
 #include "building.h"
 
 #include "building/building_state.h"
+#include "building/count.h"
 #include "building/properties.h"
 #include "building/storage.h"
 #include "city/buildings.h"
 #include "city/population.h"
 #include "city/warning.h"
+#include "core/log.h"
 #include "figure/formation_legion.h"
 #include "game/resource.h"
 #include "game/undo.h"
@@ -13,15 +15,41 @@
 #include "map/desirability.h"
 #include "map/elevation.h"
 #include "map/grid.h"
+#include "map/house_service.h"
 #include "map/random.h"
 #include "map/routing_terrain.h"
 #include "map/terrain.h"
 #include "map/tiles.h"
+#include "map/water_supply.h"
 
 #include <string.h>
 
+#define INDEX_BITS 32
+#define INDEX_WORDS ((MAX_BUILDINGS + INDEX_BITS - 1) / INDEX_BITS)
+
 static building all_buildings[MAX_BUILDINGS];
 
+/**
+ * Per building type, the bit set of ids of buildings of that type that are not unused.
+ * The type of a building is only set by building_create(), building_change_type(),
+ * undo and loading.
+ */
+static uint32_t type_index[BUILDING_TYPE_MAX][INDEX_WORDS];
+
+/**
+ * The houses and vacant lots from the type index as a table in order of id, with the
+ * house level of each row in a separate column. The table is built again when a house
+ * was added or removed; a house that changes level keeps its row and gets the level
+ * of its new type, which the house code also sets as its subtype.
+ */
+static struct {
+    int is_valid;
+    int num_houses;
+    int ids[MAX_BUILDINGS];
+    int16_t levels[MAX_BUILDINGS];
+    int row[MAX_BUILDINGS];
+} house_table;
+
 static struct {
     int highest_id_in_use;
     int highest_id_ever;
@@ -30,6 +58,73 @@ static struct {
     int unfixable_houses;
 } extra = {0, 0, 0, 0};
 
+static void add_to_index(const building *b)
+{
+    if (b->type > BUILDING_NONE && b->type < BUILDING_TYPE_MAX) {
+        type_index[b->type][b->id / INDEX_BITS] |= 1u << (b->id % INDEX_BITS);
+        if (building_is_house(b->type)) {
+            house_table.is_valid = 0;
+        }
+    }
+}
+
+static void remove_from_index(const building *b)
+{
+    if (b->type > BUILDING_NONE && b->type < BUILDING_TYPE_MAX) {
+        type_index[b->type][b->id / INDEX_BITS] &= ~(1u << (b->id % INDEX_BITS));
+        if (building_is_house(b->type)) {
+            house_table.is_valid = 0;
+        }
+    }
+}
+
+static void rebuild_index(void)
+{
+    memset(type_index, 0, sizeof(type_index));
+    house_table.is_valid = 0;
+    for (int i = 1; i < MAX_BUILDINGS; i++) {
+        if (all_buildings[i].state != BUILDING_STATE_UNUSED) {
+            add_to_index(&all_buildings[i]);
+        }
+    }
+}
+
+#ifdef VERIFY_INCREMENTAL
+static void verify_index(void)
+{
+    int mismatches = 0;
+    for (int i = 1; i < MAX_BUILDINGS; i++) {
+        const building *b = &all_buildings[i];
+        for (int type = BUILDING_NONE + 1; type < BUILDING_TYPE_MAX; type++) {
+            int expected = b->state != BUILDING_STATE_UNUSED && b->type == type;
+            if (expected != ((type_index[type][i / INDEX_BITS] >> (i % INDEX_BITS)) & 1)) {
+                mismatches++;
+            }
+        }
+    }
+    if (mismatches) {
+        log_error("Building type index differs from buildings:", 0, mismatches);
+    }
+    if (house_table.is_valid) {
+        int row = 0;
+        for (int i = 1; i < MAX_BUILDINGS; i++) {
+            const building *b = &all_buildings[i];
+            if (b->state == BUILDING_STATE_UNUSED || !building_is_house(b->type)) {
+                continue;
+            }
+            if (row >= house_table.num_houses || house_table.ids[row] != i ||
+                house_table.levels[row] != b->subtype.house_level) {
+                mismatches++;
+            }
+            row++;
+        }
+        if (mismatches || row != house_table.num_houses) {
+            log_error("House table differs from buildings:", 0, mismatches);
+        }
+    }
+}
+#endif
+
 building *building_get(int id)
 {
     return &all_buildings[id];
@@ -89,7 +184,12 @@ building *building_create(building_type type, int x, int y)
     } else if (type >= BUILDING_HOUSE_LARGE_PALACE && type <= BUILDING_HOUSE_LUXURY_PALACE) {
         b->house_size = 4;
     }
+    if (b->house_size) {
+        map_house_service_clear();
+    }
     
+    add_to_index(b);
+
     // subtype
     if (building_is_house(type)) {
         b->subtype.house_level = type - BUILDING_HOUSE_VACANT_LOT;
@@ -177,9 +277,11 @@ building *building_create(building_type type, int x, int y)
 static void building_delete(building *b)
 {
     building_clear_related_data(b);
+    remove_from_index(b);
     int id = b->id;
     memset(b, 0, sizeof(building));
     b->id = id;
+    building_count_building_changed(id);
 }
 
 void building_clear_related_data(building *b)
@@ -217,6 +319,8 @@ void building_update_state(void)
         building *b = &all_buildings[i];
         if (b->state == BUILDING_STATE_CREATED) {
             b->state = BUILDING_STATE_IN_USE;
+            map_water_supply_building_changed(i);
+            building_count_building_changed(i);
         }
         if (b->state != BUILDING_STATE_IN_USE || !b->house_size) {
             if (b->state == BUILDING_STATE_UNDO || b->state == BUILDING_STATE_DELETED_BY_PLAYER) {
@@ -258,6 +362,9 @@ void building_update_state(void)
     if (road_recalc) {
         map_tiles_update_all_roads();
     }
+#ifdef VERIFY_INCREMENTAL
+    verify_index();
+#endif
 }
 
 void building_update_desirability(void)
@@ -287,6 +394,115 @@ int building_is_house(building_type type)
     return type >= BUILDING_HOUSE_VACANT_LOT && type <= BUILDING_HOUSE_LUXURY_PALACE;
 }
 
+void building_change_type(building *b, building_type type)
+{
+    int keeps_row = house_table.is_valid && b->state != BUILDING_STATE_UNUSED &&
+        building_is_house(b->type) && building_is_house(type);
+    remove_from_index(b);
+    b->type = type;
+    add_to_index(b);
+    building_count_building_changed(b->id);
+    if (keeps_row) {
+        house_table.levels[house_table.row[b->id]] = type - BUILDING_HOUSE_VACANT_LOT;
+        house_table.is_valid = 1;
+    }
+}
+
+void building_add_to_index(building *b)
+{
+    if (b->state != BUILDING_STATE_UNUSED) {
+        add_to_index(b);
+    }
+}
+
+static int next_id_in_bits(int id, uint32_t bits)
+{
+    while (!(bits & 1)) {
+        bits >>= 1;
+        id++;
+    }
+    return id < MAX_BUILDINGS ? id : 0;
+}
+
+int building_next_of_types(int id, const building_type *types, int num_types)
+{
+    for (id++; id < MAX_BUILDINGS; id = (id | (INDEX_BITS - 1)) + 1) {
+        uint32_t bits = 0;
+        for (int i = 0; i < num_types; i++) {
+            bits |= type_index[types[i]][id / INDEX_BITS];
+        }
+        bits >>= id % INDEX_BITS;
+        if (bits) {
+            return next_id_in_bits(id, bits);
+        }
+    }
+    return 0;
+}
+
+static int next_house_in_index(int id)
+{
+    for (id++; id < MAX_BUILDINGS; id = (id | (INDEX_BITS - 1)) + 1) {
+        uint32_t bits = 0;
+        for (int type = BUILDING_HOUSE_VACANT_LOT; type <= BUILDING_HOUSE_LUXURY_PALACE; type++) {
+            bits |= type_index[type][id / INDEX_BITS];
+        }
+        bits >>= id % INDEX_BITS;
+        if (bits) {
+            return next_id_in_bits(id, bits);
+        }
+    }
+    return 0;
+}
+
+static void build_house_table(void)
+{
+    house_table.num_houses = 0;
+    for (int i = next_house_in_index(0); i; i = next_house_in_index(i)) {
+        int row = house_table.num_houses++;
+        house_table.ids[row] = i;
+        house_table.levels[row] = all_buildings[i].subtype.house_level;
+        house_table.row[i] = row;
+    }
+    house_table.is_valid = 1;
+}
+
+int building_house_table(const int **ids, const int16_t **levels)
+{
+    if (!house_table.is_valid) {
+        build_house_table();
+    }
+    *ids = house_table.ids;
+    if (levels) {
+        *levels = house_table.levels;
+    }
+    return house_table.num_houses;
+}
+
+int building_next_house_id(int id)
+{
+    if (!house_table.is_valid) {
+        build_house_table();
+    }
+    int row = house_table.row[id];
+    if (id > 0 && row < house_table.num_houses && house_table.ids[row] == id) {
+        row++;
+    } else {
+        // the building is not in the table (anymore): find the first house after it
+        int low = 0;
+        int high = house_table.num_houses;
+        while (low < high) {
+            int middle = (low + high) / 2;
+            if (house_table.ids[middle] <= id) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        row = low;
+    }
+    return row < house_table.num_houses ? house_table.ids[row] : 0;
+}
+
 int building_get_highest_id(void)
 {
     return extra.highest_id_in_use;
@@ -319,11 +535,14 @@ void building_clear_all(void)
         memset(&all_buildings[i], 0, sizeof(building));
         all_buildings[i].id = i;
     }
+    memset(type_index, 0, sizeof(type_index));
+    house_table.is_valid = 0;
     extra.highest_id_in_use = 0;
     extra.highest_id_ever = 0;
     extra.created_sequence = 0;
     extra.incorrect_houses = 0;
     extra.unfixable_houses = 0;
+    building_count_rebuild();
 }
 
 void building_save_state(buffer *buf, buffer *highest_id, buffer *highest_id_ever,
@@ -348,6 +567,8 @@ void building_load_state(buffer *buf, buffer *highest_id, buffer *highest_id_eve
         building_state_load_from_buffer(buf, &all_buildings[i]);
         all_buildings[i].id = i;
     }
+    rebuild_index();
+    building_count_rebuild();
     extra.highest_id_in_use = buffer_read_i32(highest_id);
     extra.highest_id_ever = buffer_read_i32(highest_id_ever);
     buffer_skip(highest_id_ever, 4);
@@ -156,6 +156,47 @@ void building_update_desirability(void);
 
 int building_is_house(building_type type);
 
+/**
+ * Changes the type of an existing building
+ * @param b Building
+ * @param type New type
+ */
+void building_change_type(building *b, building_type type);
+
+/**
+ * Adds a building that was copied into place, for example by undo, to the index of its type
+ */
+void building_add_to_index(building *b);
+
+/**
+ * Returns the next building after the given one, in order of id, that has one of the
+ * given types. Unused buildings are never returned, but callers still need to check
+ * whether the building is in use.
+ * @param id Building id to start after, 0 for the first building
+ * @param types Building types
+ * @param num_types Number of building types
+ * @return Building id, or 0 if there are no more buildings
+ */
+int building_next_of_types(int id, const building_type *types, int num_types);
+
+/**
+ * Returns the next house or vacant lot after the given one, in order of id.
+ * Callers still need to check the state and type as before.
+ * @param id Building id to start after, 0 for the first house
+ * @return Building id, or 0 if there are no more houses
+ */
+int building_next_house_id(int id);
+
+/**
+ * Returns the houses and vacant lots as a table in order of id. The table stays valid until
+ * a house is created or removed, so passes that may do that have to use building_next_house_id().
+ * Callers still need to check the state as before.
+ * @param ids Set to the building id column
+ * @param levels Set to the house level column, may be null
+ * @return Number of rows
+ */
+int building_house_table(const int **ids, const int16_t **levels);
+
 int building_get_highest_id(void);
 
 void building_update_highest_id(void);
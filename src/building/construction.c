@@ -18,6 +18,7 @@
 #include "core/image.h"
 #include "core/time.h"
 #include "figure/formation.h"
+#include "game/replay.h"
 #include "game/undo.h"
 #include "graphics/window.h"
 #include "map/aqueduct.h"
@@ -347,6 +348,7 @@ void building_construction_start(int x, int y, int grid_offset)
     data.start.x = data.end.x = x;
     data.start.y = data.end.y = y;
 
+    map_routing_clear_building_distances();
     if (game_undo_start_build(data.type)) {
         data.in_progress = 1;
         switch (data.type) {
@@ -526,6 +528,7 @@ void building_construction_place(void)
     if (!type) {
         return;
     }
+    game_replay_record_build(type, x_start, y_start, x_end, y_end);
     if (city_finance_out_of_money()) {
         map_property_clear_constructing_and_deleted();
         city_warning_show(WARNING_OUT_OF_MONEY);
@@ -1,6 +1,7 @@
 #include "construction_clear.h"
 
 #include "building/building.h"
+#include "building/count.h"
 #include "city/warning.h"
 #include "core/config.h"
 #include "figuretype/migrant.h"
@@ -107,6 +108,7 @@ static int clear_land_confirmed(int measure_only, int x_start, int y_start, int
                 }
                 b->state = BUILDING_STATE_DELETED_BY_PLAYER;
                 b->is_deleted = 1;
+                building_count_building_changed(b->id);
                 building *space = b;
                 for (int i = 0; i < 9; i++) {
                     if (space->prev_part_building_id <= 0) {
@@ -115,6 +117,7 @@ static int clear_land_confirmed(int measure_only, int x_start, int y_start, int
                     space = building_get(space->prev_part_building_id);
                     game_undo_add_building(space);
                     space->state = BUILDING_STATE_DELETED_BY_PLAYER;
+                    building_count_building_changed(space->id);
                 }
                 space = b;
                 for (int i = 0; i < 9; i++) {
@@ -124,6 +127,7 @@ static int clear_land_confirmed(int measure_only, int x_start, int y_start, int
                     }
                     game_undo_add_building(space);
                     space->state = BUILDING_STATE_DELETED_BY_PLAYER;
+                    building_count_building_changed(space->id);
                 }
             } else if (map_terrain_is(grid_offset, TERRAIN_AQUEDUCT)) {
                 map_terrain_remove(grid_offset, TERRAIN_CLEARABLE);
@@ -3,57 +3,277 @@
 #include "building/building.h"
 #include "city/buildings.h"
 #include "city/health.h"
+#include "core/log.h"
 #include "figure/figure.h"
 
 #include <string.h>
 
+#define MAX_WORKING_DOCKS 10
+
+/**
+ * The types that need more than a count on the daily update
+ */
+static const building_type VISITED_TYPES[] = {
+    BUILDING_THEATER, BUILDING_AMPHITHEATER, BUILDING_COLOSSEUM, BUILDING_HIPPODROME,
+    BUILDING_BARRACKS, BUILDING_HOSPITAL, BUILDING_WHARF, BUILDING_DOCK
+};
+
+#define NUM_VISITED_TYPES (sizeof(VISITED_TYPES) / sizeof(building_type))
+
 struct record {
     int active;
     int total;
 };
 
-static struct {
+struct counts {
     struct record buildings[BUILDING_TYPE_MAX];
     struct record industry[RESOURCE_MAX];
+};
+
+struct side_effects {
+    int barracks_id;
+    int hospital_workers;
+    int working_wharfs;
+    int wharfs_needing_boat;
+    int working_docks;
+    int working_dock_ids[MAX_WORKING_DOCKS];
+};
+
+struct contribution {
+    struct record *record;
+    int active;
+};
+
+/**
+ * The live counts follow every building change, the published counts are a copy of
+ * the live counts taken on the daily update: they are the ones read by the advisors
+ * and stored in saved games.
+ */
+static struct {
+    struct counts published;
+    struct counts live;
+    struct contribution contributions[MAX_BUILDINGS];
 } data;
 
-static void clear_counters(void)
+static void limit_hippodrome(struct counts *counts)
 {
-    memset(&data, 0, sizeof(data));
+    if (counts->buildings[BUILDING_HIPPODROME].total > 1) {
+        counts->buildings[BUILDING_HIPPODROME].total = 1;
+    }
+    if (counts->buildings[BUILDING_HIPPODROME].active > 1) {
+        counts->buildings[BUILDING_HIPPODROME].active = 1;
+    }
 }
 
-static void increase_count(building_type type, int active)
+static struct record *get_record(struct counts *counts, const building *b)
 {
-    ++data.buildings[type].total;
-    if (active) {
-        ++data.buildings[type].active;
+    if (b->state != BUILDING_STATE_IN_USE || b->house_size) {
+        return 0;
+    }
+    switch (b->type) {
+        case BUILDING_THEATER:
+        case BUILDING_AMPHITHEATER:
+        case BUILDING_COLOSSEUM:
+        case BUILDING_HIPPODROME:
+        case BUILDING_BARRACKS:
+        case BUILDING_HOSPITAL:
+        case BUILDING_RESERVOIR:
+        case BUILDING_FOUNTAIN:
+        case BUILDING_SCHOOL:
+        case BUILDING_LIBRARY:
+        case BUILDING_ACADEMY:
+        case BUILDING_BARBER:
+        case BUILDING_BATHHOUSE:
+        case BUILDING_DOCTOR:
+        case BUILDING_FORUM:
+        case BUILDING_FORUM_UPGRADED:
+        case BUILDING_SENATE:
+        case BUILDING_SENATE_UPGRADED:
+        case BUILDING_ACTOR_COLONY:
+        case BUILDING_GLADIATOR_SCHOOL:
+        case BUILDING_LION_HOUSE:
+        case BUILDING_CHARIOT_MAKER:
+        case BUILDING_MARKET:
+        case BUILDING_MILITARY_ACADEMY:
+        case BUILDING_SMALL_TEMPLE_CERES:
+        case BUILDING_SMALL_TEMPLE_NEPTUNE:
+        case BUILDING_SMALL_TEMPLE_MERCURY:
+        case BUILDING_SMALL_TEMPLE_MARS:
+        case BUILDING_SMALL_TEMPLE_VENUS:
+        case BUILDING_LARGE_TEMPLE_CERES:
+        case BUILDING_LARGE_TEMPLE_NEPTUNE:
+        case BUILDING_LARGE_TEMPLE_MERCURY:
+        case BUILDING_LARGE_TEMPLE_MARS:
+        case BUILDING_LARGE_TEMPLE_VENUS:
+        case BUILDING_ORACLE:
+            return &counts->buildings[b->type];
+        case BUILDING_WHEAT_FARM: return &counts->industry[RESOURCE_WHEAT];
+        case BUILDING_VEGETABLE_FARM: return &counts->industry[RESOURCE_VEGETABLES];
+        case BUILDING_FRUIT_FARM: return &counts->industry[RESOURCE_FRUIT];
+        case BUILDING_OLIVE_FARM: return &counts->industry[RESOURCE_OLIVES];
+        case BUILDING_VINES_FARM: return &counts->industry[RESOURCE_VINES];
+        case BUILDING_PIG_FARM: return &counts->industry[RESOURCE_MEAT];
+        case BUILDING_MARBLE_QUARRY: return &counts->industry[RESOURCE_MARBLE];
+        case BUILDING_IRON_MINE: return &counts->industry[RESOURCE_IRON];
+        case BUILDING_TIMBER_YARD: return &counts->industry[RESOURCE_TIMBER];
+        case BUILDING_CLAY_PIT: return &counts->industry[RESOURCE_CLAY];
+        case BUILDING_WINE_WORKSHOP: return &counts->industry[RESOURCE_WINE];
+        case BUILDING_OIL_WORKSHOP: return &counts->industry[RESOURCE_OIL];
+        case BUILDING_WEAPONS_WORKSHOP: return &counts->industry[RESOURCE_WEAPONS];
+        case BUILDING_FURNITURE_WORKSHOP: return &counts->industry[RESOURCE_FURNITURE];
+        case BUILDING_POTTERY_WORKSHOP: return &counts->industry[RESOURCE_POTTERY];
+        default:
+            return 0;
     }
 }
 
-static void increase_industry_count(resource_type resource, int active)
+static int is_active(const building *b)
 {
-    ++data.industry[resource].total;
-    if (active) {
-        ++data.industry[resource].active;
+    if (b->type == BUILDING_RESERVOIR || b->type == BUILDING_FOUNTAIN) {
+        return b->has_water_access != 0;
     }
+    return b->num_workers > 0;
 }
 
-static void limit_hippodrome(void)
+void building_count_building_changed(int building_id)
 {
-    if (data.buildings[BUILDING_HIPPODROME].total > 1) {
-        data.buildings[BUILDING_HIPPODROME].total = 1;
+    const building *b = building_get(building_id);
+    struct contribution *c = &data.contributions[building_id];
+    struct record *record = get_record(&data.live, b);
+    int active = record && is_active(b);
+    if (record == c->record && active == c->active) {
+        return;
+    }
+    if (c->record) {
+        c->record->total--;
+        c->record->active -= c->active;
     }
-    if (data.buildings[BUILDING_HIPPODROME].active > 1) {
-        data.buildings[BUILDING_HIPPODROME].active = 1;
+    if (record) {
+        record->total++;
+        record->active += active;
     }
+    c->record = record;
+    c->active = active;
 }
 
-void building_count_update(void)
+void building_count_rebuild(void)
+{
+    memset(&data.live, 0, sizeof(data.live));
+    memset(data.contributions, 0, sizeof(data.contributions));
+    for (int i = 1; i < MAX_BUILDINGS; i++) {
+        building_count_building_changed(i);
+    }
+}
+
+static void clear_immigrant(building *b)
+{
+    if (b->immigrant_figure_id) {
+        figure *f = figure_get(b->immigrant_figure_id);
+        if (f->state != FIGURE_STATE_ALIVE || f->destination_building_id != b->id) {
+            b->immigrant_figure_id = 0;
+        }
+    }
+}
+
+static void update_shows(building *b)
+{
+    int shows = 0;
+    if (b->data.entertainment.days1 > 0) {
+        --b->data.entertainment.days1;
+        ++shows;
+    }
+    if (b->data.entertainment.days2 > 0) {
+        --b->data.entertainment.days2;
+        ++shows;
+    }
+    b->data.entertainment.num_shows = shows;
+}
+
+static void add_working_dock(struct side_effects *effects, int building_id)
+{
+    if (effects->working_docks < MAX_WORKING_DOCKS) {
+        effects->working_dock_ids[effects->working_docks] = building_id;
+    }
+    effects->working_docks++;
+}
+
+/**
+ * Visits the buildings that need more than a count, in order of id because the
+ * dock list and the barracks depend on it. Immigrants only ever go to houses, so the
+ * immigrant id is only checked on the buildings that are visited anyway.
+ */
+static void visit_buildings(struct side_effects *effects)
+{
+    for (int i = building_next_of_types(0, VISITED_TYPES, NUM_VISITED_TYPES); i;
+        i = building_next_of_types(i, VISITED_TYPES, NUM_VISITED_TYPES)) {
+        building *b = building_get(i);
+        if (b->state != BUILDING_STATE_IN_USE || b->house_size) {
+            continue;
+        }
+        switch (b->type) {
+            case BUILDING_THEATER:
+            case BUILDING_AMPHITHEATER:
+            case BUILDING_COLOSSEUM:
+            case BUILDING_HIPPODROME:
+                update_shows(b);
+                break;
+            case BUILDING_BARRACKS:
+                effects->barracks_id = i;
+                break;
+            case BUILDING_HOSPITAL:
+                effects->hospital_workers += b->num_workers;
+                break;
+            case BUILDING_WHARF:
+                if (b->num_workers > 0) {
+                    effects->working_wharfs++;
+                    effects->wharfs_needing_boat += !b->data.industry.fishing_boat_id;
+                }
+                break;
+            case BUILDING_DOCK:
+                if (b->num_workers > 0 && b->has_water_access) {
+                    add_working_dock(effects, i);
+                }
+                break;
+            default:
+                break;
+        }
+        clear_immigrant(b);
+    }
+}
+
+static void apply_side_effects(const struct side_effects *effects)
 {
-    clear_counters();
     city_buildings_reset_dock_wharf_counters();
     city_health_reset_hospital_workers();
+    if (effects->barracks_id) {
+        city_buildings_set_barracks(effects->barracks_id);
+    }
+    city_health_add_hospital_workers(effects->hospital_workers);
+    for (int i = 0; i < effects->working_wharfs; i++) {
+        city_buildings_add_working_wharf(i < effects->wharfs_needing_boat);
+    }
+    for (int i = 0; i < effects->working_docks; i++) {
+        city_buildings_add_working_dock(i < MAX_WORKING_DOCKS ? effects->working_dock_ids[i] : 0);
+    }
+}
 
+#ifdef VERIFY_INCREMENTAL
+static void increase_count(struct record *record, int active)
+{
+    ++record->total;
+    if (active) {
+        ++record->active;
+    }
+}
+
+/**
+ * The daily update as it was before the counts were kept up to date: every building
+ * slot is visited and counted from scratch.
+ */
+static void count_all_buildings(struct counts *counts, struct side_effects *effects)
+{
+    memset(counts, 0, sizeof(struct counts));
+    memset(effects, 0, sizeof(struct side_effects));
     for (int i = 1; i < MAX_BUILDINGS; i++) {
         building *b = building_get(i);
         if (b->state != BUILDING_STATE_IN_USE || b->house_size) {
@@ -62,56 +282,41 @@ void building_count_update(void)
         int is_entertainment_venue = 0;
         int type = b->type;
         switch (type) {
-            // SPECIAL TREATMENT
-            // entertainment venues
             case BUILDING_THEATER:
             case BUILDING_AMPHITHEATER:
             case BUILDING_COLOSSEUM:
             case BUILDING_HIPPODROME:
                 is_entertainment_venue = 1;
-                increase_count(type, b->num_workers > 0);
+                increase_count(&counts->buildings[type], b->num_workers > 0);
                 break;
-
             case BUILDING_BARRACKS:
-                city_buildings_set_barracks(i);
-                increase_count(type, b->num_workers > 0);
+                effects->barracks_id = i;
+                increase_count(&counts->buildings[type], b->num_workers > 0);
                 break;
-
             case BUILDING_HOSPITAL:
-                increase_count(type, b->num_workers > 0);
-                city_health_add_hospital_workers(b->num_workers);
+                increase_count(&counts->buildings[type], b->num_workers > 0);
+                effects->hospital_workers += b->num_workers;
                 break;
-            
-            // water
             case BUILDING_RESERVOIR:
             case BUILDING_FOUNTAIN:
-                increase_count(type, b->has_water_access);
+                increase_count(&counts->buildings[type], b->has_water_access);
                 break;
-
-            // DEFAULT TREATMENT
-            // education
             case BUILDING_SCHOOL:
             case BUILDING_LIBRARY:
             case BUILDING_ACADEMY:
-            // health
             case BUILDING_BARBER:
             case BUILDING_BATHHOUSE:
             case BUILDING_DOCTOR:
-            // government
             case BUILDING_FORUM:
             case BUILDING_FORUM_UPGRADED:
             case BUILDING_SENATE:
             case BUILDING_SENATE_UPGRADED:
-            // entertainment schools
             case BUILDING_ACTOR_COLONY:
             case BUILDING_GLADIATOR_SCHOOL:
             case BUILDING_LION_HOUSE:
             case BUILDING_CHARIOT_MAKER:
-            // distribution
             case BUILDING_MARKET:
-            // military
             case BUILDING_MILITARY_ACADEMY:
-            // religion
             case BUILDING_SMALL_TEMPLE_CERES:
             case BUILDING_SMALL_TEMPLE_NEPTUNE:
             case BUILDING_SMALL_TEMPLE_MERCURY:
@@ -123,111 +328,156 @@ void building_count_update(void)
             case BUILDING_LARGE_TEMPLE_MARS:
             case BUILDING_LARGE_TEMPLE_VENUS:
             case BUILDING_ORACLE:
-                increase_count(type, b->num_workers > 0);
+                increase_count(&counts->buildings[type], b->num_workers > 0);
                 break;
-
-            // industry
             case BUILDING_WHEAT_FARM:
-                increase_industry_count(RESOURCE_WHEAT, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_WHEAT], b->num_workers > 0);
                 break;
             case BUILDING_VEGETABLE_FARM:
-                increase_industry_count(RESOURCE_VEGETABLES, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_VEGETABLES], b->num_workers > 0);
                 break;
             case BUILDING_FRUIT_FARM:
-                increase_industry_count(RESOURCE_FRUIT, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_FRUIT], b->num_workers > 0);
                 break;
             case BUILDING_OLIVE_FARM:
-                increase_industry_count(RESOURCE_OLIVES, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_OLIVES], b->num_workers > 0);
                 break;
             case BUILDING_VINES_FARM:
-                increase_industry_count(RESOURCE_VINES, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_VINES], b->num_workers > 0);
                 break;
             case BUILDING_PIG_FARM:
-                increase_industry_count(RESOURCE_MEAT, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_MEAT], b->num_workers > 0);
                 break;
             case BUILDING_MARBLE_QUARRY:
-                increase_industry_count(RESOURCE_MARBLE, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_MARBLE], b->num_workers > 0);
                 break;
             case BUILDING_IRON_MINE:
-                increase_industry_count(RESOURCE_IRON, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_IRON], b->num_workers > 0);
                 break;
             case BUILDING_TIMBER_YARD:
-                increase_industry_count(RESOURCE_TIMBER, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_TIMBER], b->num_workers > 0);
                 break;
             case BUILDING_CLAY_PIT:
-                increase_industry_count(RESOURCE_CLAY, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_CLAY], b->num_workers > 0);
                 break;
             case BUILDING_WINE_WORKSHOP:
-                increase_industry_count(RESOURCE_WINE, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_WINE], b->num_workers > 0);
                 break;
             case BUILDING_OIL_WORKSHOP:
-                increase_industry_count(RESOURCE_OIL, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_OIL], b->num_workers > 0);
                 break;
             case BUILDING_WEAPONS_WORKSHOP:
-                increase_industry_count(RESOURCE_WEAPONS, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_WEAPONS], b->num_workers > 0);
                 break;
             case BUILDING_FURNITURE_WORKSHOP:
-                increase_industry_count(RESOURCE_FURNITURE, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_FURNITURE], b->num_workers > 0);
                 break;
             case BUILDING_POTTERY_WORKSHOP:
-                increase_industry_count(RESOURCE_POTTERY, b->num_workers > 0);
+                increase_count(&counts->industry[RESOURCE_POTTERY], b->num_workers > 0);
                 break;
-
-            // water-side
             case BUILDING_WHARF:
                 if (b->num_workers > 0) {
-                    city_buildings_add_working_wharf(!b->data.industry.fishing_boat_id);
+                    effects->working_wharfs++;
+                    effects->wharfs_needing_boat += !b->data.industry.fishing_boat_id;
                 }
                 break;
             case BUILDING_DOCK:
                 if (b->num_workers > 0 && b->has_water_access) {
-                    city_buildings_add_working_dock(i);
+                    add_working_dock(effects, i);
                 }
                 break;
             default:
                 continue;
         }
-        if (b->immigrant_figure_id) {
-            figure *f = figure_get(b->immigrant_figure_id);
-            if (f->state != FIGURE_STATE_ALIVE || f->destination_building_id != i) {
-                b->immigrant_figure_id = 0;
-            }
-        }
+        clear_immigrant(b);
         if (is_entertainment_venue) {
-            // update number of shows
-            int shows = 0;
-            if (b->data.entertainment.days1 > 0) {
-                --b->data.entertainment.days1;
-                ++shows;
-            }
-            if (b->data.entertainment.days2 > 0) {
-                --b->data.entertainment.days2;
-                ++shows;
-            }
-            b->data.entertainment.num_shows = shows;
+            update_shows(b);
         }
     }
-    limit_hippodrome();
+    limit_hippodrome(counts);
+}
+
+static struct {
+    building before[MAX_BUILDINGS];
+    building after[MAX_BUILDINGS];
+} verify;
+
+static void save_buildings(void)
+{
+    for (int i = 0; i < MAX_BUILDINGS; i++) {
+        verify.before[i] = *building_get(i);
+    }
+}
+
+/**
+ * Runs the original daily update again on the buildings as they were before the
+ * update, and compares the counts, the side effects and the buildings afterwards
+ */
+static void verify_counts(const struct side_effects *effects)
+{
+    struct counts expected_counts;
+    struct side_effects expected_effects;
+    for (int i = 0; i < MAX_BUILDINGS; i++) {
+        verify.after[i] = *building_get(i);
+        *building_get(i) = verify.before[i];
+    }
+    count_all_buildings(&expected_counts, &expected_effects);
+    int differences = 0;
+    for (int i = 0; i < MAX_BUILDINGS; i++) {
+        if (memcmp(building_get(i), &verify.after[i], sizeof(building)) != 0) {
+            differences++;
+        }
+    }
+    if (memcmp(&expected_counts, &data.published, sizeof(struct counts)) != 0) {
+        differences++;
+    }
+    if (memcmp(&expected_effects, effects, sizeof(struct side_effects)) != 0) {
+        differences++;
+    }
+    if (differences) {
+        log_error("Building counts differ from full count:", 0, differences);
+    }
+}
+#endif
+
+/**
+ * Publishes the counts and does the work on the side that needs the buildings
+ * themselves; the counts are kept up to date by building_count_building_changed()
+ */
+void building_count_update(void)
+{
+#ifdef VERIFY_INCREMENTAL
+    save_buildings();
+#endif
+    struct side_effects effects;
+    memset(&effects, 0, sizeof(effects));
+    data.published = data.live;
+    limit_hippodrome(&data.published);
+    visit_buildings(&effects);
+#ifdef VERIFY_INCREMENTAL
+    verify_counts(&effects);
+#endif
+    apply_side_effects(&effects);
 }
 
 int building_count_active(building_type type)
 {
-    return data.buildings[type].active;
+    return data.published.buildings[type].active;
 }
 
 int building_count_total(building_type type)
 {
-    return data.buildings[type].total;
+    return data.published.buildings[type].total;
 }
 
 int building_count_industry_active(resource_type resource)
 {
-    return data.industry[resource].active;
+    return data.published.industry[resource].active;
 }
 
 int building_count_industry_total(resource_type resource)
 {
-    return data.industry[resource].total;
+    return data.published.industry[resource].total;
 }
 
 
@@ -236,82 +486,82 @@ void building_count_save_state(buffer *industry, buffer *culture1, buffer *cultu
 {
     // industry
     for (int i = 0; i < RESOURCE_MAX; i++) {
-        buffer_write_i32(industry, data.industry[i].total);
+        buffer_write_i32(industry, data.published.industry[i].total);
     }
     for (int i = 0; i < RESOURCE_MAX; i++) {
-        buffer_write_i32(industry, data.industry[i].active);
+        buffer_write_i32(industry, data.published.industry[i].active);
     }
     
     // culture 1
-    buffer_write_i32(culture1, data.buildings[BUILDING_THEATER].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_THEATER].active);
-    buffer_write_i32(culture1, data.buildings[BUILDING_AMPHITHEATER].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_AMPHITHEATER].active);
-    buffer_write_i32(culture1, data.buildings[BUILDING_COLOSSEUM].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_COLOSSEUM].active);
-    buffer_write_i32(culture1, data.buildings[BUILDING_HIPPODROME].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_HIPPODROME].active);
-    buffer_write_i32(culture1, data.buildings[BUILDING_SCHOOL].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_SCHOOL].active);
-    buffer_write_i32(culture1, data.buildings[BUILDING_LIBRARY].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_LIBRARY].active);
-    buffer_write_i32(culture1, data.buildings[BUILDING_ACADEMY].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_ACADEMY].active);
-    buffer_write_i32(culture1, data.buildings[BUILDING_BARBER].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_BARBER].active);
-    buffer_write_i32(culture1, data.buildings[BUILDING_BATHHOUSE].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_BATHHOUSE].active);
-    buffer_write_i32(culture1, data.buildings[BUILDING_DOCTOR].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_DOCTOR].active);
-    buffer_write_i32(culture1, data.buildings[BUILDING_HOSPITAL].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_HOSPITAL].active);
-    buffer_write_i32(culture1, data.buildings[BUILDING_SMALL_TEMPLE_CERES].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_SMALL_TEMPLE_NEPTUNE].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_SMALL_TEMPLE_MERCURY].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_SMALL_TEMPLE_MARS].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_SMALL_TEMPLE_VENUS].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_LARGE_TEMPLE_CERES].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_LARGE_TEMPLE_NEPTUNE].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_LARGE_TEMPLE_MERCURY].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_LARGE_TEMPLE_MARS].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_LARGE_TEMPLE_VENUS].total);
-    buffer_write_i32(culture1, data.buildings[BUILDING_ORACLE].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_THEATER].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_THEATER].active);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_AMPHITHEATER].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_AMPHITHEATER].active);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_COLOSSEUM].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_COLOSSEUM].active);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_HIPPODROME].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_HIPPODROME].active);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_SCHOOL].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_SCHOOL].active);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_LIBRARY].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_LIBRARY].active);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_ACADEMY].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_ACADEMY].active);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_BARBER].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_BARBER].active);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_BATHHOUSE].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_BATHHOUSE].active);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_DOCTOR].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_DOCTOR].active);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_HOSPITAL].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_HOSPITAL].active);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_SMALL_TEMPLE_CERES].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_SMALL_TEMPLE_NEPTUNE].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_SMALL_TEMPLE_MERCURY].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_SMALL_TEMPLE_MARS].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_SMALL_TEMPLE_VENUS].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_LARGE_TEMPLE_CERES].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_LARGE_TEMPLE_NEPTUNE].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_LARGE_TEMPLE_MERCURY].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_LARGE_TEMPLE_MARS].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_LARGE_TEMPLE_VENUS].total);
+    buffer_write_i32(culture1, data.published.buildings[BUILDING_ORACLE].total);
 
     // culture 2
-    buffer_write_i32(culture2, data.buildings[BUILDING_ACTOR_COLONY].total);
-    buffer_write_i32(culture2, data.buildings[BUILDING_ACTOR_COLONY].active);
-    buffer_write_i32(culture2, data.buildings[BUILDING_GLADIATOR_SCHOOL].total);
-    buffer_write_i32(culture2, data.buildings[BUILDING_GLADIATOR_SCHOOL].active);
-    buffer_write_i32(culture2, data.buildings[BUILDING_LION_HOUSE].total);
-    buffer_write_i32(culture2, data.buildings[BUILDING_LION_HOUSE].active);
-    buffer_write_i32(culture2, data.buildings[BUILDING_CHARIOT_MAKER].total);
-    buffer_write_i32(culture2, data.buildings[BUILDING_CHARIOT_MAKER].active);
+    buffer_write_i32(culture2, data.published.buildings[BUILDING_ACTOR_COLONY].total);
+    buffer_write_i32(culture2, data.published.buildings[BUILDING_ACTOR_COLONY].active);
+    buffer_write_i32(culture2, data.published.buildings[BUILDING_GLADIATOR_SCHOOL].total);
+    buffer_write_i32(culture2, data.published.buildings[BUILDING_GLADIATOR_SCHOOL].active);
+    buffer_write_i32(culture2, data.published.buildings[BUILDING_LION_HOUSE].total);
+    buffer_write_i32(culture2, data.published.buildings[BUILDING_LION_HOUSE].active);
+    buffer_write_i32(culture2, data.published.buildings[BUILDING_CHARIOT_MAKER].total);
+    buffer_write_i32(culture2, data.published.buildings[BUILDING_CHARIOT_MAKER].active);
 
     // culture 3
-    buffer_write_i32(culture3, data.buildings[BUILDING_SMALL_TEMPLE_CERES].active);
-    buffer_write_i32(culture3, data.buildings[BUILDING_SMALL_TEMPLE_NEPTUNE].active);
-    buffer_write_i32(culture3, data.buildings[BUILDING_SMALL_TEMPLE_MERCURY].active);
-    buffer_write_i32(culture3, data.buildings[BUILDING_SMALL_TEMPLE_MARS].active);
-    buffer_write_i32(culture3, data.buildings[BUILDING_SMALL_TEMPLE_VENUS].active);
-    buffer_write_i32(culture3, data.buildings[BUILDING_LARGE_TEMPLE_CERES].active);
-    buffer_write_i32(culture3, data.buildings[BUILDING_LARGE_TEMPLE_NEPTUNE].active);
-    buffer_write_i32(culture3, data.buildings[BUILDING_LARGE_TEMPLE_MERCURY].active);
-    buffer_write_i32(culture3, data.buildings[BUILDING_LARGE_TEMPLE_MARS].active);
-    buffer_write_i32(culture3, data.buildings[BUILDING_LARGE_TEMPLE_VENUS].active);
+    buffer_write_i32(culture3, data.published.buildings[BUILDING_SMALL_TEMPLE_CERES].active);
+    buffer_write_i32(culture3, data.published.buildings[BUILDING_SMALL_TEMPLE_NEPTUNE].active);
+    buffer_write_i32(culture3, data.published.buildings[BUILDING_SMALL_TEMPLE_MERCURY].active);
+    buffer_write_i32(culture3, data.published.buildings[BUILDING_SMALL_TEMPLE_MARS].active);
+    buffer_write_i32(culture3, data.published.buildings[BUILDING_SMALL_TEMPLE_VENUS].active);
+    buffer_write_i32(culture3, data.published.buildings[BUILDING_LARGE_TEMPLE_CERES].active);
+    buffer_write_i32(culture3, data.published.buildings[BUILDING_LARGE_TEMPLE_NEPTUNE].active);
+    buffer_write_i32(culture3, data.published.buildings[BUILDING_LARGE_TEMPLE_MERCURY].active);
+    buffer_write_i32(culture3, data.published.buildings[BUILDING_LARGE_TEMPLE_MARS].active);
+    buffer_write_i32(culture3, data.published.buildings[BUILDING_LARGE_TEMPLE_VENUS].active);
 
     // military
-    buffer_write_i32(military, data.buildings[BUILDING_MILITARY_ACADEMY].total);
-    buffer_write_i32(military, data.buildings[BUILDING_MILITARY_ACADEMY].active);
-    buffer_write_i32(military, data.buildings[BUILDING_BARRACKS].total);
-    buffer_write_i32(military, data.buildings[BUILDING_BARRACKS].active);
+    buffer_write_i32(military, data.published.buildings[BUILDING_MILITARY_ACADEMY].total);
+    buffer_write_i32(military, data.published.buildings[BUILDING_MILITARY_ACADEMY].active);
+    buffer_write_i32(military, data.published.buildings[BUILDING_BARRACKS].total);
+    buffer_write_i32(military, data.published.buildings[BUILDING_BARRACKS].active);
     
     // support
-    buffer_write_i32(support, data.buildings[BUILDING_MARKET].total);
-    buffer_write_i32(support, data.buildings[BUILDING_MARKET].active);
-    buffer_write_i32(support, data.buildings[BUILDING_RESERVOIR].total);
-    buffer_write_i32(support, data.buildings[BUILDING_RESERVOIR].active);
-    buffer_write_i32(support, data.buildings[BUILDING_FOUNTAIN].total);
-    buffer_write_i32(support, data.buildings[BUILDING_FOUNTAIN].active);
+    buffer_write_i32(support, data.published.buildings[BUILDING_MARKET].total);
+    buffer_write_i32(support, data.published.buildings[BUILDING_MARKET].active);
+    buffer_write_i32(support, data.published.buildings[BUILDING_RESERVOIR].total);
+    buffer_write_i32(support, data.published.buildings[BUILDING_RESERVOIR].active);
+    buffer_write_i32(support, data.published.buildings[BUILDING_FOUNTAIN].total);
+    buffer_write_i32(support, data.published.buildings[BUILDING_FOUNTAIN].active);
 }
 
 void building_count_load_state(buffer *industry, buffer *culture1, buffer *culture2,
@@ -319,80 +569,80 @@ void building_count_load_state(buffer *industry, buffer *culture1, buffer *cultu
 {
     // industry
     for (int i = 0; i < RESOURCE_MAX; i++) {
-        data.industry[i].total = buffer_read_i32(industry);
+        data.published.industry[i].total = buffer_read_i32(industry);
     }
     for (int i = 0; i < RESOURCE_MAX; i++) {
-        data.industry[i].active = buffer_read_i32(industry);
+        data.published.industry[i].active = buffer_read_i32(industry);
     }
     
     // culture 1
-    data.buildings[BUILDING_THEATER].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_THEATER].active = buffer_read_i32(culture1);
-    data.buildings[BUILDING_AMPHITHEATER].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_AMPHITHEATER].active = buffer_read_i32(culture1);
-    data.buildings[BUILDING_COLOSSEUM].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_COLOSSEUM].active = buffer_read_i32(culture1);
-    data.buildings[BUILDING_HIPPODROME].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_HIPPODROME].active = buffer_read_i32(culture1);
-    data.buildings[BUILDING_SCHOOL].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_SCHOOL].active = buffer_read_i32(culture1);
-    data.buildings[BUILDING_LIBRARY].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_LIBRARY].active = buffer_read_i32(culture1);
-    data.buildings[BUILDING_ACADEMY].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_ACADEMY].active = buffer_read_i32(culture1);
-    data.buildings[BUILDING_BARBER].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_BARBER].active = buffer_read_i32(culture1);
-    data.buildings[BUILDING_BATHHOUSE].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_BATHHOUSE].active = buffer_read_i32(culture1);
-    data.buildings[BUILDING_DOCTOR].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_DOCTOR].active = buffer_read_i32(culture1);
-    data.buildings[BUILDING_HOSPITAL].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_HOSPITAL].active = buffer_read_i32(culture1);
-    data.buildings[BUILDING_SMALL_TEMPLE_CERES].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_SMALL_TEMPLE_NEPTUNE].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_SMALL_TEMPLE_MERCURY].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_SMALL_TEMPLE_MARS].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_SMALL_TEMPLE_VENUS].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_LARGE_TEMPLE_CERES].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_LARGE_TEMPLE_NEPTUNE].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_LARGE_TEMPLE_MERCURY].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_LARGE_TEMPLE_MARS].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_LARGE_TEMPLE_VENUS].total = buffer_read_i32(culture1);
-    data.buildings[BUILDING_ORACLE].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_THEATER].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_THEATER].active = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_AMPHITHEATER].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_AMPHITHEATER].active = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_COLOSSEUM].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_COLOSSEUM].active = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_HIPPODROME].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_HIPPODROME].active = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_SCHOOL].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_SCHOOL].active = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_LIBRARY].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_LIBRARY].active = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_ACADEMY].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_ACADEMY].active = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_BARBER].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_BARBER].active = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_BATHHOUSE].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_BATHHOUSE].active = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_DOCTOR].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_DOCTOR].active = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_HOSPITAL].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_HOSPITAL].active = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_SMALL_TEMPLE_CERES].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_SMALL_TEMPLE_NEPTUNE].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_SMALL_TEMPLE_MERCURY].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_SMALL_TEMPLE_MARS].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_SMALL_TEMPLE_VENUS].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_LARGE_TEMPLE_CERES].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_LARGE_TEMPLE_NEPTUNE].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_LARGE_TEMPLE_MERCURY].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_LARGE_TEMPLE_MARS].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_LARGE_TEMPLE_VENUS].total = buffer_read_i32(culture1);
+    data.published.buildings[BUILDING_ORACLE].total = buffer_read_i32(culture1);
 
     // culture 2
-    data.buildings[BUILDING_ACTOR_COLONY].total = buffer_read_i32(culture2);
-    data.buildings[BUILDING_ACTOR_COLONY].active = buffer_read_i32(culture2);
-    data.buildings[BUILDING_GLADIATOR_SCHOOL].total = buffer_read_i32(culture2);
-    data.buildings[BUILDING_GLADIATOR_SCHOOL].active = buffer_read_i32(culture2);
-    data.buildings[BUILDING_LION_HOUSE].total = buffer_read_i32(culture2);
-    data.buildings[BUILDING_LION_HOUSE].active = buffer_read_i32(culture2);
-    data.buildings[BUILDING_CHARIOT_MAKER].total = buffer_read_i32(culture2);
-    data.buildings[BUILDING_CHARIOT_MAKER].active = buffer_read_i32(culture2);
+    data.published.buildings[BUILDING_ACTOR_COLONY].total = buffer_read_i32(culture2);
+    data.published.buildings[BUILDING_ACTOR_COLONY].active = buffer_read_i32(culture2);
+    data.published.buildings[BUILDING_GLADIATOR_SCHOOL].total = buffer_read_i32(culture2);
+    data.published.buildings[BUILDING_GLADIATOR_SCHOOL].active = buffer_read_i32(culture2);
+    data.published.buildings[BUILDING_LION_HOUSE].total = buffer_read_i32(culture2);
+    data.published.buildings[BUILDING_LION_HOUSE].active = buffer_read_i32(culture2);
+    data.published.buildings[BUILDING_CHARIOT_MAKER].total = buffer_read_i32(culture2);
+    data.published.buildings[BUILDING_CHARIOT_MAKER].active = buffer_read_i32(culture2);
 
     // culture 3
-    data.buildings[BUILDING_SMALL_TEMPLE_CERES].active = buffer_read_i32(culture3);
-    data.buildings[BUILDING_SMALL_TEMPLE_NEPTUNE].active = buffer_read_i32(culture3);
-    data.buildings[BUILDING_SMALL_TEMPLE_MERCURY].active = buffer_read_i32(culture3);
-    data.buildings[BUILDING_SMALL_TEMPLE_MARS].active = buffer_read_i32(culture3);
-    data.buildings[BUILDING_SMALL_TEMPLE_VENUS].active = buffer_read_i32(culture3);
-    data.buildings[BUILDING_LARGE_TEMPLE_CERES].active = buffer_read_i32(culture3);
-    data.buildings[BUILDING_LARGE_TEMPLE_NEPTUNE].active = buffer_read_i32(culture3);
-    data.buildings[BUILDING_LARGE_TEMPLE_MERCURY].active = buffer_read_i32(culture3);
-    data.buildings[BUILDING_LARGE_TEMPLE_MARS].active = buffer_read_i32(culture3);
-    data.buildings[BUILDING_LARGE_TEMPLE_VENUS].active = buffer_read_i32(culture3);
+    data.published.buildings[BUILDING_SMALL_TEMPLE_CERES].active = buffer_read_i32(culture3);
+    data.published.buildings[BUILDING_SMALL_TEMPLE_NEPTUNE].active = buffer_read_i32(culture3);
+    data.published.buildings[BUILDING_SMALL_TEMPLE_MERCURY].active = buffer_read_i32(culture3);
+    data.published.buildings[BUILDING_SMALL_TEMPLE_MARS].active = buffer_read_i32(culture3);
+    data.published.buildings[BUILDING_SMALL_TEMPLE_VENUS].active = buffer_read_i32(culture3);
+    data.published.buildings[BUILDING_LARGE_TEMPLE_CERES].active = buffer_read_i32(culture3);
+    data.published.buildings[BUILDING_LARGE_TEMPLE_NEPTUNE].active = buffer_read_i32(culture3);
+    data.published.buildings[BUILDING_LARGE_TEMPLE_MERCURY].active = buffer_read_i32(culture3);
+    data.published.buildings[BUILDING_LARGE_TEMPLE_MARS].active = buffer_read_i32(culture3);
+    data.published.buildings[BUILDING_LARGE_TEMPLE_VENUS].active = buffer_read_i32(culture3);
 
     // military
-    data.buildings[BUILDING_MILITARY_ACADEMY].total = buffer_read_i32(military);
-    data.buildings[BUILDING_MILITARY_ACADEMY].active = buffer_read_i32(military);
-    data.buildings[BUILDING_BARRACKS].total = buffer_read_i32(military);
-    data.buildings[BUILDING_BARRACKS].active = buffer_read_i32(military);
+    data.published.buildings[BUILDING_MILITARY_ACADEMY].total = buffer_read_i32(military);
+    data.published.buildings[BUILDING_MILITARY_ACADEMY].active = buffer_read_i32(military);
+    data.published.buildings[BUILDING_BARRACKS].total = buffer_read_i32(military);
+    data.published.buildings[BUILDING_BARRACKS].active = buffer_read_i32(military);
     
     // support
-    data.buildings[BUILDING_MARKET].total = buffer_read_i32(support);
-    data.buildings[BUILDING_MARKET].active = buffer_read_i32(support);
-    data.buildings[BUILDING_RESERVOIR].total = buffer_read_i32(support);
-    data.buildings[BUILDING_RESERVOIR].active = buffer_read_i32(support);
-    data.buildings[BUILDING_FOUNTAIN].total = buffer_read_i32(support);
-    data.buildings[BUILDING_FOUNTAIN].active = buffer_read_i32(support);
+    data.published.buildings[BUILDING_MARKET].total = buffer_read_i32(support);
+    data.published.buildings[BUILDING_MARKET].active = buffer_read_i32(support);
+    data.published.buildings[BUILDING_RESERVOIR].total = buffer_read_i32(support);
+    data.published.buildings[BUILDING_RESERVOIR].active = buffer_read_i32(support);
+    data.published.buildings[BUILDING_FOUNTAIN].total = buffer_read_i32(support);
+    data.published.buildings[BUILDING_FOUNTAIN].active = buffer_read_i32(support);
 }
@@ -11,10 +11,21 @@
  */
 
 /**
- * Updates the building counts and does some extra work on the side
+ * Publishes the building counts and does some extra work on the side
  */
 void building_count_update(void);
 
+/**
+ * Adjusts the counts after the state, type, workers or water access of a building changed
+ * @param building_id Building id
+ */
+void building_count_building_changed(int building_id);
+
+/**
+ * Counts all buildings again, called when the buildings are cleared or loaded
+ */
+void building_count_rebuild(void);
+
 /**
  * Returns the active building count for the type
  * @param type Building type
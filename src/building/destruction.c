@@ -1,5 +1,6 @@
 #include "destruction.h"
 
+#include "building/count.h"
 #include "city/message.h"
 #include "city/population.h"
 #include "city/ratings.h"
@@ -47,7 +48,7 @@ static void destroy_on_fire(building *b, int plagued)
     if (map_terrain_is(b->grid_offset, TERRAIN_WATER)) {
         b->state = BUILDING_STATE_DELETED_BY_GAME;
     } else {
-        b->type = BUILDING_BURNING_RUIN;
+        building_change_type(b, BUILDING_BURNING_RUIN);
         b->figure_id4 = 0;
         b->tax_income_or_storage = 0;
         b->fire_duration = (b->house_figure_generation_delay & 7) + 1;
@@ -64,6 +65,7 @@ static void destroy_on_fire(building *b, int plagued)
         }
         map_building_tiles_add(b->id, b->x, b->y, 1, image_id, TERRAIN_BUILDING);
     }
+    building_count_building_changed(b->id);
     static const int x_tiles[] = {0, 1, 1, 0, 2, 2, 2, 1, 0, 3, 3, 3, 3, 2, 1, 0, 4, 4, 4, 4, 4, 3, 2, 1, 0, 5, 5, 5, 5, 5, 5, 4, 3, 2, 1, 0};
     static const int y_tiles[] = {0, 0, 1, 1, 0, 1, 2, 2, 2, 0, 1, 2, 3, 3, 3, 3, 0, 1, 2, 3, 4, 4, 4, 4, 4, 0, 1, 2, 3, 4, 5, 5, 5, 5, 5, 5};
     for (int tile = 1; tile < num_tiles; tile++) {
@@ -105,6 +107,7 @@ static void destroy_linked_parts(building *b, int on_fire)
         } else {
             map_building_tiles_set_rubble(part_id, part->x, part->y, part->size);
             part->state = BUILDING_STATE_RUBBLE;
+            building_count_building_changed(part->id);
         }
     }
 
@@ -119,6 +122,7 @@ static void destroy_linked_parts(building *b, int on_fire)
         } else {
             map_building_tiles_set_rubble(part->id, part->x, part->y, part->size);
             part->state = BUILDING_STATE_RUBBLE;
+            building_count_building_changed(part->id);
         }
     }
 }
@@ -126,6 +130,7 @@ static void destroy_linked_parts(building *b, int on_fire)
 void building_destroy_by_collapse(building *b)
 {
     b->state = BUILDING_STATE_RUBBLE;
+    building_count_building_changed(b->id);
     map_building_tiles_set_rubble(b->id, b->x, b->y, b->size);
     figure_create_explosion_cloud(b->x, b->y, b->size);
     destroy_linked_parts(b, 0);
@@ -155,6 +160,7 @@ int building_destroy_first_of_type(building_type type)
             int grid_offset = b->grid_offset;
             game_undo_disable();
             b->state = BUILDING_STATE_RUBBLE;
+            building_count_building_changed(i);
             map_building_tiles_set_rubble(i, b->x, b->y, b->size);
             sound_effect_play(SOUND_EFFECT_EXPLOSION);
             map_routing_update_land();
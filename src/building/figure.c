@@ -13,6 +13,7 @@
 #include "core/calc.h"
 #include "core/config.h"
 #include "core/image.h"
+#include "core/log.h"
 #include "figure/figure.h"
 #include "figure/formation_legion.h"
 #include "figure/movement.h"
@@ -25,6 +26,8 @@
 #include "map/terrain.h"
 #include "map/water.h"
 
+#include <string.h>
+
 static int worker_percentage(const building *b)
 {
     return calc_percentage(b->num_workers, model_get_building(b->type)->laborers);
@@ -1187,126 +1190,222 @@ static void update_native_crop_progress(building *b)
 }
 
 
+static const building_type SPAWNING_TYPES[] = {
+    BUILDING_WAREHOUSE, BUILDING_GRANARY, BUILDING_TOWER, BUILDING_ENGINEERS_POST, BUILDING_PREFECTURE,
+    BUILDING_ACTOR_COLONY, BUILDING_GLADIATOR_SCHOOL, BUILDING_LION_HOUSE, BUILDING_CHARIOT_MAKER,
+    BUILDING_AMPHITHEATER, BUILDING_THEATER, BUILDING_HIPPODROME, BUILDING_COLOSSEUM, BUILDING_MARKET,
+    BUILDING_BATHHOUSE, BUILDING_SCHOOL, BUILDING_LIBRARY, BUILDING_ACADEMY, BUILDING_BARBER,
+    BUILDING_DOCTOR, BUILDING_HOSPITAL, BUILDING_MISSION_POST, BUILDING_DOCK, BUILDING_WHARF,
+    BUILDING_SHIPYARD, BUILDING_NATIVE_HUT, BUILDING_NATIVE_MEETING, BUILDING_NATIVE_CROPS,
+    BUILDING_FORT, BUILDING_BARRACKS, BUILDING_MILITARY_ACADEMY,
+    // not spawning, but problems may be marked on fountains without water and
+    // on ruins of buildings that had a problem when they burned down
+    BUILDING_FOUNTAIN, BUILDING_BURNING_RUIN
+};
+
+static struct {
+    int is_valid;
+    building_type types[BUILDING_TYPE_MAX];
+    int num_types;
+    uint8_t is_listed[BUILDING_TYPE_MAX];
+    int spawn_visits[BUILDING_TYPE_MAX];
+    int spawned_figures[BUILDING_TYPE_MAX];
+} data;
+
+static void add_type_range(building_type first, building_type last)
+{
+    for (building_type type = first; type <= last; type++) {
+        data.types[data.num_types++] = type;
+        data.is_listed[type] = 1;
+    }
+}
+
+static void init_types(void)
+{
+    if (data.num_types) {
+        return;
+    }
+    add_type_range(BUILDING_HOUSE_SMALL_VILLA, BUILDING_HOUSE_LUXURY_PALACE);
+    add_type_range(BUILDING_WHEAT_FARM, BUILDING_POTTERY_WORKSHOP);
+    add_type_range(BUILDING_SENATE, BUILDING_FORUM_UPGRADED);
+    add_type_range(BUILDING_SMALL_TEMPLE_CERES, BUILDING_LARGE_TEMPLE_VENUS);
+    for (int i = 0; i < sizeof(SPAWNING_TYPES) / sizeof(building_type); i++) {
+        add_type_range(SPAWNING_TYPES[i], SPAWNING_TYPES[i]);
+    }
+}
+
+static int generate_figure(building *b, int patrician_generated)
+{
+    if (b->state != BUILDING_STATE_IN_USE) {
+        return patrician_generated;
+    }
+    if (b->type == BUILDING_WAREHOUSE_SPACE || (b->type == BUILDING_HIPPODROME && b->prev_part_building_id)) {
+        return patrician_generated;
+    }
+    building_type type = b->type;
+    int created_sequence = figure_next_created_sequence();
+    b->show_on_problem_overlay = 0;
+    // range of building types
+    if (b->type >= BUILDING_HOUSE_SMALL_VILLA && b->type <= BUILDING_HOUSE_LUXURY_PALACE) {
+        patrician_generated = spawn_patrician(b, patrician_generated);
+    } else if (b->type >= BUILDING_WHEAT_FARM && b->type <= BUILDING_POTTERY_WORKSHOP) {
+        spawn_figure_industry(b);
+    } else if (b->type >= BUILDING_SENATE && b->type <= BUILDING_FORUM_UPGRADED) {
+        spawn_figure_senate_forum(b);
+    } else if (b->type >= BUILDING_SMALL_TEMPLE_CERES && b->type <= BUILDING_LARGE_TEMPLE_VENUS) {
+        spawn_figure_temple(b);
+    } else {
+        // single building type
+        switch (b->type) {
+            case BUILDING_WAREHOUSE:
+                spawn_figure_warehouse(b);
+                break;
+            case BUILDING_GRANARY:
+                spawn_figure_granary(b);
+                break;
+            case BUILDING_TOWER:
+                spawn_figure_tower(b);
+                break;
+            case BUILDING_ENGINEERS_POST:
+                spawn_figure_engineers_post(b);
+                break;
+            case BUILDING_PREFECTURE:
+                spawn_figure_prefecture(b);
+                break;
+            case BUILDING_ACTOR_COLONY:
+                spawn_figure_actor_colony(b);
+                break;
+            case BUILDING_GLADIATOR_SCHOOL:
+                spawn_figure_gladiator_school(b);
+                break;
+            case BUILDING_LION_HOUSE:
+                spawn_figure_lion_house(b);
+                break;
+            case BUILDING_CHARIOT_MAKER:
+                spawn_figure_chariot_maker(b);
+                break;
+            case BUILDING_AMPHITHEATER:
+                spawn_figure_amphitheater(b);
+                break;
+            case BUILDING_THEATER:
+                spawn_figure_theater(b);
+                break;
+            case BUILDING_HIPPODROME:
+                spawn_figure_hippodrome(b);
+                break;
+            case BUILDING_COLOSSEUM:
+                spawn_figure_colosseum(b);
+                break;
+            case BUILDING_MARKET:
+                spawn_figure_market(b);
+                break;
+            case BUILDING_BATHHOUSE:
+                spawn_figure_bathhouse(b);
+                break;
+            case BUILDING_SCHOOL:
+                spawn_figure_school(b);
+                break;
+            case BUILDING_LIBRARY:
+                spawn_figure_library(b);
+                break;
+            case BUILDING_ACADEMY:
+                spawn_figure_academy(b);
+                break;
+            case BUILDING_BARBER:
+                spawn_figure_barber(b);
+                break;
+            case BUILDING_DOCTOR:
+                spawn_figure_doctor(b);
+                break;
+            case BUILDING_HOSPITAL:
+                spawn_figure_hospital(b);
+                break;
+            case BUILDING_MISSION_POST:
+                spawn_figure_mission_post(b);
+                break;
+            case BUILDING_DOCK:
+                spawn_figure_dock(b);
+                break;
+            case BUILDING_WHARF:
+                spawn_figure_wharf(b);
+                break;
+            case BUILDING_SHIPYARD:
+                spawn_figure_shipyard(b);
+                break;
+            case BUILDING_NATIVE_HUT:
+                spawn_figure_native_hut(b);
+                break;
+            case BUILDING_NATIVE_MEETING:
+                spawn_figure_native_meeting(b);
+                break;
+            case BUILDING_NATIVE_CROPS:
+                update_native_crop_progress(b);
+                break;
+            case BUILDING_FORT:
+                formation_legion_update_recruit_status(b);
+                break;
+            case BUILDING_BARRACKS:
+                spawn_figure_barracks(b);
+                break;
+            case BUILDING_MILITARY_ACADEMY:
+                spawn_figure_military_academy(b);
+                break;
+        }
+    }
+    data.spawn_visits[type]++;
+    data.spawned_figures[type] += figure_next_created_sequence() - created_sequence;
+    return patrician_generated;
+}
+
+#ifdef VERIFY_INCREMENTAL
+static void verify_skipped_buildings(int max_id)
+{
+    int mismatches = 0;
+    for (int i = 1; i <= max_id; i++) {
+        building *b = building_get(i);
+        if (b->state == BUILDING_STATE_IN_USE && !data.is_listed[b->type] &&
+            b->type != BUILDING_WAREHOUSE_SPACE && b->show_on_problem_overlay) {
+            mismatches++;
+        }
+    }
+    if (mismatches) {
+        log_error("Buildings skipped when spawning figures have a problem marked:", 0, mismatches);
+    }
+}
+#endif
+
+void building_figure_clear(void)
+{
+    data.is_valid = 0;
+    memset(data.spawn_visits, 0, sizeof(data.spawn_visits));
+    memset(data.spawned_figures, 0, sizeof(data.spawned_figures));
+}
+
+void building_figure_get_spawn_cost(building_type type, int *visits, int *figures)
+{
+    *visits = data.spawn_visits[type];
+    *figures = data.spawned_figures[type];
+}
+
 void building_figure_generate(void)
 {
     int patrician_generated = 0;
     building_barracks_decay_tower_sentry_request();
     int max_id = building_get_highest_id();
-    for (int i = 1; i <= max_id; i++) {
-        building *b = building_get(i);
-        if (b->state != BUILDING_STATE_IN_USE) {
-            continue;
-        }
-        if (b->type == BUILDING_WAREHOUSE_SPACE || (b->type == BUILDING_HIPPODROME && b->prev_part_building_id)) {
-            continue;
-        }
-        b->show_on_problem_overlay = 0;
-        // range of building types
-        if (b->type >= BUILDING_HOUSE_SMALL_VILLA && b->type <= BUILDING_HOUSE_LUXURY_PALACE) {
-            patrician_generated = spawn_patrician(b, patrician_generated);
-        } else if (b->type >= BUILDING_WHEAT_FARM && b->type <= BUILDING_POTTERY_WORKSHOP) {
-            spawn_figure_industry(b);
-        } else if (b->type >= BUILDING_SENATE && b->type <= BUILDING_FORUM_UPGRADED) {
-            spawn_figure_senate_forum(b);
-        } else if (b->type >= BUILDING_SMALL_TEMPLE_CERES && b->type <= BUILDING_LARGE_TEMPLE_VENUS) {
-            spawn_figure_temple(b);
-        } else {
-            // single building type
-            switch (b->type) {
-                case BUILDING_WAREHOUSE:
-                    spawn_figure_warehouse(b);
-                    break;
-                case BUILDING_GRANARY:
-                    spawn_figure_granary(b);
-                    break;
-                case BUILDING_TOWER:
-                    spawn_figure_tower(b);
-                    break;
-                case BUILDING_ENGINEERS_POST:
-                    spawn_figure_engineers_post(b);
-                    break;
-                case BUILDING_PREFECTURE:
-                    spawn_figure_prefecture(b);
-                    break;
-                case BUILDING_ACTOR_COLONY:
-                    spawn_figure_actor_colony(b);
-                    break;
-                case BUILDING_GLADIATOR_SCHOOL:
-                    spawn_figure_gladiator_school(b);
-                    break;
-                case BUILDING_LION_HOUSE:
-                    spawn_figure_lion_house(b);
-                    break;
-                case BUILDING_CHARIOT_MAKER:
-                    spawn_figure_chariot_maker(b);
-                    break;
-                case BUILDING_AMPHITHEATER:
-                    spawn_figure_amphitheater(b);
-                    break;
-                case BUILDING_THEATER:
-                    spawn_figure_theater(b);
-                    break;
-                case BUILDING_HIPPODROME:
-                    spawn_figure_hippodrome(b);
-                    break;
-                case BUILDING_COLOSSEUM:
-                    spawn_figure_colosseum(b);
-                    break;
-                case BUILDING_MARKET:
-                    spawn_figure_market(b);
-                    break;
-                case BUILDING_BATHHOUSE:
-                    spawn_figure_bathhouse(b);
-                    break;
-                case BUILDING_SCHOOL:
-                    spawn_figure_school(b);
-                    break;
-                case BUILDING_LIBRARY:
-                    spawn_figure_library(b);
-                    break;
-                case BUILDING_ACADEMY:
-                    spawn_figure_academy(b);
-                    break;
-                case BUILDING_BARBER:
-                    spawn_figure_barber(b);
-                    break;
-                case BUILDING_DOCTOR:
-                    spawn_figure_doctor(b);
-                    break;
-                case BUILDING_HOSPITAL:
-                    spawn_figure_hospital(b);
-                    break;
-                case BUILDING_MISSION_POST:
-                    spawn_figure_mission_post(b);
-                    break;
-                case BUILDING_DOCK:
-                    spawn_figure_dock(b);
-                    break;
-                case BUILDING_WHARF:
-                    spawn_figure_wharf(b);
-                    break;
-                case BUILDING_SHIPYARD:
-                    spawn_figure_shipyard(b);
-                    break;
-                case BUILDING_NATIVE_HUT:
-                    spawn_figure_native_hut(b);
-                    break;
-                case BUILDING_NATIVE_MEETING:
-                    spawn_figure_native_meeting(b);
-                    break;
-                case BUILDING_NATIVE_CROPS:
-                    update_native_crop_progress(b);
-                    break;
-                case BUILDING_FORT:
-                    formation_legion_update_recruit_status(b);
-                    break;
-                case BUILDING_BARRACKS:
-                    spawn_figure_barracks(b);
-                    break;
-                case BUILDING_MILITARY_ACADEMY:
-                    spawn_figure_military_academy(b);
-                    break;
-            }
+    if (!data.is_valid) {
+        // a loaded game may have problems marked on buildings that do not spawn figures
+        for (int i = 1; i <= max_id; i++) {
+            patrician_generated = generate_figure(building_get(i), patrician_generated);
         }
+        data.is_valid = 1;
+        return;
+    }
+    init_types();
+    for (int i = building_next_of_types(0, data.types, data.num_types); i && i <= max_id;
+        i = building_next_of_types(i, data.types, data.num_types)) {
+        patrician_generated = generate_figure(building_get(i), patrician_generated);
     }
+#ifdef VERIFY_INCREMENTAL
+    verify_skipped_buildings(max_id);
+#endif
 }
@@ -1,6 +1,22 @@
 #ifndef BUILDING_FIGURE_H
 #define BUILDING_FIGURE_H
 
+#include "building/type.h"
+
+/**
+ * Resets the spawn costs and makes the next update visit every building; called when a game is loaded
+ */
+void building_figure_clear(void);
+
 void building_figure_generate(void);
 
+/**
+ * Gets what spawning figures cost for buildings of the given type since the game was loaded,
+ * for profiling
+ * @param type Building type
+ * @param visits Set to how often buildings of the type were visited to spawn figures
+ * @param figures Set to how many figures these visits created
+ */
+void building_figure_get_spawn_cost(building_type type, int *visits, int *figures);
+
 #endif // BUILDING_FIGURE_H
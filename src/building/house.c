@@ -49,7 +49,7 @@ static struct {
 
 void building_house_change_to(building *house, building_type type)
 {
-    house->type = type;
+    building_change_type(house, type);
     house->subtype.house_level = house->type - BUILDING_HOUSE_VACANT_LOT;
     int image_id = image_group(HOUSE_IMAGE[house->subtype.house_level].group);
     if (house->house_is_merged) {
@@ -74,7 +74,7 @@ static void create_vacant_lot(int x, int y, int image_id)
 
 void building_house_change_to_vacant_lot(building *house)
 {
-    house->type = BUILDING_HOUSE_VACANT_LOT;
+    building_change_type(house, BUILDING_HOUSE_VACANT_LOT);
     house->subtype.house_level = house->type - BUILDING_HOUSE_VACANT_LOT;
     int image_id = image_group(GROUP_BUILDING_HOUSE_VACANT_LOT);
     if (house->house_is_merged) {
@@ -277,7 +277,7 @@ static void split_size2(building *house, building_type new_type)
     map_building_tiles_remove(house->id, house->x, house->y);
 
     // main tile
-    house->type = new_type;
+    building_change_type(house, new_type);
     house->subtype.house_level = house->type - BUILDING_HOUSE_VACANT_LOT;
     house->size = house->house_size = 1;
     house->house_is_merged = 0;
@@ -311,7 +311,7 @@ static void split_size3(building *house)
     map_building_tiles_remove(house->id, house->x, house->y);
 
     // main tile
-    house->type = BUILDING_HOUSE_MEDIUM_INSULA;
+    building_change_type(house, BUILDING_HOUSE_MEDIUM_INSULA);
     house->subtype.house_level = house->type - BUILDING_HOUSE_VACANT_LOT;
     house->size = house->house_size = 1;
     house->house_is_merged = 0;
@@ -361,7 +361,7 @@ void building_house_expand_to_large_insula(building *house)
     split(house, 4);
     prepare_for_merge(house->id, 4);
 
-    house->type = BUILDING_HOUSE_LARGE_INSULA;
+    building_change_type(house, BUILDING_HOUSE_LARGE_INSULA);
     house->subtype.house_level = HOUSE_LARGE_INSULA;
     house->size = house->house_size = 2;
     house->house_population += merge_data.population;
@@ -381,7 +381,7 @@ void building_house_expand_to_large_villa(building *house)
     split(house, 9);
     prepare_for_merge(house->id, 9);
 
-    house->type = BUILDING_HOUSE_LARGE_VILLA;
+    building_change_type(house, BUILDING_HOUSE_LARGE_VILLA);
     house->subtype.house_level = HOUSE_LARGE_VILLA;
     house->size = house->house_size = 3;
     house->house_population += merge_data.population;
@@ -401,7 +401,7 @@ void building_house_expand_to_large_palace(building *house)
     split(house, 16);
     prepare_for_merge(house->id, 16);
 
-    house->type = BUILDING_HOUSE_LARGE_PALACE;
+    building_change_type(house, BUILDING_HOUSE_LARGE_PALACE);
     house->subtype.house_level = HOUSE_LARGE_PALACE;
     house->size = house->house_size = 4;
     house->house_population += merge_data.population;
@@ -435,7 +435,7 @@ void building_house_devolve_from_large_villa(building *house)
     map_building_tiles_remove(house->id, house->x, house->y);
 
     // main tile
-    house->type = BUILDING_HOUSE_MEDIUM_VILLA;
+    building_change_type(house, BUILDING_HOUSE_MEDIUM_VILLA);
     house->subtype.house_level = house->type - BUILDING_HOUSE_VACANT_LOT;
     house->size = house->house_size = 2;
     house->house_is_merged = 0;
@@ -472,7 +472,7 @@ void building_house_devolve_from_large_palace(building *house)
     map_building_tiles_remove(house->id, house->x, house->y);
 
     // main tile
-    house->type = BUILDING_HOUSE_MEDIUM_PALACE;
+    building_change_type(house, BUILDING_HOUSE_MEDIUM_PALACE);
     house->subtype.house_level = house->type - BUILDING_HOUSE_VACANT_LOT;
     house->size = house->house_size = 3;
     house->house_is_merged = 0;
@@ -55,29 +55,24 @@ int house_population_remove_from_city(int num_people)
     return removed;
 }
 
-static void fill_building_list_with_houses(void)
-{
-    building_list_large_clear(0);
-    for (int i = 1; i < MAX_BUILDINGS; i++) {
-        building *b = building_get(i);
-        if (b->state == BUILDING_STATE_IN_USE && b->house_size) {
-            building_list_large_add(i);
-        }
-    }
-}
-
 void house_population_update_room(void)
 {
     city_population_clear_capacity();
 
-    fill_building_list_with_houses();
-    int total_houses = building_list_large_size();
-    const int *houses = building_list_large_items();
-    for (int i = 0; i < total_houses; i++) {
+    // the list of houses is also used by immigration
+    building_list_large_clear(0);
+    const int *houses;
+    const int16_t *levels;
+    int num_houses = building_house_table(&houses, &levels);
+    for (int i = 0; i < num_houses; i++) {
         building *b = building_get(houses[i]);
+        if (b->state != BUILDING_STATE_IN_USE || !b->house_size) {
+            continue;
+        }
+        building_list_large_add(houses[i]);
         b->house_population_room = 0;
         if (b->distance_from_entry > 0) {
-            int max_pop = model_get_house(b->subtype.house_level)->max_people;
+            int max_pop = model_get_house(levels[i])->max_people;
             if (b->house_is_merged) {
                 max_pop *= 4;
             }
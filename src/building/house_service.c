@@ -14,8 +14,10 @@ static void decay(unsigned char *value)
 
 void house_service_decay_culture(void)
 {
-    for (int i = 1; i < MAX_BUILDINGS; i++) {
-        building *b = building_get(i);
+    const int *houses;
+    int num_houses = building_house_table(&houses, 0);
+    for (int i = 0; i < num_houses; i++) {
+        building *b = building_get(houses[i]);
         if (b->state != BUILDING_STATE_IN_USE || !b->house_size) {
             continue;
         }
@@ -67,8 +69,10 @@ void house_service_decay_houses_covered(void)
 void house_service_calculate_culture_aggregates(void)
 {
     int base_entertainment = city_culture_coverage_average_entertainment() / 5;
-    for (int i = 1; i < MAX_BUILDINGS; i++) {
-        building *b = building_get(i);
+    const int *houses;
+    int num_houses = building_house_table(&houses, 0);
+    for (int i = 0; i < num_houses; i++) {
+        building *b = building_get(houses[i]);
         if (b->state != BUILDING_STATE_IN_USE || !b->house_size) {
             continue;
         }
@@ -166,8 +166,10 @@ void city_culture_calculate(void)
     city_data.culture.average_health = 0;
 
     int num_houses = 0;
-    for (int i = 1; i < MAX_BUILDINGS; i++) {
-        building *b = building_get(i);
+    const int *houses;
+    int num_rows = building_house_table(&houses, 0);
+    for (int i = 0; i < num_rows; i++) {
+        building *b = building_get(houses[i]);
         if (b->state == BUILDING_STATE_IN_USE && b->house_size) {
             num_houses++;
             city_data.culture.average_entertainment += b->data.house.entertainment;
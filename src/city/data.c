@@ -1039,6 +1039,18 @@ void city_data_save_state(buffer *main, buffer *faction, buffer *faction_unknown
     save_entry_exit(entry_exit_xy, entry_exit_grid_offset);
 }
 
+void city_data_load_basic_info(buffer *main, int *population, int *treasury, int ratings[4])
+{
+    buffer_set(main, 18080);
+    *treasury = buffer_read_i32(main);
+    buffer_set(main, 18104);
+    *population = buffer_read_i32(main);
+    buffer_set(main, 34844);
+    for (int i = 0; i < 4; i++) {
+        ratings[i] = buffer_read_i32(main);
+    }
+}
+
 void city_data_load_state(buffer *main, buffer *faction, buffer *faction_unknown, buffer *graph_order,
                           buffer *entry_exit_xy, buffer *entry_exit_grid_offset)
 {
@@ -15,4 +15,14 @@ void city_data_save_state(buffer *main, buffer *faction, buffer *faction_unknown
 void city_data_load_state(buffer *main, buffer *faction, buffer *faction_unknown, buffer *graph_order,
                           buffer *entry_exit_xy, buffer *entry_exit_grid_offset);
 
+/**
+ * Reads the values shown in the saved game overview from the main city data,
+ * without changing the current city
+ * @param main Main city data piece of a saved game
+ * @param population Set to the population
+ * @param treasury Set to the treasury
+ * @param ratings Set to the culture, prosperity, peace and favor ratings, in that order
+ */
+void city_data_load_basic_info(buffer *main, int *population, int *treasury, int ratings[4]);
+
 #endif // CITY_DATA_H
@@ -1,6 +1,7 @@
 #include "labor.h"
 
 #include "building/building.h"
+#include "building/count.h"
 #include "building/model.h"
 #include "core/config.h"
 #include "city/data_private.h"
@@ -41,6 +42,14 @@ static int CATEGORY_FOR_BUILDING_TYPE[] = {
     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 //120
 };
 
+static struct {
+    int initialized;
+    building_type all_types[BUILDING_TYPE_MAX];
+    int num_all_types;
+    building_type water_types[BUILDING_TYPE_MAX];
+    int num_water_types;
+} labor_types;
+
 static struct {
     labor_category category;
     int workers;
@@ -173,6 +182,34 @@ static int should_have_workers(building *b, int category, int check_access)
     return 1;
 }
 
+static void init_labor_types(void)
+{
+    if (labor_types.initialized) {
+        return;
+    }
+    int num_types = sizeof(CATEGORY_FOR_BUILDING_TYPE) / sizeof(int);
+    for (int type = 0; type < num_types && type < BUILDING_TYPE_MAX; type++) {
+        int category = CATEGORY_FOR_BUILDING_TYPE[type];
+        if (category < 0) {
+            continue;
+        }
+        labor_types.all_types[labor_types.num_all_types++] = type;
+        if (category == LABOR_CATEGORY_WATER) {
+            labor_types.water_types[labor_types.num_water_types++] = type;
+        }
+    }
+    labor_types.initialized = 1;
+}
+
+/**
+ * Returns the next building after the given id that belongs to a labor category,
+ * using the building type index so that houses and other buildings are skipped
+ */
+static int next_labor_building_id(int id)
+{
+    return building_next_of_types(id, labor_types.all_types, labor_types.num_all_types);
+}
+
 static void calculate_workers_needed_per_category(void)
 {
     for (int cat = 0; cat < MAX_CATS; cat++) {
@@ -294,7 +331,7 @@ static void check_employment(void)
 static void set_building_worker_weight(void)
 {
     int water_per_10k_per_building = calc_percentage(100, city_data.labor.categories[LABOR_CATEGORY_WATER].buildings);
-    for (int i = 1; i < MAX_BUILDINGS; i++) {
+    for (int i = next_labor_building_id(0); i; i = next_labor_building_id(i)) {
         building *b = building_get(i);
         if (b->state != BUILDING_STATE_IN_USE) {
             continue;
@@ -313,6 +350,12 @@ static void set_building_worker_weight(void)
     }
 }
 
+static void set_workers(building *b, int num_workers)
+{
+    b->num_workers = num_workers;
+    building_count_building_changed(b->id);
+}
+
 static void allocate_workers_to_water(void)
 {
     static int start_building_id = 1;
@@ -328,29 +371,37 @@ static void allocate_workers_to_water(void)
     } else {
         workers_per_building = water_cat->workers_allocated / (water_cat->buildings - buildings_to_skip);
     }
-    int building_id = start_building_id;
+    int first_building_id = start_building_id;
+    // MAX_BUILDINGS - 1 ids are visited from the start id, so a start id of 0 leaves out the last id
+    int last_building_id = first_building_id ? MAX_BUILDINGS - 1 : MAX_BUILDINGS - 2;
     start_building_id = 0;
-    for (int guard = 1; guard < MAX_BUILDINGS; guard++, building_id++) {
-        if (building_id >= 2000) {
-            building_id = 1;
-        }
-        building *b = building_get(building_id);
-        if (b->state != BUILDING_STATE_IN_USE || CATEGORY_FOR_BUILDING_TYPE[b->type] != LABOR_CATEGORY_WATER) {
-            continue;
-        }
-        b->num_workers = 0;
-        if (b->percentage_houses_covered > 0) {
-            if (percentage_not_filled > 0) {
-                if (buildings_to_skip) {
-                    --buildings_to_skip;
-                } else if (start_building_id) {
-                    b->num_workers = workers_per_building;
+    // visit the water buildings from the start id up, then wrap around to the lower ids
+    for (int pass = 0; pass < 2; pass++) {
+        int building_id = building_next_of_types(pass || !first_building_id ? 0 : first_building_id - 1,
+            labor_types.water_types, labor_types.num_water_types);
+        for (; building_id; building_id = building_next_of_types(building_id,
+                labor_types.water_types, labor_types.num_water_types)) {
+            if (pass ? building_id >= first_building_id : building_id > last_building_id) {
+                break;
+            }
+            building *b = building_get(building_id);
+            if (b->state != BUILDING_STATE_IN_USE) {
+                continue;
+            }
+            set_workers(b, 0);
+            if (b->percentage_houses_covered > 0) {
+                if (percentage_not_filled > 0) {
+                    if (buildings_to_skip) {
+                        --buildings_to_skip;
+                    } else if (start_building_id) {
+                        set_workers(b, workers_per_building);
+                    } else {
+                        start_building_id = building_id;
+                        set_workers(b, workers_per_building);
+                    }
                 } else {
-                    start_building_id = building_id;
-                    b->num_workers = workers_per_building;
+                    set_workers(b, model_get_building(b->type)->laborers);
                 }
-            } else {
-                b->num_workers = model_get_building(b->type)->laborers;
             }
         }
     }
@@ -370,7 +421,7 @@ static void allocate_workers_to_non_water_buildings(void)
             city_data.labor.categories[i].workers_allocated < city_data.labor.categories[i].workers_needed
             ? 1 : 0;
     }
-    for (int i = 1; i < MAX_BUILDINGS; i++) {
+    for (int i = next_labor_building_id(0); i; i = next_labor_building_id(i)) {
         building *b = building_get(i);
         if (b->state != BUILDING_STATE_IN_USE) {
             continue;
@@ -380,7 +431,7 @@ static void allocate_workers_to_non_water_buildings(void)
             // water is handled by allocate_workers_to_water(void)
             continue;
         }
-        b->num_workers = 0;
+        set_workers(b, 0);
         if (!should_have_workers(b, cat, 0)) {
             continue;
         }
@@ -393,10 +444,10 @@ static void allocate_workers_to_non_water_buildings(void)
                 if (num_workers > required_workers) {
                     num_workers = required_workers;
                 }
-                b->num_workers = num_workers;
+                set_workers(b, num_workers);
                 category_workers_allocated[cat] += num_workers;
             } else {
-                b->num_workers = required_workers;
+                set_workers(b, required_workers);
             }
         }
     }
@@ -411,7 +462,7 @@ static void allocate_workers_to_non_water_buildings(void)
             }
         }
     }
-    for (int i = 1; i < MAX_BUILDINGS; i++) {
+    for (int i = next_labor_building_id(0); i; i = next_labor_building_id(i)) {
         building *b = building_get(i);
         if (b->state != BUILDING_STATE_IN_USE) {
             continue;
@@ -428,10 +479,10 @@ static void allocate_workers_to_non_water_buildings(void)
             if (b->num_workers < required_workers) {
                 int needed = required_workers - b->num_workers;
                 if (needed > category_workers_needed[cat]) {
-                    b->num_workers += category_workers_needed[cat];
+                    set_workers(b, b->num_workers + category_workers_needed[cat]);
                     category_workers_needed[cat] = 0;
                 } else {
-                    b->num_workers += needed;
+                    set_workers(b, b->num_workers + needed);
                     category_workers_needed[cat] -= needed;
                 }
             }
@@ -441,6 +492,7 @@ static void allocate_workers_to_non_water_buildings(void)
 
 static void allocate_workers_to_buildings(void)
 {
+    init_labor_types();
     set_building_worker_weight();
     allocate_workers_to_water();
     allocate_workers_to_non_water_buildings();
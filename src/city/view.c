@@ -5,6 +5,8 @@
 #include "map/image.h"
 #include "widget/minimap.h"
 
+#include <string.h>
+
 #define MENUBAR_HEIGHT 24
 #define TILE_WIDTH_PIXELS 60
 #define TILE_HEIGHT_PIXELS 30
@@ -34,7 +36,23 @@ static struct {
     } selected_tile;
 } data;
 
-static int view_to_grid_offset_lookup[VIEW_X_MAX][VIEW_Y_MAX];
+/**
+ * Lookup tables for all four orientations, built when the map is loaded so that rotating
+ * only switches tables. The view tables are stored by row, the order in which tiles are drawn.
+ * A row of the view crosses the map at most once, so its valid tiles form one span.
+ */
+static struct {
+    int16_t view_to_grid_offset[VIEW_Y_MAX][VIEW_X_MAX];
+    int grid_offset_to_view[GRID_SIZE * GRID_SIZE];
+    struct {
+        int16_t x_start;
+        int16_t x_end;
+    } row_span[VIEW_Y_MAX];
+} lookups[4];
+
+static int16_t (*view_to_grid_offset_lookup)[VIEW_X_MAX] = lookups[0].view_to_grid_offset;
+
+#define ORIENTATION_INDEX(orientation) ((orientation) / 2)
 
 static void check_camera_boundaries(void)
 {
@@ -59,25 +77,15 @@ static void check_camera_boundaries(void)
     data.camera.tile.y &= ~1;
 }
 
-static void reset_lookup(void)
-{
-    for (int y = 0; y < VIEW_Y_MAX; y++) {
-        for (int x = 0; x < VIEW_X_MAX; x++) {
-            view_to_grid_offset_lookup[x][y] = -1;
-        }
-    }
-}
-
-static void calculate_lookup(void)
+static void calculate_lookup_for_orientation(int orientation)
 {
-    reset_lookup();
     int y_view_start;
     int y_view_skip;
     int y_view_step;
     int x_view_start;
     int x_view_skip;
     int x_view_step;
-    switch (data.orientation) {
+    switch (orientation) {
         default:
         case DIR_0_TOP:
             x_view_start = VIEW_X_MAX - 1;
@@ -113,15 +121,21 @@ static void calculate_lookup(void)
             break;
     }
 
+    int16_t (*lookup)[VIEW_X_MAX] = lookups[ORIENTATION_INDEX(orientation)].view_to_grid_offset;
+    int *inverse = lookups[ORIENTATION_INDEX(orientation)].grid_offset_to_view;
+    memset(lookups[ORIENTATION_INDEX(orientation)].view_to_grid_offset, 0xff,
+        sizeof(lookups[0].view_to_grid_offset));
     for (int y = 0; y < GRID_SIZE; y++) {
         int x_view = x_view_start;
         int y_view = y_view_start;
         for (int x = 0; x < GRID_SIZE; x++) {
             int grid_offset = x + GRID_SIZE * y;
             if (map_image_at(grid_offset) < 6) {
-                view_to_grid_offset_lookup[x_view/2][y_view] = -1;
+                lookup[y_view][x_view / 2] = -1;
+                inverse[grid_offset] = -1;
             } else {
-                view_to_grid_offset_lookup[x_view/2][y_view] = grid_offset;
+                lookup[y_view][x_view / 2] = grid_offset;
+                inverse[grid_offset] = y_view * VIEW_X_MAX + x_view / 2;
             }
             x_view += x_view_step;
             y_view += y_view_step;
@@ -129,6 +143,32 @@ static void calculate_lookup(void)
         x_view_start += x_view_skip;
         y_view_start += y_view_skip;
     }
+
+    for (int y_view = 0; y_view < VIEW_Y_MAX; y_view++) {
+        int x_start = 0;
+        while (x_start < VIEW_X_MAX && lookup[y_view][x_start] < 0) {
+            x_start++;
+        }
+        int x_end = VIEW_X_MAX;
+        while (x_end > x_start && lookup[y_view][x_end - 1] < 0) {
+            x_end--;
+        }
+        lookups[ORIENTATION_INDEX(orientation)].row_span[y_view].x_start = x_start;
+        lookups[ORIENTATION_INDEX(orientation)].row_span[y_view].x_end = x_end;
+    }
+}
+
+static void use_lookup_for_orientation(void)
+{
+    view_to_grid_offset_lookup = lookups[ORIENTATION_INDEX(data.orientation)].view_to_grid_offset;
+}
+
+static void calculate_lookup(void)
+{
+    for (int orientation = DIR_0_TOP; orientation <= DIR_6_LEFT; orientation += 2) {
+        calculate_lookup_for_orientation(orientation);
+    }
+    use_lookup_for_orientation();
 }
 
 static void adjust_camera_position_for_pixels(void)
@@ -217,20 +257,19 @@ int city_view_scroll(int x, int y)
 
 int city_view_to_grid_offset(int x_view, int y_view)
 {
-    return view_to_grid_offset_lookup[x_view][y_view];
+    return view_to_grid_offset_lookup[y_view][x_view];
 }
 
 void city_view_grid_offset_to_xy_view(int grid_offset, int *x_view, int *y_view)
 {
     *x_view = *y_view = 0;
-    for (int y = 0; y < VIEW_Y_MAX; y++) {
-        for (int x = 0; x < VIEW_X_MAX; x++) {
-            if (view_to_grid_offset_lookup[x][y] == grid_offset) {
-                *x_view = x;
-                *y_view = y;
-                return;
-            }
-        }
+    if (grid_offset < 0 || grid_offset >= GRID_SIZE * GRID_SIZE) {
+        return;
+    }
+    int view_offset = lookups[ORIENTATION_INDEX(data.orientation)].grid_offset_to_view[grid_offset];
+    if (view_offset >= 0) {
+        *x_view = view_offset % VIEW_X_MAX;
+        *y_view = view_offset / VIEW_X_MAX;
     }
 }
 
@@ -289,7 +328,7 @@ int city_view_pixels_to_grid_offset(int x_pixels, int y_pixels)
     if (!city_view_pixels_to_view_tile(x_pixels, y_pixels, &view)) {
         return 0;
     }
-    int grid_offset = view_to_grid_offset_lookup[view.x][view.y];
+    int grid_offset = view_to_grid_offset_lookup[view.y][view.x];
     return grid_offset < 0 ? 0 : grid_offset;
 }
 
@@ -307,7 +346,7 @@ static int get_center_grid_offset(void)
 {
     int x_center = data.camera.tile.x + data.viewport.width_tiles / 2;
     int y_center = data.camera.tile.y + data.viewport.height_tiles / 2;
-    return view_to_grid_offset_lookup[x_center][y_center];
+    return view_to_grid_offset_lookup[y_center][x_center];
 }
 
 void city_view_rotate_left(void)
@@ -318,7 +357,7 @@ void city_view_rotate_left(void)
     if (data.orientation > 6) {
         data.orientation = DIR_0_TOP;
     }
-    calculate_lookup();
+    use_lookup_for_orientation();
     if (center_grid_offset >= 0) {
         int x, y;
         city_view_grid_offset_to_xy_view(center_grid_offset, &x, &y);
@@ -336,7 +375,7 @@ void city_view_rotate_right(void)
     if (data.orientation < 0) {
         data.orientation = DIR_6_LEFT;
     }
-    calculate_lookup();
+    use_lookup_for_orientation();
     if (center_grid_offset >= 0) {
         int x, y;
         city_view_grid_offset_to_xy_view(center_grid_offset, &x, &y);
@@ -464,7 +503,7 @@ void city_view_foreach_map_tile(map_callback *callback)
             int x_view = data.camera.tile.x - 4;
             for (int x = 0; x < data.viewport.width_tiles + 7; x++) {
                 if (x_view >= 0 && x_view < VIEW_X_MAX) {
-                    int grid_offset = view_to_grid_offset_lookup[x_view][y_view];
+                    int grid_offset = view_to_grid_offset_lookup[y_view][x_view];
                     callback(x_graphic, y_graphic, grid_offset);
                 }
                 x_graphic += TILE_WIDTH_PIXELS;
@@ -477,70 +516,51 @@ void city_view_foreach_map_tile(map_callback *callback)
     }
 }
 
+/**
+ * Calls the callback for the valid tiles of a view row that are within the drawn area,
+ * visiting only the span of the row that crosses the map
+ */
+static void foreach_valid_tile_in_row(map_callback *callback, int y_view, int x_graphic, int y_graphic)
+{
+    const int16_t *row = view_to_grid_offset_lookup[y_view];
+    int x_view_start = data.camera.tile.x - 4;
+    int x_view_end = x_view_start + data.viewport.width_tiles + 7;
+    int span_start = lookups[ORIENTATION_INDEX(data.orientation)].row_span[y_view].x_start;
+    int span_end = lookups[ORIENTATION_INDEX(data.orientation)].row_span[y_view].x_end;
+    int x_view = x_view_start > span_start ? x_view_start : span_start;
+    if (x_view_end > span_end) {
+        x_view_end = span_end;
+    }
+    x_graphic += (x_view - x_view_start) * TILE_WIDTH_PIXELS;
+    for (; x_view < x_view_end; x_view++, x_graphic += TILE_WIDTH_PIXELS) {
+        int grid_offset = row[x_view];
+        if (grid_offset >= 0) {
+            callback(x_graphic, y_graphic, grid_offset);
+        }
+    }
+}
+
 void city_view_foreach_valid_map_tile(map_callback *callback1, map_callback *callback2, map_callback *callback3)
 {
     int odd = 0;
     int y_view = data.camera.tile.y - 8;
     int y_graphic = data.viewport.y - 9 * HALF_TILE_HEIGHT_PIXELS - data.camera.pixel.y;
-    int x_graphic, x_view;
     for (int y = 0; y < data.viewport.height_tiles + 21; y++) {
         if (y_view >= 0 && y_view < VIEW_Y_MAX) {
+            int x_graphic = -(4 * TILE_WIDTH_PIXELS) - data.camera.pixel.x;
+            if (odd) {
+                x_graphic += data.viewport.x - HALF_TILE_WIDTH_PIXELS;
+            } else {
+                x_graphic += data.viewport.x;
+            }
             if (callback1) {
-                x_graphic = -(4 * TILE_WIDTH_PIXELS) - data.camera.pixel.x;
-                if (odd) {
-                    x_graphic += data.viewport.x - HALF_TILE_WIDTH_PIXELS;
-                } else {
-                    x_graphic += data.viewport.x;
-                }
-                x_view = data.camera.tile.x - 4;
-                for (int x = 0; x < data.viewport.width_tiles + 7; x++) {
-                    if (x_view >= 0 && x_view < VIEW_X_MAX) {
-                        int grid_offset = view_to_grid_offset_lookup[x_view][y_view];
-                        if (grid_offset >= 0) {
-                            callback1(x_graphic, y_graphic, grid_offset);
-                        }
-                    }
-                    x_graphic += TILE_WIDTH_PIXELS;
-                    x_view++;
-                }
+                foreach_valid_tile_in_row(callback1, y_view, x_graphic, y_graphic);
             }
             if (callback2) {
-                x_graphic = -(4 * TILE_WIDTH_PIXELS) - data.camera.pixel.x;
-                if (odd) {
-                    x_graphic += data.viewport.x - HALF_TILE_WIDTH_PIXELS;
-                } else {
-                    x_graphic += data.viewport.x;
-                }
-                x_view = data.camera.tile.x - 4;
-                for (int x = 0; x < data.viewport.width_tiles + 7; x++) {
-                    if (x_view >= 0 && x_view < VIEW_X_MAX) {
-                        int grid_offset = view_to_grid_offset_lookup[x_view][y_view];
-                        if (grid_offset >= 0) {
-                            callback2(x_graphic, y_graphic, grid_offset);
-                        }
-                    }
-                    x_graphic += TILE_WIDTH_PIXELS;
-                    x_view++;
-                }
+                foreach_valid_tile_in_row(callback2, y_view, x_graphic, y_graphic);
             }
             if (callback3) {
-                x_graphic = -(4 * TILE_WIDTH_PIXELS) - data.camera.pixel.x;
-                if (odd) {
-                    x_graphic += data.viewport.x - HALF_TILE_WIDTH_PIXELS;
-                } else {
-                    x_graphic += data.viewport.x;
-                }
-                x_view = data.camera.tile.x - 4;
-                for (int x = 0; x < data.viewport.width_tiles + 7; x++) {
-                    if (x_view >= 0 && x_view < VIEW_X_MAX) {
-                        int grid_offset = view_to_grid_offset_lookup[x_view][y_view];
-                        if (grid_offset >= 0) {
-                            callback3(x_graphic, y_graphic, grid_offset);
-                        }
-                    }
-                    x_graphic += TILE_WIDTH_PIXELS;
-                    x_view++;
-                }
+                foreach_valid_tile_in_row(callback3, y_view, x_graphic, y_graphic);
             }
         }
         odd = 1 - odd;
@@ -566,7 +586,7 @@ void city_view_foreach_minimap_tile(int x_offset, int y_offset, int absolute_x,
         int x_abs = absolute_x - 4;
         for (int x_rel = -4; x_rel < width_tiles; x_rel++, x_abs++, x_view += 2) {
             if (x_abs >= 0 && x_abs < VIEW_X_MAX && y_abs >= 0 && y_abs < VIEW_Y_MAX) {
-                callback(x_view, y_view, view_to_grid_offset_lookup[x_abs][y_abs]);
+                callback(x_view, y_view, view_to_grid_offset_lookup[y_abs][x_abs]);
             }
         }
     }
@@ -4,13 +4,17 @@
 #include "core/string.h"
 #include "platform/vita/vita.h"
 
+#include <ctype.h>
 #include <dirent.h>
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <time.h>
 
 #ifdef _WIN32
+#include <direct.h>
 #include <windows.h>
 
 #define fs_dir_type _WDIR
@@ -59,42 +63,129 @@ static const char *filename_to_utf8(const wchar_t *str)
 #define CURRENT_DIR "."
 #endif
 
+#ifdef __vita__
+#define CURRENT_DIR_STAT_PATH VITA_PATH_PREFIX
+#else
+#define CURRENT_DIR_STAT_PATH "."
+#endif
+
+#if defined(__vita__) || defined(__SWITCH__)
+// FAT file systems do not reliably update the modification time of directories
+#define NO_DIR_CACHE
+#endif
+
 #define BASE_MAX_FILES 100
+#define BASE_NAMES_SIZE 4096
+#define MAX_CACHED_DIRS 4
+
+/**
+ * File names are stored one after the other in a single buffer, the arena.
+ */
+typedef struct {
+    char *names;
+    int size;
+    int used;
+} name_arena;
+
+/**
+ * A directory listing or index is up to date when the directory has not been modified since
+ * it was read. Modification times have a resolution of one second, so a directory that was read
+ * in the same second it was modified is read again the next time.
+ */
+typedef struct {
+    int is_valid;
+    time_t dir_modified;
+    time_t read_time;
+} dir_cache_info;
 
 static struct {
     dir_listing listing;
     int max_files;
+    int *name_offsets;
+    name_arena arena;
+    char extension[FILE_NAME_MAX];
+    dir_cache_info cache;
 } data;
 
-static void allocate_listing_files(int min, int max)
+/**
+ * Case-insensitive index of the files in a directory, used to correct the case of file names
+ */
+typedef struct {
+    char path[FILE_NAME_MAX];
+    dir_cache_info cache;
+    name_arena arena;
+    int *buckets;
+    int num_buckets;
+    int num_names;
+} dir_index;
+
+static struct {
+    dir_index dirs[MAX_CACHED_DIRS];
+    int next_to_replace;
+} case_index;
+
+static int add_name(name_arena *arena, const char *name)
 {
-    for (int i = min; i < max; i++) {
-        data.listing.files[i] = malloc(FILE_NAME_MAX * sizeof(char));
-        data.listing.files[i][0] = 0;
+    int length = (int) strlen(name) + 1;
+    if (arena->used + length > arena->size) {
+        int new_size = arena->size ? arena->size : BASE_NAMES_SIZE;
+        while (arena->used + length > new_size) {
+            new_size *= 2;
+        }
+        char *names = (char *) realloc(arena->names, new_size);
+        if (!names) {
+            return -1;
+        }
+        arena->names = names;
+        arena->size = new_size;
     }
+    int offset = arena->used;
+    memcpy(&arena->names[offset], name, length);
+    arena->used += length;
+    return offset;
 }
 
-static void clear_dir_listing(void)
+static int get_modified_time(const char *dir, time_t *modified)
 {
-    data.listing.num_files = 0;
-    if (data.max_files <= 0) {
-        data.listing.files = (char **) malloc(BASE_MAX_FILES * sizeof(char *));
-        allocate_listing_files(0, BASE_MAX_FILES);
-        data.max_files = BASE_MAX_FILES;
-    } else {
-        for (int i = 0; i < data.max_files; i++) {
-            data.listing.files[i][0] = 0;
-        }
+    struct stat dir_info;
+    if (stat(dir, &dir_info) == -1) {
+        return 0;
     }
+    *modified = dir_info.st_mtime;
+    return 1;
 }
 
-static void expand_dir_listing(void)
+static int is_cache_up_to_date(const dir_cache_info *cache, const char *dir)
 {
-    int old_max_files = data.max_files;
+#ifdef NO_DIR_CACHE
+    return 0;
+#else
+    time_t modified;
+    return cache->is_valid && get_modified_time(dir, &modified) &&
+        modified == cache->dir_modified && cache->read_time > modified;
+#endif
+}
 
-    data.max_files = 2 * old_max_files;
-    data.listing.files = (char **) realloc(data.listing.files, data.max_files * sizeof(char *));
-    allocate_listing_files(old_max_files, data.max_files);
+static void start_cache_read(dir_cache_info *cache, const char *dir)
+{
+    cache->read_time = time(NULL);
+    cache->is_valid = get_modified_time(dir, &cache->dir_modified);
+}
+
+static void expand_dir_listing(void)
+{
+    int new_max_files = data.max_files ? 2 * data.max_files : BASE_MAX_FILES;
+    char **files = (char **) realloc(data.listing.files, new_max_files * sizeof(char *));
+    int *offsets = (int *) realloc(data.name_offsets, new_max_files * sizeof(int));
+    if (files) {
+        data.listing.files = files;
+    }
+    if (offsets) {
+        data.name_offsets = offsets;
+    }
+    if (files && offsets) {
+        data.max_files = new_max_files;
+    }
 }
 
 static int compare_lower(const void *va, const void *vb)
@@ -103,55 +194,165 @@ static int compare_lower(const void *va, const void *vb)
     return string_compare_case_insensitive(*(const char**)va, *(const char**)vb);
 }
 
+static int is_regular_file(const char *name)
+{
+    struct stat file_info;
+    if (stat(name, &file_info) != -1) {
+        int m = file_info.st_mode;
+        if (S_ISDIR(m) || S_ISCHR(m) || S_ISBLK(m) || S_ISFIFO(m) || S_ISSOCK(m)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
 const dir_listing *dir_find_files_with_extension(const char *extension)
 {
-    clear_dir_listing();
+    if (strcmp(data.extension, extension) == 0 && is_cache_up_to_date(&data.cache, CURRENT_DIR_STAT_PATH)) {
+        return &data.listing;
+    }
+    data.listing.num_files = 0;
+    data.arena.used = 0;
+    strncpy(data.extension, extension, FILE_NAME_MAX - 1);
+    start_cache_read(&data.cache, CURRENT_DIR_STAT_PATH);
+
     fs_dir_type *d = fs_dir_open(CURRENT_DIR);
     if (!d) {
+        data.cache.is_valid = 0;
         return &data.listing;
     }
     fs_dir_entry *entry;
-    struct stat file_info;
     while ((entry = fs_dir_read(d))) {
         const char *name = dir_entry_name(entry);
-        if (stat(name, &file_info) != -1) {
-            int m = file_info.st_mode;
-            if (S_ISDIR(m) || S_ISCHR(m) || S_ISBLK(m) || S_ISFIFO(m) || S_ISSOCK(m)) {
-                continue;
-            }
+        // names that do not fit in FILE_NAME_MAX cannot be shown or opened by the game
+        if (strlen(name) >= FILE_NAME_MAX) {
+            continue;
+        }
+        // only the files with the right extension need to be checked on disk
+        if (!file_has_extension(name, extension) || !is_regular_file(name)) {
+            continue;
         }
-        if (file_has_extension(name, extension)) {
+        if (data.listing.num_files >= data.max_files) {
+            expand_dir_listing();
             if (data.listing.num_files >= data.max_files) {
-                expand_dir_listing();
+                break;
             }
-            strncpy(data.listing.files[data.listing.num_files], name, FILE_NAME_MAX);
-            data.listing.files[data.listing.num_files][FILE_NAME_MAX - 1] = 0;
-            ++data.listing.num_files;
         }
+        int offset = add_name(&data.arena, name);
+        if (offset < 0) {
+            break;
+        }
+        data.name_offsets[data.listing.num_files++] = offset;
     }
     fs_dir_close(d);
+    // the arena may have moved while it grew: point to the names only now
+    for (int i = 0; i < data.listing.num_files; i++) {
+        data.listing.files[i] = &data.arena.names[data.name_offsets[i]];
+    }
     qsort(data.listing.files, data.listing.num_files, sizeof(char*), compare_lower);
 
     return &data.listing;
 }
 
-static int correct_case(const char *dir, char *filename)
+static unsigned int hash_lower(const char *name)
 {
-    // Note: we do not use the _w* variants for Windows here, because the
-    // Windows filesystem is case insensitive and doesn't need corrections
+    unsigned int hash = 2166136261u;
+    for (; *name; name++) {
+        hash = (hash ^ (unsigned char) tolower(*name)) * 16777619u;
+    }
+    return hash;
+}
+
+static void add_to_index(dir_index *index, int offset)
+{
+    unsigned int bucket = hash_lower(&index->arena.names[offset]) & (index->num_buckets - 1);
+    while (index->buckets[bucket]) {
+        if (string_compare_case_insensitive(&index->arena.names[index->buckets[bucket] - 1],
+                &index->arena.names[offset]) == 0) {
+            // keep the first of the names that only differ in case, as readdir returned them
+            return;
+        }
+        bucket = (bucket + 1) & (index->num_buckets - 1);
+    }
+    index->buckets[bucket] = offset + 1;
+}
+
+static int read_index(dir_index *index, const char *dir)
+{
+    strncpy(index->path, dir, FILE_NAME_MAX - 1);
+    index->arena.used = 0;
+    index->num_names = 0;
+    start_cache_read(&index->cache, dir);
+
     DIR *d = opendir(dir);
     if (!d) {
+        index->cache.is_valid = 0;
         return 0;
     }
     struct dirent *entry;
     while ((entry = readdir(d))) {
-        if (string_compare_case_insensitive(entry->d_name, filename) == 0) {
-            strcpy(filename, entry->d_name);
-            closedir(d);
-            return 1;
+        if (add_name(&index->arena, entry->d_name) < 0) {
+            index->cache.is_valid = 0;
+            break;
         }
+        index->num_names++;
     }
     closedir(d);
+
+    int num_buckets = 16;
+    while (num_buckets < 2 * index->num_names) {
+        num_buckets *= 2;
+    }
+    if (num_buckets > index->num_buckets) {
+        int *buckets = (int *) realloc(index->buckets, num_buckets * sizeof(int));
+        if (!buckets) {
+            index->cache.is_valid = 0;
+            return 0;
+        }
+        index->buckets = buckets;
+        index->num_buckets = num_buckets;
+    }
+    memset(index->buckets, 0, index->num_buckets * sizeof(int));
+    for (int i = 0, offset = 0; i < index->num_names; i++) {
+        add_to_index(index, offset);
+        offset += (int) strlen(&index->arena.names[offset]) + 1;
+    }
+    return 1;
+}
+
+static dir_index *get_index(const char *dir)
+{
+    for (int i = 0; i < MAX_CACHED_DIRS; i++) {
+        dir_index *index = &case_index.dirs[i];
+        if (index->cache.is_valid && strcmp(index->path, dir) == 0) {
+            if (is_cache_up_to_date(&index->cache, dir) || read_index(index, dir)) {
+                return index;
+            }
+            return 0;
+        }
+    }
+    dir_index *index = &case_index.dirs[case_index.next_to_replace];
+    case_index.next_to_replace = (case_index.next_to_replace + 1) % MAX_CACHED_DIRS;
+    return read_index(index, dir) ? index : 0;
+}
+
+static int correct_case(const char *dir, char *filename)
+{
+    // Note: we do not use the _w* variants for Windows here, because the
+    // Windows filesystem is case insensitive and doesn't need corrections
+    dir_index *index = get_index(dir);
+    if (!index || !index->num_buckets) {
+        return 0;
+    }
+    unsigned int bucket = hash_lower(filename) & (index->num_buckets - 1);
+    while (index->buckets[bucket]) {
+        const char *name = &index->arena.names[index->buckets[bucket] - 1];
+        if (string_compare_case_insensitive(name, filename) == 0) {
+            strcpy(filename, name);
+            return 1;
+        }
+        bucket = (bucket + 1) & (index->num_buckets - 1);
+    }
     return 0;
 }
 
@@ -201,3 +402,25 @@ const char *dir_get_case_corrected_file(const char *filepath)
     }
     return 0;
 }
+
+int dir_create(const char *path)
+{
+    int result;
+#ifdef __vita__
+    char *resolved_path = vita_prepend_path(path);
+    result = mkdir(resolved_path, 0777);
+    free(resolved_path);
+#elif defined(_WIN32)
+    int size_needed = MultiByteToWideChar(CP_UTF8, 0, path, -1, NULL, 0);
+    wchar_t *wpath = (wchar_t *) malloc(sizeof(wchar_t) * size_needed);
+    if (!wpath) {
+        return 0;
+    }
+    MultiByteToWideChar(CP_UTF8, 0, path, -1, wpath, size_needed);
+    result = _wmkdir(wpath);
+    free(wpath);
+#else
+    result = mkdir(path, 0777);
+#endif
+    return result == 0 || errno == EEXIST;
+}
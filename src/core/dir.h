@@ -15,7 +15,8 @@ typedef struct {
 } dir_listing;
 
 /**
- * Finds files with the given extension
+ * Finds files with the given extension. Files with names of FILE_NAME_MAX
+ * characters or more are left out.
  * @param extension Extension of the files to find
  * @return Directory listing
  */
@@ -28,4 +29,11 @@ const dir_listing *dir_find_files_with_extension(const char *extension);
  */
 const char *dir_get_case_corrected_file(const char *filepath);
 
+/**
+ * Creates a directory; succeeds when the directory already exists
+ * @param path Directory to create
+ * @return Boolean true on success, false on failure
+ */
+int dir_create(const char *path);
+
 #endif // CORE_DIR_H
@@ -118,6 +118,7 @@ static struct {
     int is_editor;
     int fonts_enabled;
     int font_base_offset;
+    int letters_version;
 
     uint16_t group_image_ids[300];
     char bitmaps[100][200];
@@ -326,6 +327,7 @@ int image_load_climate(int climate_id, int is_editor)
     if (climate_id == data.current_climate && is_editor == data.is_editor) {
         return 1;
     }
+    data.letters_version++;
 
     const char *filename_bmp = is_editor ? EDITOR_GRAPHICS_555[climate_id] : MAIN_GRAPHICS_555[climate_id];
     const char *filename_idx = is_editor ? EDITOR_GRAPHICS_SG2[climate_id] : MAIN_GRAPHICS_SG2[climate_id];
@@ -464,6 +466,7 @@ static int load_traditional_chinese_fonts(void)
 
 int image_load_fonts(encoding_type encoding)
 {
+    data.letters_version++;
     if (encoding == ENCODING_CYRILLIC) {
         return load_cyrillic_fonts();
     } else if (encoding == ENCODING_TRADITIONAL_CHINESE) {
@@ -561,6 +564,11 @@ const image *image_letter(int letter_id)
     }
 }
 
+int image_letters_version(void)
+{
+    return data.letters_version;
+}
+
 const image *image_get_enemy(int id)
 {
     if (id >= 0 && id < ENEMY_ENTRIES) {
@@ -88,6 +88,12 @@ const image *image_get(int id);
  */
 const image *image_letter(int letter_id);
 
+/**
+ * Gets a number that changes whenever the letter images may have been reloaded
+ * @return Version of the letter images
+ */
+int image_letters_version(void);
+
 /**
  * Gets an enemy image by id
  * @param id Enemy image ID
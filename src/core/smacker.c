@@ -30,6 +30,9 @@
 #define BLOCK_VOID 2
 #define BLOCK_SOLID 3
 
+#define TREE8_LOOKUP_BITS 8
+#define TREE16_LOOKUP_BITS 12
+
 typedef struct {
     const uint8_t *data;
     int length;
@@ -43,9 +46,15 @@ typedef struct huffnode8_t {
     uint8_t value;
 } huffnode8;
 
+typedef struct {
+    huffnode8 *node;
+    int bits;
+} huffentry8;
+
 typedef struct hufftree8_t {
     huffnode8 nodes[512];
     int size;
+    huffentry8 lookup[1 << TREE8_LOOKUP_BITS];
 } hufftree8;
 
 typedef struct huffnode16_t {
@@ -54,8 +63,14 @@ typedef struct huffnode16_t {
     uint16_t value;
 } huffnode16;
 
+typedef struct {
+    huffnode16 *node;
+    int bits;
+} huffentry16;
+
 typedef struct hufftree16_t {
     huffnode16 *root;
+    huffentry16 *lookup;
     hufftree8 *low;
     hufftree8 *high;
     uint16_t escape_codes[3];
@@ -186,6 +201,31 @@ static inline uint8_t read_byte(bitstream *bs)
     return value;
 }
 
+static inline int peek_bits(const bitstream *bs, int num_bits)
+{
+    // bits past the end of the stream read as zero, like in read_bit()
+    uint32_t value = 0;
+    for (int i = 0; i < 3 && bs->index + i < bs->length; i++) {
+        value |= bs->data[bs->index + i] << (8 * i);
+    }
+    return (value >> bs->bit_index) & ((1 << num_bits) - 1);
+}
+
+static inline void skip_bits(bitstream *bs, int num_bits)
+{
+    int position = bs->index * 8 + bs->bit_index + num_bits;
+    if (position > bs->length * 8) {
+        // read_bit() does not move past the end of the stream
+        position = bs->length * 8;
+    }
+    bs->index = position / 8;
+    bs->bit_index = position % 8;
+}
+
+// Huffman codes are looked up in a table indexed by the next bits of the stream.
+// An entry holds the node reached after reading those bits: a leaf for short codes,
+// or the node from which to continue reading bit by bit for longer ones.
+
 // 8-bit huffman tree functions
 
 static huffnode8 *build_tree8_nodes(bitstream *bs, hufftree8 *tree)
@@ -202,6 +242,20 @@ static huffnode8 *build_tree8_nodes(bitstream *bs, hufftree8 *tree)
     return node;
 }
 
+static void build_tree8_lookup(hufftree8 *tree)
+{
+    for (int code = 0; code < 1 << TREE8_LOOKUP_BITS; code++) {
+        huffnode8 *node = &tree->nodes[0];
+        int bits = 0;
+        while (!node->is_leaf && bits < TREE8_LOOKUP_BITS) {
+            node = node->b[(code >> bits) & 1];
+            bits++;
+        }
+        tree->lookup[code].node = node;
+        tree->lookup[code].bits = bits;
+    }
+}
+
 static hufftree8 *create_tree8(bitstream *bs)
 {
     if (read_bit(bs)) {
@@ -216,6 +270,7 @@ static hufftree8 *create_tree8(bitstream *bs)
             free(tree);
             return NULL;
         }
+        build_tree8_lookup(tree);
         return tree;
     } else {
         log_info("SMK: WARN: no 8-bit tree found", 0, 0);
@@ -230,7 +285,9 @@ static void free_tree8(hufftree8 *tree)
 
 static uint8_t lookup_tree8(bitstream *bs, hufftree8 *tree)
 {
-    huffnode8 *node = &tree->nodes[0];
+    const huffentry8 *entry = &tree->lookup[peek_bits(bs, TREE8_LOOKUP_BITS)];
+    skip_bits(bs, entry->bits);
+    huffnode8 *node = entry->node;
     while (!node->is_leaf) {
         node = node->b[read_bit(bs)];
     }
@@ -263,6 +320,7 @@ static void free_tree16(hufftree16 *tree)
         }
     }
     free_node16(tree->root);
+    free(tree->lookup);
     free_tree8(tree->low);
     free_tree8(tree->high);
     free(tree);
@@ -304,6 +362,26 @@ static huffnode16 *build_tree16_nodes(bitstream *bs, hufftree16 *tree)
     return node;
 }
 
+static int build_tree16_lookup(hufftree16 *tree)
+{
+    tree->lookup = (huffentry16 *) malloc((1 << TREE16_LOOKUP_BITS) * sizeof(huffentry16));
+    if (!tree->lookup) {
+        log_error("SMK: no memory for 16-bit tree lookup", 0, 0);
+        return 0;
+    }
+    for (int code = 0; code < 1 << TREE16_LOOKUP_BITS; code++) {
+        huffnode16 *node = tree->root;
+        int bits = 0;
+        while (!node->is_leaf && bits < TREE16_LOOKUP_BITS) {
+            node = node->b[(code >> bits) & 1];
+            bits++;
+        }
+        tree->lookup[code].node = node;
+        tree->lookup[code].bits = bits;
+    }
+    return 1;
+}
+
 static hufftree16 *create_tree16(bitstream *bs, hufftree8 *low, hufftree8 *high)
 {
     hufftree16 *tree = (hufftree16 *) clear_malloc(sizeof(hufftree16));
@@ -336,6 +414,10 @@ static hufftree16 *create_tree16(bitstream *bs, hufftree8 *low, hufftree8 *high)
             tree->escape_nodes[i]->value = 0;
         }
     }
+    if (!build_tree16_lookup(tree)) {
+        free_tree16(tree);
+        return NULL;
+    }
     return tree;
 }
 
@@ -353,7 +435,9 @@ static uint16_t lookup_tree16(bitstream *bs, hufftree16 *tree)
     if (!tree) {
         return 0;
     }
-    huffnode16 *node = tree->root;
+    const huffentry16 *entry = &tree->lookup[peek_bits(bs, TREE16_LOOKUP_BITS)];
+    skip_bits(bs, entry->bits);
+    huffnode16 *node = entry->node;
     while (!node->is_leaf) {
         node = node->b[read_bit(bs)];
     }
@@ -3,6 +3,7 @@
 #include "city/entertainment.h"
 #include "city/figures.h"
 #include "figure/figure.h"
+#include "figure/intent.h"
 #include "figuretype/animal.h"
 #include "figuretype/cartpusher.h"
 #include "figuretype/crime.h"
@@ -108,11 +109,17 @@ static void (*figure_action_callbacks[])(figure *f) = {
     figure_nobody_action
 }; //80
 
+/**
+ * Figure actions run one after the other, in order of id: nearly every action changes
+ * state that later figures read in the same tick or draws from the shared random generator.
+ * Only the intents, which read the map and the figure itself, are worked out beforehand.
+ */
 void figure_action_handle(void)
 {
     city_figures_reset();
     city_entertainment_set_hippodrome_has_race(0);
-    for (int i = 1; i < MAX_FIGURES; i++) {
+    figure_intent_compute();
+    for (int i = figure_next_live_id(0); i; i = figure_next_live_id(i)) {
         figure *f = figure_get(i);
         if (f->state) {
             if (f->targeted_by_figure_id) {
@@ -130,4 +137,5 @@ void figure_action_handle(void)
             }
         }
     }
+    figure_intent_finish();
 }
@@ -12,16 +12,54 @@
 
 #include <string.h>
 
+#define LIVE_BITS 32
+
+/**
+ * Next to the figures, a bit set of the figures whose state is set is kept, so that
+ * loops over all figures only need to visit the records of the figures that exist.
+ */
 static struct {
     int created_sequence;
     figure figures[MAX_FIGURES];
+    uint32_t live[(MAX_FIGURES + LIVE_BITS - 1) / LIVE_BITS];
 } data = {0};
 
+static void set_live(int id, int live)
+{
+    if (live) {
+        data.live[id / LIVE_BITS] |= 1u << (id % LIVE_BITS);
+    } else {
+        data.live[id / LIVE_BITS] &= ~(1u << (id % LIVE_BITS));
+    }
+}
+
 figure *figure_get(int id)
 {
     return &data.figures[id];
 }
 
+int figure_next_live_id(int id)
+{
+    for (id++; id < MAX_FIGURES; id++) {
+        uint32_t bits = data.live[id / LIVE_BITS] >> (id % LIVE_BITS);
+        if (!bits) {
+            id |= LIVE_BITS - 1;
+            continue;
+        }
+        while (!(bits & 1)) {
+            bits >>= 1;
+            id++;
+        }
+        return id < MAX_FIGURES ? id : 0;
+    }
+    return 0;
+}
+
+int figure_next_created_sequence(void)
+{
+    return data.created_sequence;
+}
+
 figure *figure_create(figure_type type, int x, int y, direction_type dir)
 {
     int id = 0;
@@ -36,6 +74,7 @@ figure *figure_create(figure_type type, int x, int y, direction_type dir)
     }
     figure *f = &data.figures[id];
     f->state = FIGURE_STATE_ALIVE;
+    set_live(id, 1);
     f->faction_id = 1;
     f->type = type;
     f->use_cross_country = 0;
@@ -112,6 +151,7 @@ void figure_delete(figure *f)
     int figure_id = f->id;
     memset(f, 0, sizeof(figure));
     f->id = figure_id;
+    set_live(figure_id, 0);
 }
 
 int figure_is_dead(const figure *f)
@@ -140,6 +180,7 @@ void figure_init_scenario(void)
         memset(&data.figures[i], 0, sizeof(figure));
         data.figures[i].id = i;
     }
+    memset(data.live, 0, sizeof(data.live));
     data.created_sequence = 0;
 }
 
@@ -359,5 +400,6 @@ void figure_load_state(buffer *list, buffer *seq)
     for (int i = 0; i < MAX_FIGURES; i++) {
         figure_load(list, &data.figures[i]);
         data.figures[i].id = i;
+        set_live(i, i && data.figures[i].state);
     }
 }
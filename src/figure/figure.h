@@ -118,6 +118,14 @@ typedef struct {
 
 figure *figure_get(int id);
 
+/**
+ * Returns the next figure after the given one that is alive or dead but not yet
+ * removed, in order of id
+ * @param id Figure id to start after, 0 for the first figure
+ * @return Figure id, or 0 if there are no more figures
+ */
+int figure_next_live_id(int id);
+
 /**
  * Creates a figure
  * @param type Figure type
@@ -130,6 +138,12 @@ figure *figure_create(figure_type type, int x, int y, direction_type dir);
 
 void figure_delete(figure *f);
 
+/**
+ * Gets the sequence number the next created figure gets: it goes up by one for every figure
+ * @return Sequence number
+ */
+int figure_next_created_sequence(void);
+
 int figure_is_dead(const figure *f);
 
 int figure_is_enemy(const figure *f);
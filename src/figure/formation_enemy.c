@@ -348,7 +348,7 @@ static void mars_kill_enemies(void)
         return;
     }
     int grid_offset = 0;
-    for (int i = 1; i < MAX_FIGURES && to_kill > 0; i++) {
+    for (int i = figure_next_live_id(0); i && to_kill > 0; i = figure_next_live_id(i)) {
         figure *f = figure_get(i);
         if (f->state != FIGURE_STATE_ALIVE) {
             continue;
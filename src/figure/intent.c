@@ -0,0 +1,385 @@
+#include "intent.h"
+
+#include "figure/movement.h"
+#include "figure/route.h"
+#include "game/system.h"
+#include "map/building.h"
+#include "map/grid.h"
+#include "map/road_access.h"
+#include "map/terrain.h"
+
+#define MAX_THREADS 8
+#define DEFAULT_MIN_FIGURES_PER_THREAD 64
+#define MAX_TICKS_PER_ACTION 2
+
+typedef enum {
+    INTENT_NONE = 0,
+    INTENT_CROSS_COUNTRY = 1,
+    INTENT_ROAM = 2,
+    INTENT_ROUTE = 3
+} intent_type;
+
+typedef struct {
+    short x;
+    short y;
+    short destination_x;
+    short destination_y;
+    short delta_x;
+    short delta_y;
+    short delta_xy;
+    unsigned char direction;
+    unsigned char missile_damage;
+} cross_country_state;
+
+/**
+ * The fields before "result" are what the intent was worked out from,
+ * the fields after it are the outcome.
+ */
+typedef struct {
+    intent_type type;
+    unsigned short created_sequence;
+    int grid_offset;
+    int num_ticks;
+    int direction;
+    unsigned char is_boat;
+    unsigned char terrain_usage;
+    cross_country_state cross_country;
+    // result
+    cross_country_state cross_country_after;
+    int is_at_destination;
+    int road_tiles[8];
+    int adjacent_road_tiles;
+    int diagonal_road_tiles;
+    int is_blocked;
+} intent;
+
+typedef struct {
+    int start;
+    int end;
+} id_range;
+
+/**
+ * Worker threads stay around between ticks and wait for their range of figures
+ */
+typedef struct {
+    void *thread;
+    void *start;
+    id_range range;
+} worker;
+
+static struct {
+    worker workers[MAX_THREADS];
+    int num_workers;
+    void *done;
+    int quit;
+} pool;
+
+static struct {
+    int threads;
+    int min_figures_per_thread;
+    int active;
+    unsigned int terrain_changes;
+    unsigned int building_changes;
+    int ids[MAX_FIGURES];
+    int num_ids;
+    intent intents[MAX_FIGURES];
+} data = {0, DEFAULT_MIN_FIGURES_PER_THREAD};
+
+static void stop_workers(void)
+{
+    pool.quit = 1;
+    for (int i = 0; i < pool.num_workers; i++) {
+        system_post_semaphore(pool.workers[i].start);
+    }
+    for (int i = 0; i < pool.num_workers; i++) {
+        system_wait_thread(pool.workers[i].thread);
+        system_destroy_semaphore(pool.workers[i].start);
+    }
+    system_destroy_semaphore(pool.done);
+    pool.done = 0;
+    pool.num_workers = 0;
+    pool.quit = 0;
+}
+
+void figure_intent_set_threads(int threads)
+{
+    threads = threads < 0 ? 0 : threads > MAX_THREADS ? MAX_THREADS : threads;
+    if (threads != data.threads) {
+        stop_workers();
+    }
+    data.threads = threads;
+}
+
+void figure_intent_set_min_figures_per_thread(int min_figures)
+{
+    data.min_figures_per_thread = min_figures > 0 ? min_figures : DEFAULT_MIN_FIGURES_PER_THREAD;
+}
+
+static void get_cross_country_state(const figure *f, cross_country_state *state)
+{
+    state->x = f->cross_country_x;
+    state->y = f->cross_country_y;
+    state->destination_x = f->cc_destination_x;
+    state->destination_y = f->cc_destination_y;
+    state->delta_x = f->cc_delta_x;
+    state->delta_y = f->cc_delta_y;
+    state->delta_xy = f->cc_delta_xy;
+    state->direction = f->cc_direction;
+    state->missile_damage = f->missile_damage;
+}
+
+static void set_cross_country_state(figure *f, const cross_country_state *state)
+{
+    f->cross_country_x = state->x;
+    f->cross_country_y = state->y;
+    f->cc_destination_x = state->destination_x;
+    f->cc_destination_y = state->destination_y;
+    f->cc_delta_x = state->delta_x;
+    f->cc_delta_y = state->delta_y;
+    f->cc_delta_xy = state->delta_xy;
+    f->cc_direction = state->direction;
+    f->missile_damage = state->missile_damage;
+}
+
+static int is_same_cross_country_state(const cross_country_state *a, const cross_country_state *b)
+{
+    return a->x == b->x && a->y == b->y &&
+        a->destination_x == b->destination_x && a->destination_y == b->destination_y &&
+        a->delta_x == b->delta_x && a->delta_y == b->delta_y && a->delta_xy == b->delta_xy &&
+        a->direction == b->direction && a->missile_damage == b->missile_damage;
+}
+
+static int cross_country_ticks(const figure *f)
+{
+    switch (f->type) {
+        case FIGURE_ARROW:
+        case FIGURE_BOLT:
+        case FIGURE_JAVELIN:
+        case FIGURE_SPEAR:
+            return 4;
+        case FIGURE_EXPLOSION:
+            return f->speed_multiplier;
+        case FIGURE_FISH_GULLS:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+static int walks_route_as_animal(const figure *f)
+{
+    switch (f->type) {
+        case FIGURE_FLOTSAM:
+        case FIGURE_SHEEP:
+        case FIGURE_WOLF:
+        case FIGURE_ZEBRA:
+            return f->is_boat || f->terrain_usage != TERRAIN_USAGE_ENEMY;
+        default:
+            return 0;
+    }
+}
+
+static int is_near_end_of_tile(const figure *f)
+{
+    return f->progress_on_tile + MAX_TICKS_PER_ACTION >= 15;
+}
+
+static intent_type get_intent_type(const figure *f)
+{
+    if (cross_country_ticks(f)) {
+        return INTENT_CROSS_COUNTRY;
+    }
+    if (f->roam_choose_destination && is_near_end_of_tile(f)) {
+        return INTENT_ROAM;
+    }
+    if (walks_route_as_animal(f) && f->routing_path_id > 0 &&
+        f->routing_path_current_tile < f->routing_path_length && is_near_end_of_tile(f)) {
+        return INTENT_ROUTE;
+    }
+    return INTENT_NONE;
+}
+
+static void compute_intent(const figure *f, intent *in)
+{
+    in->created_sequence = f->created_sequence;
+    in->grid_offset = f->grid_offset;
+    switch (in->type) {
+        case INTENT_CROSS_COUNTRY: {
+            figure moved = *f;
+            in->num_ticks = cross_country_ticks(f);
+            get_cross_country_state(f, &in->cross_country);
+            in->is_at_destination = figure_movement_cross_country_ticks(&moved, in->num_ticks);
+            get_cross_country_state(&moved, &in->cross_country_after);
+            break;
+        }
+        case INTENT_ROAM:
+            in->adjacent_road_tiles = map_get_adjacent_road_tiles_for_roaming(f->grid_offset, in->road_tiles);
+            in->diagonal_road_tiles = map_get_diagonal_road_tiles_for_roaming(f->grid_offset, in->road_tiles);
+            break;
+        case INTENT_ROUTE:
+            in->direction = figure_route_get_direction(f->routing_path_id, f->routing_path_current_tile);
+            in->is_boat = f->is_boat;
+            in->terrain_usage = f->terrain_usage;
+            in->is_blocked = in->direction < 8 && figure_movement_is_route_tile_blocked(f,
+                f->grid_offset + map_grid_direction_delta(in->direction), 0);
+            break;
+        default:
+            break;
+    }
+}
+
+static void compute_intents(const id_range *range)
+{
+    for (int i = range->start; i < range->end; i++) {
+        int id = data.ids[i];
+        compute_intent(figure_get(id), &data.intents[id]);
+    }
+}
+
+static int run_worker(void *arg)
+{
+    worker *w = arg;
+    while (1) {
+        system_wait_semaphore(w->start);
+        if (pool.quit) {
+            return 0;
+        }
+        compute_intents(&w->range);
+        system_post_semaphore(pool.done);
+    }
+}
+
+/**
+ * Starts the workers on first use; when threads cannot be started, fewer workers are used
+ */
+static void start_workers(void)
+{
+    if (pool.done || data.threads <= 1) {
+        return;
+    }
+    pool.done = system_create_semaphore(0);
+    if (!pool.done) {
+        return;
+    }
+    while (pool.num_workers < data.threads - 1) {
+        worker *w = &pool.workers[pool.num_workers];
+        w->start = system_create_semaphore(0);
+        if (!w->start) {
+            break;
+        }
+        w->thread = system_create_thread(run_worker, w);
+        if (!w->thread) {
+            system_destroy_semaphore(w->start);
+            break;
+        }
+        pool.num_workers++;
+    }
+}
+
+void figure_intent_compute(void)
+{
+    data.active = 0;
+    if (!data.threads) {
+        return;
+    }
+    data.num_ids = 0;
+    for (int i = figure_next_live_id(0); i; i = figure_next_live_id(i)) {
+        const figure *f = figure_get(i);
+        intent_type type = f->state == FIGURE_STATE_ALIVE ? get_intent_type(f) : INTENT_NONE;
+        if (type != INTENT_NONE) {
+            data.intents[i].type = type;
+            data.ids[data.num_ids++] = i;
+        }
+    }
+    start_workers();
+    int threads = data.num_ids / data.min_figures_per_thread;
+    if (threads > pool.num_workers + 1) {
+        threads = pool.num_workers + 1;
+    } else if (threads < 1) {
+        threads = 1;
+    }
+    // the game thread takes the first range, the workers the others
+    for (int t = 1; t < threads; t++) {
+        worker *w = &pool.workers[t - 1];
+        w->range.start = data.num_ids * t / threads;
+        w->range.end = data.num_ids * (t + 1) / threads;
+        system_post_semaphore(w->start);
+    }
+    id_range first = {0, data.num_ids / threads};
+    compute_intents(&first);
+    for (int t = 1; t < threads; t++) {
+        system_wait_semaphore(pool.done);
+    }
+    data.terrain_changes = map_terrain_changes();
+    data.building_changes = map_building_changes();
+    data.active = 1;
+}
+
+void figure_intent_finish(void)
+{
+    for (int i = 0; i < data.num_ids; i++) {
+        data.intents[data.ids[i]].type = INTENT_NONE;
+    }
+    data.num_ids = 0;
+    data.active = 0;
+}
+
+static intent *take_intent(const figure *f, intent_type type)
+{
+    if (!data.active) {
+        return 0;
+    }
+    intent *in = &data.intents[f->id];
+    if (in->type != type || in->created_sequence != f->created_sequence) {
+        return 0;
+    }
+    in->type = INTENT_NONE;
+    return in;
+}
+
+static int is_map_unchanged(void)
+{
+    return map_terrain_changes() == data.terrain_changes && map_building_changes() == data.building_changes;
+}
+
+int figure_intent_use_cross_country(figure *f, int num_ticks, int *is_at_destination)
+{
+    intent *in = take_intent(f, INTENT_CROSS_COUNTRY);
+    if (!in || in->num_ticks != num_ticks) {
+        return 0;
+    }
+    cross_country_state state;
+    get_cross_country_state(f, &state);
+    if (!is_same_cross_country_state(&state, &in->cross_country)) {
+        return 0;
+    }
+    set_cross_country_state(f, &in->cross_country_after);
+    *is_at_destination = in->is_at_destination;
+    return 1;
+}
+
+int figure_intent_use_road_tiles(const figure *f, int *road_tiles, int *diagonal_road_tiles)
+{
+    intent *in = take_intent(f, INTENT_ROAM);
+    if (!in || in->grid_offset != f->grid_offset || !is_map_unchanged()) {
+        return -1;
+    }
+    for (int i = 0; i < 8; i++) {
+        road_tiles[i] = in->road_tiles[i];
+    }
+    *diagonal_road_tiles = in->diagonal_road_tiles;
+    return in->adjacent_road_tiles;
+}
+
+int figure_intent_use_route_tile(figure *f, int roaming_enabled)
+{
+    intent *in = take_intent(f, INTENT_ROUTE);
+    if (!in || roaming_enabled || in->grid_offset != f->grid_offset || in->direction != f->direction ||
+        in->is_boat != f->is_boat || in->terrain_usage != f->terrain_usage || !is_map_unchanged()) {
+        return 0;
+    }
+    if (in->is_blocked) {
+        f->direction = DIR_FIGURE_REROUTE;
+    }
+    return 1;
+}
@@ -0,0 +1,67 @@
+#ifndef FIGURE_INTENT_H
+#define FIGURE_INTENT_H
+
+#include "figure/figure.h"
+
+/**
+ * @file
+ * Intents are parts of the movement of missiles, animals, flotsam and roaming walkers
+ * that are worked out for all these figures before the figure actions run, optionally
+ * on several threads. Working out an intent only reads the map and the figure itself.
+ * The figure action uses the intent only when the figure and the map are still as they
+ * were when the intent was worked out, and else does the work itself, so the game
+ * plays exactly the same with and without intents.
+ */
+
+/**
+ * Sets the number of threads that work out intents
+ * @param threads Number of threads: 0 to not use intents (default), 1 to work them out
+ *                on the game thread. Worker threads are started when intents are first
+ *                worked out and are kept until the number of threads changes.
+ */
+void figure_intent_set_threads(int threads);
+
+/**
+ * Sets how many figures with an intent each thread needs at least before the work is split
+ * over more threads
+ * @param min_figures Minimum number of figures per thread, 0 for the default
+ */
+void figure_intent_set_min_figures_per_thread(int min_figures);
+
+/**
+ * Works out the intents of all figures, called before the figure actions run
+ */
+void figure_intent_compute(void);
+
+/**
+ * Discards the intents that were not used, called after the figure actions have run
+ */
+void figure_intent_finish(void);
+
+/**
+ * Moves a figure cross-country using its intent
+ * @param f Figure
+ * @param num_ticks Number of ticks to move
+ * @param is_at_destination Set to whether the figure is at its destination
+ * @return 1 if the intent was used, 0 if the figure has to be moved as usual
+ */
+int figure_intent_use_cross_country(figure *f, int num_ticks, int *is_at_destination);
+
+/**
+ * Gets the road tiles around a roaming figure from its intent
+ * @param f Figure
+ * @param road_tiles Set to the road tiles as in map_get_adjacent_road_tiles_for_roaming
+ * @param diagonal_road_tiles Set to the diagonal road tiles as in map_get_diagonal_road_tiles_for_roaming
+ * @return Number of adjacent road tiles, or -1 if there is no valid intent
+ */
+int figure_intent_use_road_tiles(const figure *f, int *road_tiles, int *diagonal_road_tiles);
+
+/**
+ * Checks the next tile on the route of a figure using its intent
+ * @param f Figure
+ * @param roaming_enabled Whether the figure is roaming
+ * @return 1 if the intent was used, 0 if the tile has to be checked as usual
+ */
+int figure_intent_use_route_tile(figure *f, int roaming_enabled);
+
+#endif // FIGURE_INTENT_H
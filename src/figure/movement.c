@@ -4,6 +4,7 @@
 #include "building/destruction.h"
 #include "core/calc.h"
 #include "figure/combat.h"
+#include "figure/intent.h"
 #include "figure/route.h"
 #include "figure/service.h"
 #include "game/time.h"
@@ -149,17 +150,42 @@ static void set_next_route_tile_direction(figure *f)
     }
 }
 
+int figure_movement_is_route_tile_blocked(const figure *f, int target_grid_offset, int roaming_enabled)
+{
+    if (f->is_boat) {
+        return !map_terrain_is(target_grid_offset, TERRAIN_WATER);
+    } else if (f->terrain_usage == TERRAIN_USAGE_WALLS) {
+        return !map_routing_is_wall_passable(target_grid_offset);
+    } else if (map_terrain_is(target_grid_offset, TERRAIN_ROAD | TERRAIN_ACCESS_RAMP)) {
+        if (roaming_enabled && map_terrain_is(target_grid_offset, TERRAIN_BUILDING)) {
+            int type = building_get(map_building_at(target_grid_offset))->type;
+            // do not allow roaming through gatehouse or roadblock
+            return type == BUILDING_GATEHOUSE || type == BUILDING_ROADBLOCK;
+        }
+    } else if (map_terrain_is(target_grid_offset, TERRAIN_BUILDING)) {
+        int type = building_get(map_building_at(target_grid_offset))->type;
+        switch (type) {
+            case BUILDING_WAREHOUSE:
+            case BUILDING_GRANARY:
+            case BUILDING_TRIUMPHAL_ARCH:
+            case BUILDING_FORT_GROUND:
+                return 0; // OK to walk
+            default:
+                return 1;
+        }
+    } else if (map_terrain_is(target_grid_offset, TERRAIN_IMPASSABLE)) {
+        return 1;
+    }
+    return 0;
+}
+
 static void advance_route_tile(figure *f, int roaming_enabled)
 {
     if (f->direction >= 8) {
         return;
     }
     int target_grid_offset = f->grid_offset + map_grid_direction_delta(f->direction);
-    if (f->is_boat) {
-        if (!map_terrain_is(target_grid_offset, TERRAIN_WATER)) {
-            f->direction = DIR_FIGURE_REROUTE;
-        }
-    } else if (f->terrain_usage == TERRAIN_USAGE_ENEMY) {
+    if (f->terrain_usage == TERRAIN_USAGE_ENEMY && !f->is_boat) {
         if (!map_routing_noncitizen_is_passable(target_grid_offset)) {
             f->direction = DIR_FIGURE_REROUTE;
         } else if (map_routing_is_destroyable(target_grid_offset)) {
@@ -191,33 +217,7 @@ static void advance_route_tile(figure *f, int roaming_enabled)
                 }
             }
         }
-    } else if (f->terrain_usage == TERRAIN_USAGE_WALLS) {
-        if (!map_routing_is_wall_passable(target_grid_offset)) {
-            f->direction = DIR_FIGURE_REROUTE;
-        }
-    } else if (map_terrain_is(target_grid_offset, TERRAIN_ROAD | TERRAIN_ACCESS_RAMP)) {
-        if (roaming_enabled && map_terrain_is(target_grid_offset, TERRAIN_BUILDING)) {
-            if (building_get(map_building_at(target_grid_offset))->type == BUILDING_GATEHOUSE) {
-                // do not allow roaming through gatehouse
-                f->direction = DIR_FIGURE_REROUTE;
-            }
-            if (building_get(map_building_at(target_grid_offset))->type == BUILDING_ROADBLOCK) {
-                // do not allow roaming through roadblock
-                f->direction = DIR_FIGURE_REROUTE;
-            }
-        }
-    } else if (map_terrain_is(target_grid_offset, TERRAIN_BUILDING)) {
-        int type = building_get(map_building_at(target_grid_offset))->type;
-        switch (type) {
-            case BUILDING_WAREHOUSE:
-            case BUILDING_GRANARY:
-            case BUILDING_TRIUMPHAL_ARCH:
-            case BUILDING_FORT_GROUND:
-                break; // OK to walk
-            default:
-                f->direction = DIR_FIGURE_REROUTE;
-        }
-    } else if (map_terrain_is(target_grid_offset, TERRAIN_IMPASSABLE)) {
+    } else if (figure_movement_is_route_tile_blocked(f, target_grid_offset, roaming_enabled)) {
         f->direction = DIR_FIGURE_REROUTE;
     }
 }
@@ -236,7 +236,9 @@ static void walk_ticks(figure *f, int num_ticks, int roaming_enabled)
                 figure_route_add(f);
             }
             set_next_route_tile_direction(f);
-            advance_route_tile(f, roaming_enabled);
+            if (!figure_intent_use_route_tile(f, roaming_enabled)) {
+                advance_route_tile(f, roaming_enabled);
+            }
             if (f->direction >= 8) {
                 break;
             }
@@ -362,6 +364,17 @@ void figure_movement_follow_ticks(figure *f, int num_ticks)
     }
 }
 
+static int get_road_tiles_for_roaming(const figure *f, int *road_tiles, int *diagonal_road_tiles)
+{
+    int adjacent_road_tiles = figure_intent_use_road_tiles(f, road_tiles, diagonal_road_tiles);
+    if (adjacent_road_tiles < 0) {
+        adjacent_road_tiles = map_get_adjacent_road_tiles_for_roaming(f->grid_offset, road_tiles);
+        *diagonal_road_tiles = adjacent_road_tiles >= 3 ?
+            map_get_diagonal_road_tiles_for_roaming(f->grid_offset, road_tiles) : 0;
+    }
+    return adjacent_road_tiles;
+}
+
 void figure_movement_roam_ticks(figure *f, int num_ticks)
 {
     if (f->roam_choose_destination == 0) {
@@ -393,8 +406,9 @@ void figure_movement_roam_ticks(figure *f, int num_ticks)
                 return;
             }
             int road_tiles[8];
-            int adjacent_road_tiles = map_get_adjacent_road_tiles_for_roaming(f->grid_offset, road_tiles);
-            if (adjacent_road_tiles == 3 && map_get_diagonal_road_tiles_for_roaming(f->grid_offset, road_tiles) >= 5) {
+            int diagonal_road_tiles;
+            int adjacent_road_tiles = get_road_tiles_for_roaming(f, road_tiles, &diagonal_road_tiles);
+            if (adjacent_road_tiles == 3 && diagonal_road_tiles >= 5) {
                 // go in the straight direction of a double-wide road
                 adjacent_road_tiles = 2;
                 if (came_from_direction == DIR_0_TOP || came_from_direction == DIR_4_BOTTOM) {
@@ -411,7 +425,7 @@ void figure_movement_roam_ticks(figure *f, int num_ticks)
                     }
                 }
             }
-            if (adjacent_road_tiles == 4 && map_get_diagonal_road_tiles_for_roaming(f->grid_offset, road_tiles) >= 8) {
+            if (adjacent_road_tiles == 4 && diagonal_road_tiles >= 8) {
                 // go straight on when all surrounding tiles are road
                 adjacent_road_tiles = 2;
                 if (came_from_direction == DIR_0_TOP || came_from_direction == DIR_4_BOTTOM) {
@@ -583,10 +597,8 @@ static void cross_country_advance(figure *f)
     }
 }
 
-int figure_movement_move_ticks_cross_country(figure *f, int num_ticks)
+int figure_movement_cross_country_ticks(figure *f, int num_ticks)
 {
-    map_figure_delete(f);
-    int is_at_destination = 0;
     while (num_ticks > 0) {
         num_ticks--;
         if (f->missile_damage > 0) {
@@ -595,11 +607,20 @@ int figure_movement_move_ticks_cross_country(figure *f, int num_ticks)
             f->missile_damage = 0;
         }
         if (f->cc_delta_x + f->cc_delta_y <= 0) {
-            is_at_destination = 1;
-            break;
+            return 1;
         }
         cross_country_advance(f);
     }
+    return 0;
+}
+
+int figure_movement_move_ticks_cross_country(figure *f, int num_ticks)
+{
+    map_figure_delete(f);
+    int is_at_destination;
+    if (!figure_intent_use_cross_country(f, num_ticks, &is_at_destination)) {
+        is_at_destination = figure_movement_cross_country_ticks(f, num_ticks);
+    }
     f->x = f->cross_country_x / 15;
     f->y = f->cross_country_y / 15;
     f->grid_offset = map_grid_offset(f->x, f->y);
@@ -15,6 +15,15 @@ void figure_movement_follow_ticks(figure *f, int num_ticks);
 
 void figure_movement_advance_attack(figure *f);
 
+/**
+ * Checks whether a figure walking a route may not enter the tile, for all figures except enemies
+ * @param f Figure
+ * @param target_grid_offset Tile the figure is about to enter
+ * @param roaming_enabled Whether the figure is roaming
+ * @return 1 if the figure has to reroute, 0 otherwise
+ */
+int figure_movement_is_route_tile_blocked(const figure *f, int target_grid_offset, int roaming_enabled);
+
 
 void figure_movement_set_cross_country_direction(figure *f, int x_src, int y_src, int x_dst, int y_dst, int is_missile);
 
@@ -22,6 +31,14 @@ void figure_movement_set_cross_country_destination(figure *f, int x_dst, int y_d
 
 int figure_movement_move_ticks_cross_country(figure *f, int num_ticks);
 
+/**
+ * Advances the cross-country position of the figure without moving it on the map
+ * @param f Figure
+ * @param num_ticks Ticks to advance
+ * @return 1 if the figure is at its destination, 0 otherwise
+ */
+int figure_movement_cross_country_ticks(figure *f, int num_ticks);
+
 int figure_movement_can_launch_cross_country_missile(int x_src, int y_src, int x_dst, int y_dst);
 
 #endif // FIGURE_MOVEMENT_H
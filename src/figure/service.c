@@ -7,25 +7,20 @@
 #include "game/resource.h"
 #include "map/building.h"
 #include "map/grid.h"
+#include "map/house_service.h"
 
 #define MAX_COVERAGE 96
 
 static int provide_culture(int x, int y, void (*callback)(building *))
 {
     int serviced = 0;
-    int x_min, y_min, x_max, y_max;
-    map_grid_get_area(x, y, 1, 2, &x_min, &y_min, &x_max, &y_max);
-    for (int yy = y_min; yy <= y_max; yy++) {
-        for (int xx = x_min; xx <= x_max; xx++) {
-            int grid_offset = map_grid_offset(xx, yy);
-            int building_id = map_building_at(grid_offset);
-            if (building_id) {
-                building *b = building_get(building_id);
-                if (b->house_size && b->house_population > 0) {
-                    callback(b);
-                    serviced++;
-                }
-            }
+    const uint16_t *houses;
+    int num_houses = map_house_service_houses_in_range(x, y, &houses);
+    for (int i = 0; i < num_houses; i++) {
+        building *b = building_get(houses[i]);
+        if (b->house_size && b->house_population > 0) {
+            callback(b);
+            serviced++;
         }
     }
     return serviced;
@@ -34,19 +29,13 @@ static int provide_culture(int x, int y, void (*callback)(building *))
 static int provide_entertainment(int x, int y, int shows, void (*callback)(building *, int))
 {
     int serviced = 0;
-    int x_min, y_min, x_max, y_max;
-    map_grid_get_area(x, y, 1, 2, &x_min, &y_min, &x_max, &y_max);
-    for (int yy = y_min; yy <= y_max; yy++) {
-        for (int xx = x_min; xx <= x_max; xx++) {
-            int grid_offset = map_grid_offset(xx, yy);
-            int building_id = map_building_at(grid_offset);
-            if (building_id) {
-                building *b = building_get(building_id);
-                if (b->house_size && b->house_population > 0) {
-                    callback(b, shows);
-                    serviced++;
-                }
-            }
+    const uint16_t *houses;
+    int num_houses = map_house_service_houses_in_range(x, y, &houses);
+    for (int i = 0; i < num_houses; i++) {
+        building *b = building_get(houses[i]);
+        if (b->house_size && b->house_population > 0) {
+            callback(b, shows);
+            serviced++;
         }
     }
     return serviced;
@@ -181,6 +170,21 @@ static int provide_service(int x, int y, int *data, void (*callback)(building *,
     return serviced;
 }
 
+static int provide_house_service(int x, int y, int *data, void (*callback)(building *, int *))
+{
+    int serviced = 0;
+    const uint16_t *houses;
+    int num_houses = map_house_service_houses_in_range(x, y, &houses);
+    for (int i = 0; i < num_houses; i++) {
+        building *b = building_get(houses[i]);
+        if (b->house_size && b->house_population > 0) {
+            callback(b, data);
+            serviced++;
+        }
+    }
+    return serviced;
+}
+
 static void engineer_coverage(building *b, int *max_damage_seen)
 {
     if (b->type == BUILDING_HIPPODROME) {
@@ -285,19 +289,13 @@ static int provide_market_goods(int market_building_id, int x, int y)
 {
     int serviced = 0;
     building *market = building_get(market_building_id);
-    int x_min, y_min, x_max, y_max;
-    map_grid_get_area(x, y, 1, 2, &x_min, &y_min, &x_max, &y_max);
-    for (int yy = y_min; yy <= y_max; yy++) {
-        for (int xx = x_min; xx <= x_max; xx++) {
-            int grid_offset = map_grid_offset(xx, yy);
-            int building_id = map_building_at(grid_offset);
-            if (building_id) {
-                building *b = building_get(building_id);
-                if (b->house_size && b->house_population > 0) {
-                    distribute_market_resources(b, market);
-                    serviced++;
-                }
-            }
+    const uint16_t *houses;
+    int num_houses = map_house_service_houses_in_range(x, y, &houses);
+    for (int i = 0; i < num_houses; i++) {
+        building *b = building_get(houses[i]);
+        if (b->house_size && b->house_population > 0) {
+            distribute_market_resources(b, market);
+            serviced++;
         }
     }
     return serviced;
@@ -327,7 +325,7 @@ int figure_service_provide_coverage(figure *f)
             break;
         case FIGURE_TAX_COLLECTOR: {
             int max_tax_rate = 0;
-            houses_serviced = provide_service(x, y, &max_tax_rate, tax_collector_coverage);
+            houses_serviced = provide_house_service(x, y, &max_tax_rate, tax_collector_coverage);
             f->min_max_seen = max_tax_rate;
             break;
         }
@@ -96,7 +96,7 @@ static int get_nearest_enemy(int x, int y, int *distance)
 {
     int min_enemy_id = 0;
     int min_dist = 10000;
-    for (int i = 1; i < MAX_FIGURES; i++) {
+    for (int i = figure_next_live_id(0); i; i = figure_next_live_id(i)) {
         figure *f = figure_get(i);
         if (f->state != FIGURE_STATE_ALIVE || f->targeted_by_figure_id) {
             continue;
@@ -36,7 +36,7 @@ void figure_create_flotsam(void)
     if (!scenario_map_has_river_entry() || !scenario_map_has_river_exit() || !scenario_map_has_flotsam()) {
         return;
     }
-    for (int i = 1; i < MAX_FIGURES; i++) {
+    for (int i = figure_next_live_id(0); i; i = figure_next_live_id(i)) {
         figure *f = figure_get(i);
         if (f->state && f->type == FIGURE_FLOTSAM) {
             figure_delete(f);
@@ -302,7 +302,7 @@ void figure_fishing_boat_action(figure *f)
 
 void figure_sink_all_ships(void)
 {
-    for (int i = 1; i < MAX_FIGURES; i++) {
+    for (int i = figure_next_live_id(0); i; i = figure_next_live_id(i)) {
         figure *f = figure_get(i);
         if (f->state != FIGURE_STATE_ALIVE) {
             continue;
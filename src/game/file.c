@@ -1,6 +1,7 @@
 #include "file.h"
 
 #include "building/construction.h"
+#include "building/figure.h"
 #include "building/granary.h"
 #include "building/maintenance.h"
 #include "building/menu.h"
@@ -30,6 +31,8 @@
 #include "game/animation.h"
 #include "game/difficulty.h"
 #include "game/file_io.h"
+#include "game/replay.h"
+#include "game/rewind.h"
 #include "game/settings.h"
 #include "game/state.h"
 #include "game/time.h"
@@ -54,6 +57,7 @@
 #include "map/sprite.h"
 #include "map/terrain.h"
 #include "map/tiles.h"
+#include "map/water_supply.h"
 #include "scenario/criteria.h"
 #include "scenario/demand_change.h"
 #include "scenario/distant_battle.h"
@@ -123,6 +127,8 @@ static void clear_scenario_data(void)
     map_elevation_clear();
     map_soldier_strength_clear();
     map_road_network_clear();
+    map_water_supply_clear();
+    building_figure_clear();
 
     map_image_context_init();
     map_random_init();
@@ -215,6 +221,8 @@ static void initialize_saved_game(void)
     city_view_init();
 
     map_routing_update_all();
+    map_water_supply_clear();
+    building_figure_clear();
 
     map_orientation_update_buildings();
     figure_route_clean();
@@ -240,6 +248,7 @@ static void initialize_saved_game(void)
     city_message_clear_scroll();
 
     game_state_unpause();
+    game_state_reset_turbo();
 }
 
 static int get_campaign_mission_offset(int mission_id)
@@ -277,7 +286,9 @@ static int start_scenario(const uint8_t *scenario_name, const char *scenario_fil
 {
     int mission = scenario_campaign_mission();
     int rank = scenario_campaign_rank();
+    game_replay_stop_recording();
     map_bookmarks_clear();
+    game_rewind_clear();
     if (scenario_is_custom()) {
         if (!load_custom_scenario(scenario_name, scenario_file)) {
             return 0;
@@ -303,6 +314,12 @@ static int start_scenario(const uint8_t *scenario_name, const char *scenario_fil
 
     building_menu_update();
     city_message_init_scenario();
+
+    const char *replay_start_file = game_replay_start_file();
+    if (replay_start_file && game_file_io_write_saved_game(replay_start_file)) {
+        // record on top of the saved game so that playback starts from exactly the same state
+        game_file_load_saved_game(replay_start_file);
+    }
     return 1;
 }
 
@@ -346,9 +363,12 @@ int game_file_load_scenario_data(const char *scenario_file)
 
 int game_file_load_saved_game(const char *filename)
 {
+    game_replay_stop_recording();
     if (!game_file_io_read_saved_game(filename, 0)) {
         return 0;
     }
+    game_rewind_clear();
+    game_replay_start_recording();
     initialize_saved_game();
     building_storage_reset_building_ids();
 
@@ -356,6 +376,15 @@ int game_file_load_saved_game(const char *filename)
     return 1;
 }
 
+void game_file_load_saved_game_from_memory(const uint8_t *data)
+{
+    game_file_io_read_saved_game_from_memory(data);
+    initialize_saved_game();
+    building_storage_reset_building_ids();
+
+    sound_music_update(1);
+}
+
 int game_file_write_saved_game(const char *filename)
 {
     return game_file_io_write_saved_game(filename);
@@ -31,6 +31,12 @@ int game_file_load_scenario_data(const char *scenario_file);
  */
 int game_file_load_saved_game(const char *filename);
 
+/**
+ * Load saved game from an uncompressed in-memory snapshot
+ * @param data Snapshot written by game_file_io_write_saved_game_to_memory()
+ */
+void game_file_load_saved_game_from_memory(const uint8_t *data);
+
 /**
  * Write saved game to disk
  * @param filename File to save to
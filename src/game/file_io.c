@@ -30,6 +30,7 @@
 #include "map/desirability.h"
 #include "map/elevation.h"
 #include "map/figure.h"
+#include "map/grid.h"
 #include "map/image.h"
 #include "map/property.h"
 #include "map/random.h"
@@ -651,6 +652,99 @@ int game_file_io_read_saved_game(const char *filename, int offset)
     return 1;
 }
 
+static int is_info_piece(const buffer *buf)
+{
+    const savegame_state *state = &savegame_data.state;
+    return buf == state->scenario_campaign_mission || buf == state->terrain_grid ||
+        buf == state->city_data || buf == state->game_time ||
+        buf == state->scenario || buf == state->scenario_name;
+}
+
+static int skip_piece(FILE *fp, const file_piece *piece)
+{
+    int size = piece->buf.size;
+    if (piece->compressed) {
+        size = read_int32(fp);
+        if ((unsigned int) size == UNCOMPRESSED) {
+            size = piece->buf.size;
+        } else if (size <= 0 || size > COMPRESS_BUFFER_SIZE) {
+            return 0;
+        }
+    }
+    return fseek(fp, size, SEEK_CUR) == 0;
+}
+
+static int savegame_read_info_pieces(FILE *fp)
+{
+    for (int i = 0; i < savegame_data.num_pieces; i++) {
+        file_piece *piece = &savegame_data.pieces[i];
+        int result;
+        if (!is_info_piece(&piece->buf)) {
+            result = skip_piece(fp, piece);
+        } else if (piece->compressed) {
+            result = read_compressed_chunk(fp, piece->buf.data, piece->buf.size);
+        } else {
+            result = fread(piece->buf.data, 1, piece->buf.size, fp) == piece->buf.size;
+        }
+        if (!result) {
+            return 0;
+        }
+        if (&piece->buf == savegame_data.state.scenario_name) {
+            // nothing after the scenario name is needed
+            return 1;
+        }
+    }
+    return 1;
+}
+
+static void create_thumbnail(saved_game_info *info, buffer *terrain, int width, int height, int grid_start)
+{
+    int size = width > height ? width : height;
+    info->thumbnail_width = width * SAVED_GAME_THUMBNAIL_SIZE / size;
+    info->thumbnail_height = height * SAVED_GAME_THUMBNAIL_SIZE / size;
+    uint16_t *pixel = info->thumbnail_terrain;
+    for (int y = 0; y < info->thumbnail_height; y++) {
+        int row_offset = grid_start + (y * size / SAVED_GAME_THUMBNAIL_SIZE) * GRID_SIZE;
+        for (int x = 0; x < info->thumbnail_width; x++) {
+            buffer_set(terrain, 2 * (row_offset + x * size / SAVED_GAME_THUMBNAIL_SIZE));
+            *pixel++ = buffer_read_u16(terrain);
+        }
+    }
+}
+
+int game_file_io_read_saved_game_info(const char *filename, saved_game_info *info)
+{
+    init_savegame_data();
+
+    FILE *fp = file_open(dir_get_case_corrected_file(filename), "rb");
+    if (!fp) {
+        return 0;
+    }
+    int result = savegame_read_info_pieces(fp);
+    file_close(fp);
+    if (!result) {
+        return 0;
+    }
+    savegame_state *state = &savegame_data.state;
+    memset(info, 0, sizeof(saved_game_info));
+    info->mission = buffer_read_i32(state->scenario_campaign_mission);
+    buffer_skip(state->game_time, 8);
+    info->month = buffer_read_i32(state->game_time);
+    info->year = buffer_read_i32(state->game_time);
+    city_data_load_basic_info(state->city_data, &info->population, &info->treasury, info->ratings);
+    buffer_read_raw(state->scenario_name, info->scenario_name, SAVED_GAME_NAME_LENGTH);
+    info->scenario_name[SAVED_GAME_NAME_LENGTH - 1] = 0;
+
+    int width, height, grid_start;
+    scenario_load_map_info(state->scenario, &width, &height, &grid_start);
+    if (width <= 0 || height <= 0 || width > GRID_SIZE || height > GRID_SIZE || grid_start < 0 ||
+        grid_start + (height - 1) * GRID_SIZE + width > GRID_SIZE * GRID_SIZE) {
+        return 0;
+    }
+    create_thumbnail(info, state->terrain_grid, width, height, grid_start);
+    return 1;
+}
+
 int game_file_io_write_saved_game(const char *filename)
 {
     init_savegame_data();
@@ -669,6 +763,42 @@ int game_file_io_write_saved_game(const char *filename)
     return 1;
 }
 
+int game_file_io_saved_game_size(void)
+{
+    init_savegame_data();
+    int size = 0;
+    for (int i = 0; i < savegame_data.num_pieces; i++) {
+        size += savegame_data.pieces[i].buf.size;
+    }
+    return size;
+}
+
+void game_file_io_write_saved_game_to_memory(uint8_t *data)
+{
+    init_savegame_data();
+
+    savegame_version = SAVE_GAME_VERSION;
+    savegame_save_to_state(&savegame_data.state);
+
+    for (int i = 0; i < savegame_data.num_pieces; i++) {
+        buffer *buf = &savegame_data.pieces[i].buf;
+        memcpy(data, buf->data, buf->size);
+        data += buf->size;
+    }
+}
+
+void game_file_io_read_saved_game_from_memory(const uint8_t *data)
+{
+    init_savegame_data();
+
+    for (int i = 0; i < savegame_data.num_pieces; i++) {
+        buffer *buf = &savegame_data.pieces[i].buf;
+        memcpy(buf->data, data, buf->size);
+        data += buf->size;
+    }
+    savegame_load_from_state(&savegame_data.state);
+}
+
 int game_file_io_delete_saved_game(const char *filename)
 {
     return remove(filename) == 0;
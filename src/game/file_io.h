@@ -1,6 +1,27 @@
 #ifndef GAME_FILE_IO_H
 #define GAME_FILE_IO_H
 
+#include <stdint.h>
+
+#define SAVED_GAME_THUMBNAIL_SIZE 72
+#define SAVED_GAME_NAME_LENGTH 65
+
+/**
+ * Overview of a saved game, read without loading it
+ */
+typedef struct {
+    int mission;
+    int month;
+    int year;
+    int population;
+    int treasury;
+    int ratings[4];
+    uint8_t scenario_name[SAVED_GAME_NAME_LENGTH];
+    int thumbnail_width;
+    int thumbnail_height;
+    uint16_t thumbnail_terrain[SAVED_GAME_THUMBNAIL_SIZE * SAVED_GAME_THUMBNAIL_SIZE];
+} saved_game_info;
+
 int game_file_io_read_scenario(const char *filename);
 
 int game_file_io_write_scenario(const char *filename);
@@ -9,6 +30,34 @@ int game_file_io_read_saved_game(const char *filename, int offset);
 
 int game_file_io_write_saved_game(const char *filename);
 
+/**
+ * Reads the overview of a saved game. Only the pieces needed for the overview are
+ * decompressed, the others are skipped. The current game is not changed.
+ * @param filename File to read
+ * @param info Overview to fill; the thumbnail holds the terrain of the map scaled down
+ *        to at most SAVED_GAME_THUMBNAIL_SIZE tiles in either direction
+ * @return 1 on success, 0 if the file could not be read
+ */
+int game_file_io_read_saved_game_info(const char *filename, saved_game_info *info);
+
+/**
+ * Returns the size of the uncompressed in-memory representation of a saved game
+ * @return Size in bytes
+ */
+int game_file_io_saved_game_size(void);
+
+/**
+ * Writes the current game state to memory, uncompressed
+ * @param data Destination, must be at least game_file_io_saved_game_size() bytes
+ */
+void game_file_io_write_saved_game_to_memory(uint8_t *data);
+
+/**
+ * Reads the game state from memory written by game_file_io_write_saved_game_to_memory()
+ * @param data Source data
+ */
+void game_file_io_read_saved_game_from_memory(const uint8_t *data);
+
 int game_file_io_delete_saved_game(const char *filename);
 
 #endif // GAME_FILE_IO_H
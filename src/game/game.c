@@ -13,6 +13,7 @@
 #include "game/animation.h"
 #include "game/file.h"
 #include "game/file_editor.h"
+#include "game/replay.h"
 #include "game/settings.h"
 #include "game/state.h"
 #include "game/tick.h"
@@ -157,8 +158,10 @@ static int get_elapsed_ticks(void)
     }
     int game_speed_index = 0;
     int ticks_per_frame = 1;
+    int is_city = 0;
     switch (window_get_id()) {
         default:
+            game_state_reset_turbo();
             return 0;
         case WINDOW_CITY:
         case WINDOW_CITY_MILITARY:
@@ -172,8 +175,10 @@ static int get_elapsed_ticks(void)
                 ticks_per_frame = setting_game_speed() / 100;
                 game_speed_index = 0;
             }
+            is_city = 1;
             break;
         case WINDOW_EDITOR_MAP:
+            game_state_reset_turbo();
             game_speed_index = 3; // 70%, nice speed for flag animations
             break;
     }
@@ -185,6 +190,11 @@ static int get_elapsed_ticks(void)
     }
 
     time_millis now = time_get_millis();
+    if (is_city && game_state_is_turbo()) {
+        // the platform keeps calling game_run() until its frame budget is used up
+        last_update = now;
+        return ticks_per_frame;
+    }
     time_millis diff = now - last_update;
     if (diff < MILLIS_PER_TICK_PER_SPEED[game_speed_index] + 2) {
         return 0;
@@ -193,18 +203,20 @@ static int get_elapsed_ticks(void)
     return ticks_per_frame;
 }
 
-void game_run(void)
+int game_run(void)
 {
     game_animation_update();
     int num_ticks = get_elapsed_ticks();
     for (int i = 0; i < num_ticks; i++) {
+        game_replay_tick();
         game_tick_run();
         game_file_write_mission_saved_game();
 
         if (window_is_invalid()) {
-            break;
+            return i + 1;
         }
     }
+    return num_ticks;
 }
 
 void game_draw(void)
@@ -215,6 +227,7 @@ void game_draw(void)
 
 void game_exit(void)
 {
+    game_replay_stop_recording();
     video_shutdown();
     settings_save();
     config_save();
@@ -7,7 +7,11 @@ int game_init(void);
 
 int game_init_editor(void);
 
-void game_run(void);
+/**
+ * Runs the game ticks that are due since the previous call
+ * @return Number of ticks that were run
+ */
+int game_run(void);
 
 void game_draw(void);
 
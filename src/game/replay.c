@@ -0,0 +1,316 @@
+#include "replay.h"
+
+#include "building/construction.h"
+#include "core/file.h"
+#include "core/log.h"
+#include "game/file_io.h"
+#include "game/orientation.h"
+#include "game/rewind.h"
+#include "game/state.h"
+#include "game/undo.h"
+#include "map/bridge.h"
+#include "map/grid.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LINE 100
+
+static const char REPLAY_HEADER[] = "# julius replay 1";
+static const char START_SUFFIX[] = ".sav";
+static const char END_SUFFIX[] = "-end.sav";
+
+typedef enum {
+    COMMAND_BUILD,
+    COMMAND_UNDO,
+    COMMAND_ROTATE,
+    COMMAND_OVERLAY,
+    COMMAND_SPEED,
+    COMMAND_REWIND,
+    COMMAND_END,
+    COMMAND_MAX
+} command_type;
+
+static const char *COMMAND_NAMES[COMMAND_MAX] = {
+    "build", "undo", "rotate", "overlay", "speed", "rewind", "end"
+};
+
+typedef struct {
+    int tick;
+    command_type type;
+    int params[5];
+} replay_command;
+
+static struct {
+    int ticks;
+    char record_file[FILE_NAME_MAX];
+    FILE *record_fp;
+    int is_playing;
+    replay_command *commands;
+    int num_commands;
+    int next_command;
+    int end_tick;
+} data;
+
+static void saved_game_filename(char *dst, const char *suffix)
+{
+    size_t length = strlen(data.record_file);
+    memcpy(dst, data.record_file, length);
+    strcpy(&dst[length], suffix);
+}
+
+static void record(command_type type, int num_params, int p0, int p1, int p2, int p3, int p4)
+{
+    if (!data.record_fp) {
+        return;
+    }
+    int params[5] = {p0, p1, p2, p3, p4};
+    fprintf(data.record_fp, "%d %s", data.ticks, COMMAND_NAMES[type]);
+    for (int i = 0; i < num_params; i++) {
+        fprintf(data.record_fp, " %d", params[i]);
+    }
+    fprintf(data.record_fp, "\n");
+}
+
+void game_replay_set_record_file(const char *filename)
+{
+    game_replay_stop_recording();
+    data.record_file[0] = 0;
+    if (filename && strlen(filename) + sizeof(END_SUFFIX) <= FILE_NAME_MAX) {
+        strcpy(data.record_file, filename);
+    }
+}
+
+const char *game_replay_start_file(void)
+{
+    static char filename[FILE_NAME_MAX];
+    if (!data.record_file[0] || data.is_playing) {
+        return 0;
+    }
+    saved_game_filename(filename, START_SUFFIX);
+    return filename;
+}
+
+void game_replay_start_recording(void)
+{
+    game_replay_stop_recording();
+    const char *filename = game_replay_start_file();
+    if (!filename || !game_file_io_write_saved_game(filename)) {
+        return;
+    }
+    data.record_fp = file_open(data.record_file, "wt");
+    if (!data.record_fp) {
+        log_error("Unable to write replay file", data.record_file, 0);
+        return;
+    }
+    log_info("Recording replay", data.record_file, 0);
+    fprintf(data.record_fp, "%s\n", REPLAY_HEADER);
+    data.ticks = 0;
+}
+
+void game_replay_stop_recording(void)
+{
+    if (!data.record_fp) {
+        return;
+    }
+    record(COMMAND_END, 0, 0, 0, 0, 0, 0);
+    file_close(data.record_fp);
+    data.record_fp = 0;
+
+    char filename[FILE_NAME_MAX];
+    saved_game_filename(filename, END_SUFFIX);
+    game_file_io_write_saved_game(filename);
+}
+
+static int parse_command(const char *line, replay_command *command)
+{
+    char name[MAX_LINE];
+    int *p = command->params;
+    int num_read = sscanf(line, "%d %s %d %d %d %d %d", &command->tick, name, &p[0], &p[1], &p[2], &p[3], &p[4]);
+    if (num_read < 2) {
+        return 0;
+    }
+    for (int i = 0; i < COMMAND_MAX; i++) {
+        if (strcmp(name, COMMAND_NAMES[i]) == 0) {
+            command->type = i;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int game_replay_start_playback(const char *filename)
+{
+    game_replay_stop_recording();
+    free(data.commands);
+    data.commands = 0;
+    data.num_commands = 0;
+    data.next_command = 0;
+    data.end_tick = 0;
+
+    FILE *fp = file_open(filename, "rt");
+    if (!fp) {
+        log_error("Unable to read replay file", filename, 0);
+        return 0;
+    }
+    int capacity = 0;
+    char line[MAX_LINE];
+    while (fgets(line, MAX_LINE, fp)) {
+        if (line[0] == '#') {
+            continue;
+        }
+        replay_command command;
+        memset(&command, 0, sizeof(command));
+        if (!parse_command(line, &command)) {
+            continue;
+        }
+        if (command.type == COMMAND_END) {
+            data.end_tick = command.tick;
+            break;
+        }
+        if (data.num_commands >= capacity) {
+            capacity = capacity ? 2 * capacity : 256;
+            replay_command *commands = (replay_command *) realloc(data.commands, capacity * sizeof(replay_command));
+            if (!commands) {
+                file_close(fp);
+                log_error("Unable to allocate memory for replay", filename, 0);
+                return 0;
+            }
+            data.commands = commands;
+        }
+        data.commands[data.num_commands++] = command;
+        if (command.type == COMMAND_REWIND) {
+            // the journal takes the same snapshots as while recording, and keeps at least as many
+            game_rewind_set_max_days(REWIND_MAX_DAYS);
+        }
+    }
+    file_close(fp);
+    if (!data.end_tick && data.num_commands) {
+        data.end_tick = data.commands[data.num_commands - 1].tick;
+    }
+    log_info("Playing replay, commands:", filename, data.num_commands);
+    data.ticks = 0;
+    data.is_playing = 1;
+    return 1;
+}
+
+static void play_build(building_type type, int x_start, int y_start, int x_end, int y_end)
+{
+    building_construction_set_type(type);
+    building_construction_start(x_start, y_start, map_grid_offset(x_start, y_start));
+    if (type == BUILDING_LOW_BRIDGE || type == BUILDING_SHIP_BRIDGE) {
+        // normally calculated while drawing the bridge ghost
+        int length, direction;
+        map_bridge_calculate_length_direction(x_end, y_end, &length, &direction);
+    }
+    building_construction_update(x_end, y_end, map_grid_offset(x_end, y_end));
+    building_construction_place();
+    building_construction_clear_type();
+}
+
+static void play_rotation(replay_rotation rotation)
+{
+    switch (rotation) {
+        case REPLAY_ROTATE_LEFT: game_orientation_rotate_left(); break;
+        case REPLAY_ROTATE_RIGHT: game_orientation_rotate_right(); break;
+        case REPLAY_ROTATE_NORTH: game_orientation_rotate_north(); break;
+    }
+}
+
+static void play_command(const replay_command *command)
+{
+    const int *p = command->params;
+    switch (command->type) {
+        case COMMAND_BUILD:
+            play_build(p[0], p[1], p[2], p[3], p[4]);
+            break;
+        case COMMAND_UNDO:
+            game_undo_perform();
+            break;
+        case COMMAND_ROTATE:
+            play_rotation(p[0]);
+            break;
+        case COMMAND_OVERLAY:
+            game_state_set_overlay(p[0]);
+            break;
+        case COMMAND_REWIND:
+            if (!game_rewind_go_back(p[0])) {
+                log_error("Unable to rewind the replay, days:", 0, p[0]);
+            }
+            break;
+        default:
+            // game speed does not influence the outcome when playing back by tick
+            break;
+    }
+}
+
+static void play_commands_until(int tick)
+{
+    while (data.next_command < data.num_commands && data.commands[data.next_command].tick <= tick) {
+        play_command(&data.commands[data.next_command]);
+        data.next_command++;
+    }
+}
+
+void game_replay_finish_playback(void)
+{
+    if (!data.is_playing) {
+        return;
+    }
+    play_commands_until(data.end_tick);
+    data.is_playing = 0;
+}
+
+int game_replay_is_playing(void)
+{
+    return data.is_playing;
+}
+
+int game_replay_ticks(void)
+{
+    return data.ticks;
+}
+
+int game_replay_end_tick(void)
+{
+    return data.end_tick;
+}
+
+void game_replay_tick(void)
+{
+    if (data.is_playing) {
+        play_commands_until(data.ticks);
+    }
+    data.ticks++;
+}
+
+void game_replay_record_build(building_type type, int x_start, int y_start, int x_end, int y_end)
+{
+    record(COMMAND_BUILD, 5, type, x_start, y_start, x_end, y_end);
+}
+
+void game_replay_record_undo(void)
+{
+    record(COMMAND_UNDO, 0, 0, 0, 0, 0, 0);
+}
+
+void game_replay_record_rotation(replay_rotation rotation)
+{
+    record(COMMAND_ROTATE, 1, rotation, 0, 0, 0, 0);
+}
+
+void game_replay_record_overlay(int overlay)
+{
+    record(COMMAND_OVERLAY, 1, overlay, 0, 0, 0, 0);
+}
+
+void game_replay_record_speed(int speed)
+{
+    record(COMMAND_SPEED, 1, speed, 0, 0, 0, 0);
+}
+
+void game_replay_record_rewind(int days)
+{
+    record(COMMAND_REWIND, 1, days, 0, 0, 0, 0);
+}
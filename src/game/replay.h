@@ -0,0 +1,94 @@
+#ifndef GAME_REPLAY_H
+#define GAME_REPLAY_H
+
+#include "building/type.h"
+
+/**
+ * @file
+ * Recording and playback of player commands.
+ * Commands are stamped with the number of game ticks that have run since the
+ * recording started, so that playing them back on top of the same saved game
+ * results in the same city regardless of frame rate or game speed.
+ */
+
+typedef enum {
+    REPLAY_ROTATE_LEFT = 0,
+    REPLAY_ROTATE_RIGHT = 1,
+    REPLAY_ROTATE_NORTH = 2
+} replay_rotation;
+
+/**
+ * Sets the file to record to. Recording (re)starts every time a game is loaded
+ * or a scenario is started, see game_replay_start_recording(). Rewinding the game
+ * does not restart the recording: it is recorded as a command.
+ * The state at the start of the recording is saved as FILENAME.sav,
+ * the state at the end as FILENAME-end.sav.
+ * @param filename Replay file, or null to disable recording
+ */
+void game_replay_set_record_file(const char *filename);
+
+/**
+ * Returns the name of the saved game holding the state at the start of the recording
+ * @return File name, or null if no record file is set
+ */
+const char *game_replay_start_file(void);
+
+/**
+ * Starts a new recording if a record file is set; called when a saved game has been
+ * read, before the city is initialized, so that loading the start file for playback
+ * goes through the same initialization
+ */
+void game_replay_start_recording(void);
+
+/**
+ * Stops the current recording and writes the final saved game
+ */
+void game_replay_stop_recording(void);
+
+/**
+ * Loads a replay file and starts playing it back on top of the current game.
+ * If the replay rewinds the game, the rewind journal is set to keep REWIND_MAX_DAYS days.
+ * @param filename Replay file
+ * @return Boolean true on success, false on failure
+ */
+int game_replay_start_playback(const char *filename);
+
+/**
+ * Applies all commands that have not been played back yet and stops playback
+ */
+void game_replay_finish_playback(void);
+
+/**
+ * Returns whether a replay is being played back
+ */
+int game_replay_is_playing(void);
+
+/**
+ * Returns the number of ticks run since recording or playback started
+ */
+int game_replay_ticks(void);
+
+/**
+ * Returns the tick on which the replay that is being played back ended
+ */
+int game_replay_end_tick(void);
+
+/**
+ * Applies the commands due before the next tick and advances the tick counter;
+ * called right before every game tick
+ */
+void game_replay_tick(void);
+
+void game_replay_record_build(building_type type, int x_start, int y_start, int x_end, int y_end);
+
+void game_replay_record_undo(void);
+
+void game_replay_record_rotation(replay_rotation rotation);
+
+void game_replay_record_overlay(int overlay);
+
+void game_replay_record_speed(int speed);
+
+void game_replay_record_rewind(int days);
+
+#endif // GAME_REPLAY_H
@@ -0,0 +1,225 @@
+#include "rewind.h"
+
+#include "core/buffer.h"
+#include "core/log.h"
+#include "game/file.h"
+#include "game/file_io.h"
+#include "game/replay.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_DELTA_MEMORY (32 * 1024 * 1024)
+#define MIN_ZERO_RUN 8
+
+typedef struct {
+    uint8_t *data;
+    int size;
+} rewind_delta;
+
+static struct {
+    int max_days;
+    int snapshot_size;
+    int has_snapshot;
+    uint8_t *snapshot;
+    uint8_t *scratch;
+    uint8_t *encode_buffer;
+    rewind_delta deltas[REWIND_MAX_DAYS];
+    int first_delta;
+    int num_deltas;
+    int delta_memory;
+} data;
+
+static void free_buffers(void)
+{
+    free(data.snapshot);
+    free(data.scratch);
+    free(data.encode_buffer);
+    data.snapshot = 0;
+    data.scratch = 0;
+    data.encode_buffer = 0;
+    data.snapshot_size = 0;
+}
+
+static int allocate_buffers(void)
+{
+    if (data.snapshot) {
+        return 1;
+    }
+    data.snapshot_size = game_file_io_saved_game_size();
+    data.snapshot = (uint8_t *) malloc(data.snapshot_size);
+    data.scratch = (uint8_t *) malloc(data.snapshot_size);
+    // worst case: an 8-byte header for every literal run followed by a short zero run
+    data.encode_buffer = (uint8_t *) malloc(2 * data.snapshot_size + 16);
+    if (!data.snapshot || !data.scratch || !data.encode_buffer) {
+        log_error("Unable to allocate memory for rewind journal", 0, 0);
+        free_buffers();
+        return 0;
+    }
+    return 1;
+}
+
+static rewind_delta *delta_at(int index)
+{
+    return &data.deltas[(data.first_delta + index) % REWIND_MAX_DAYS];
+}
+
+static void drop_oldest_delta(void)
+{
+    rewind_delta *delta = delta_at(0);
+    data.delta_memory -= delta->size;
+    free(delta->data);
+    delta->data = 0;
+    delta->size = 0;
+    data.first_delta = (data.first_delta + 1) % REWIND_MAX_DAYS;
+    data.num_deltas--;
+}
+
+static rewind_delta *pop_newest_delta(void)
+{
+    rewind_delta *delta = delta_at(data.num_deltas - 1);
+    data.delta_memory -= delta->size;
+    data.num_deltas--;
+    return delta;
+}
+
+void game_rewind_clear(void)
+{
+    while (data.num_deltas > 0) {
+        drop_oldest_delta();
+    }
+    data.first_delta = 0;
+    data.has_snapshot = 0;
+}
+
+void game_rewind_set_max_days(int days)
+{
+    if (days > REWIND_MAX_DAYS) {
+        days = REWIND_MAX_DAYS;
+    }
+    if (days < 0) {
+        days = 0;
+    }
+    data.max_days = days;
+    if (!days) {
+        game_rewind_clear();
+        free_buffers();
+        return;
+    }
+    while (data.num_deltas >= data.max_days) {
+        drop_oldest_delta();
+    }
+}
+
+/**
+ * Encodes the XOR of both snapshots as a list of (zero run, literal run, literal bytes).
+ * Applying the same delta to either snapshot results in the other one.
+ */
+static int encode_delta(const uint8_t *old_data, const uint8_t *new_data, int size)
+{
+    buffer buf;
+    buffer_init(&buf, data.encode_buffer, 2 * size + 16);
+    int pos = 0;
+    while (pos < size) {
+        int zero_start = pos;
+        while (pos < size && old_data[pos] == new_data[pos]) {
+            pos++;
+        }
+        int literal_start = pos;
+        int zeros = 0;
+        while (pos < size && zeros < MIN_ZERO_RUN) {
+            if (old_data[pos] == new_data[pos]) {
+                zeros++;
+            } else {
+                zeros = 0;
+            }
+            pos++;
+        }
+        if (zeros == MIN_ZERO_RUN) {
+            pos -= MIN_ZERO_RUN;
+        }
+        int literal_length = pos - literal_start;
+        buffer_write_u32(&buf, literal_start - zero_start);
+        buffer_write_u32(&buf, literal_length);
+        for (int i = literal_start; i < pos; i++) {
+            buffer_write_u8(&buf, old_data[i] ^ new_data[i]);
+        }
+    }
+    return buf.index;
+}
+
+static void apply_delta(uint8_t *target, const rewind_delta *delta)
+{
+    buffer buf;
+    buffer_init(&buf, delta->data, delta->size);
+    int pos = 0;
+    while (!buffer_at_end(&buf)) {
+        pos += buffer_read_u32(&buf);
+        int literal_length = buffer_read_u32(&buf);
+        for (int i = 0; i < literal_length; i++) {
+            target[pos++] ^= buffer_read_u8(&buf);
+        }
+    }
+}
+
+void game_rewind_record_day(void)
+{
+    if (!data.max_days || !allocate_buffers()) {
+        return;
+    }
+    if (!data.has_snapshot) {
+        game_file_io_write_saved_game_to_memory(data.snapshot);
+        data.has_snapshot = 1;
+        return;
+    }
+    game_file_io_write_saved_game_to_memory(data.scratch);
+    int size = encode_delta(data.snapshot, data.scratch, data.snapshot_size);
+    uint8_t *delta_data = (uint8_t *) malloc(size);
+    if (!delta_data) {
+        log_error("Unable to allocate memory for rewind journal", 0, 0);
+        game_rewind_clear();
+        return;
+    }
+    memcpy(delta_data, data.encode_buffer, size);
+
+    while (data.num_deltas > 0 &&
+        (data.num_deltas >= data.max_days - 1 || data.delta_memory + size > MAX_DELTA_MEMORY)) {
+        drop_oldest_delta();
+    }
+    if (data.max_days > 1) {
+        rewind_delta *delta = delta_at(data.num_deltas);
+        delta->data = delta_data;
+        delta->size = size;
+        data.delta_memory += size;
+        data.num_deltas++;
+    } else {
+        free(delta_data);
+    }
+
+    uint8_t *tmp = data.snapshot;
+    data.snapshot = data.scratch;
+    data.scratch = tmp;
+}
+
+int game_rewind_days_available(void)
+{
+    return data.has_snapshot ? data.num_deltas + 1 : 0;
+}
+
+int game_rewind_go_back(int days)
+{
+    if (days <= 0 || days > game_rewind_days_available()) {
+        return 0;
+    }
+    for (int i = 1; i < days; i++) {
+        rewind_delta *delta = pop_newest_delta();
+        apply_delta(data.snapshot, delta);
+        free(delta->data);
+        delta->data = 0;
+        delta->size = 0;
+    }
+    log_info("Rewinding game days:", 0, days);
+    game_replay_record_rewind(days);
+    game_file_load_saved_game_from_memory(data.snapshot);
+    return 1;
+}
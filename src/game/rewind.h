@@ -0,0 +1,45 @@
+#ifndef GAME_REWIND_H
+#define GAME_REWIND_H
+
+/**
+ * @file
+ * In-memory rewind journal.
+ * At the start of every game day a snapshot of the game state is taken.
+ * Only the newest snapshot is kept in full, older ones are stored as
+ * run-length encoded differences to the next day.
+ */
+
+#define REWIND_MAX_DAYS 100
+
+/**
+ * Sets the number of days that are kept in the journal
+ * @param days Number of days, 0 to disable the journal, at most REWIND_MAX_DAYS
+ */
+void game_rewind_set_max_days(int days);
+
+/**
+ * Clears all recorded snapshots, for example when another game is loaded
+ */
+void game_rewind_clear(void);
+
+/**
+ * Records a snapshot of the current game state; called on day change
+ */
+void game_rewind_record_day(void);
+
+/**
+ * Returns the number of days that can be rewound
+ * @return Number of days available
+ */
+int game_rewind_days_available(void);
+
+/**
+ * Rewinds the game to the start of a previous day.
+ * Snapshots newer than the restored one are discarded. A replay that is being recorded
+ * goes on and records the rewind.
+ * @param days Number of days to go back: 1 means the start of the current day
+ * @return Boolean true on success, false if not enough days are available
+ */
+int game_rewind_go_back(int days);
+
+#endif // GAME_REWIND_H
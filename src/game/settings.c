@@ -5,6 +5,7 @@
 #include "core/calc.h"
 #include "core/io.h"
 #include "core/string.h"
+#include "game/replay.h"
 
 #define INF_SIZE 560
 #define MAX_PERSONAL_SAVINGS 100
@@ -260,6 +261,7 @@ void setting_increase_game_speed(void)
     } else {
         data.game_speed = calc_bound(data.game_speed + 10, 10, 100);
     }
+    game_replay_record_speed(data.game_speed);
 }
 
 void setting_decrease_game_speed(void)
@@ -269,6 +271,7 @@ void setting_decrease_game_speed(void)
     } else {
         data.game_speed = calc_bound(data.game_speed - 10, 10, 100);
     }
+    game_replay_record_speed(data.game_speed);
 }
 
 int setting_scroll_speed(void)
@@ -4,6 +4,7 @@
 #include "city/view.h"
 #include "city/warning.h"
 #include "core/random.h"
+#include "game/replay.h"
 #include "map/ring.h"
 #include "map/building.h"
 
@@ -11,6 +12,7 @@ static struct {
     int paused;
     int current_overlay;
     int previous_overlay;
+    int turbo;
 } data = {0, OVERLAY_NONE, OVERLAY_NONE};
 
 void game_state_init(void)
@@ -24,6 +26,7 @@ void game_state_init(void)
     random_generate_pool();
 
     city_warning_clear_all();
+    game_state_reset_turbo();
 }
 
 int game_state_is_paused(void)
@@ -41,6 +44,21 @@ void game_state_toggle_paused(void)
     data.paused = data.paused ? 0 : 1;
 }
 
+int game_state_is_turbo(void)
+{
+    return data.turbo;
+}
+
+void game_state_toggle_turbo(void)
+{
+    data.turbo = data.turbo ? 0 : 1;
+}
+
+void game_state_reset_turbo(void)
+{
+    data.turbo = 0;
+}
+
 int game_state_overlay(void)
 {
     return data.current_overlay;
@@ -57,6 +75,7 @@ void game_state_toggle_overlay(void)
     int tmp = data.previous_overlay;
     data.previous_overlay = data.current_overlay;
     data.current_overlay = tmp;
+    game_replay_record_overlay(data.current_overlay);
     map_clear_highlights();
 }
 
@@ -68,5 +87,11 @@ void game_state_set_overlay(int overlay)
         data.previous_overlay = OVERLAY_NONE;
     }
     data.current_overlay = overlay;
+    game_replay_record_overlay(overlay);
     map_clear_highlights();
 }
+
+void game_state_show_overlay_for_drawing(int overlay)
+{
+    data.current_overlay = overlay;
+}
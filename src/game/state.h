@@ -37,6 +37,19 @@ void game_state_toggle_paused(void);
 
 void game_state_unpause(void);
 
+/**
+ * Turbo mode: the city runs as many ticks as the CPU allows instead of being
+ * limited by the game speed setting
+ */
+int game_state_is_turbo(void);
+
+void game_state_toggle_turbo(void);
+
+/**
+ * Turns turbo mode off; called when a game is loaded or the city window is left
+ */
+void game_state_reset_turbo(void);
+
 int game_state_overlay(void);
 
 void game_state_reset_overlay(void);
@@ -45,4 +58,11 @@ void game_state_toggle_overlay(void);
 
 void game_state_set_overlay(int overlay);
 
+/**
+ * Shows an overlay for drawing only: unlike game_state_set_overlay, the overlay is not
+ * recorded in a replay and the overlay to toggle back to is kept
+ * @param overlay Overlay to show, set back to the previous one afterwards
+ */
+void game_state_show_overlay_for_drawing(int overlay);
+
 #endif // GAME_STATE_H
@@ -29,6 +29,45 @@ void system_set_fullscreen(int fullscreen);
  */
 void system_set_cursor(int cursor_id);
 
+/**
+ * Start a thread
+ * @param function Function to run on the thread
+ * @param data Argument to pass to the function
+ * @return Thread handle, or 0 if the thread could not be started
+ */
+void *system_create_thread(int (*function)(void *data), void *data);
+
+/**
+ * Wait for a thread to finish
+ * @param thread Thread handle returned by system_create_thread
+ */
+void system_wait_thread(void *thread);
+
+/**
+ * Create a semaphore
+ * @param value Initial value
+ * @return Semaphore handle, or 0 if the semaphore could not be created
+ */
+void *system_create_semaphore(int value);
+
+/**
+ * Wait until the value of a semaphore is above zero, then decrease it
+ * @param semaphore Semaphore handle returned by system_create_semaphore
+ */
+void system_wait_semaphore(void *semaphore);
+
+/**
+ * Increase the value of a semaphore
+ * @param semaphore Semaphore handle returned by system_create_semaphore
+ */
+void system_post_semaphore(void *semaphore);
+
+/**
+ * Destroy a semaphore
+ * @param semaphore Semaphore handle returned by system_create_semaphore, may be 0
+ */
+void system_destroy_semaphore(void *semaphore);
+
 /**
  * Exit the game
  */
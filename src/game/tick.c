@@ -32,6 +32,7 @@
 #include "figure/formation.h"
 #include "figuretype/crime.h"
 #include "game/file.h"
+#include "game/rewind.h"
 #include "game/settings.h"
 #include "game/time.h"
 #include "game/tutorial.h"
@@ -112,6 +113,7 @@ static void advance_day(void)
         city_sentiment_update();
     }
     tutorial_on_day_tick();
+    game_rewind_record_day();
 }
 
 static void advance_tick(void)
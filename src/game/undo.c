@@ -1,10 +1,12 @@
 #include "undo.h"
 
+#include "building/count.h"
 #include "building/industry.h"
 #include "building/properties.h"
 #include "building/warehouse.h"
 #include "city/finance.h"
 #include "core/image.h"
+#include "game/replay.h"
 #include "game/resource.h"
 #include "graphics/window.h"
 #include "map/aqueduct.h"
@@ -16,6 +18,7 @@
 #include "map/routing_terrain.h"
 #include "map/sprite.h"
 #include "map/terrain.h"
+#include "map/water_supply.h"
 #include "scenario/earthquake.h"
 
 #include <string.h>
@@ -126,6 +129,8 @@ void game_undo_restore_building_state(void)
             building *b = building_get(data.buildings[i].id);
             if (b->state == BUILDING_STATE_DELETED_BY_PLAYER) {
                 b->state = BUILDING_STATE_IN_USE;
+                map_water_supply_building_changed(b->id);
+                building_count_building_changed(b->id);
             }
             b->is_deleted = 0;
         }
@@ -191,6 +196,8 @@ static void add_building_to_terrain(building *b)
         }
     }
     b->state = BUILDING_STATE_IN_USE;
+    map_water_supply_building_changed(b->id);
+    building_count_building_changed(b->id);
 }
 
 void game_undo_perform(void)
@@ -198,6 +205,7 @@ void game_undo_perform(void)
     if (!game_can_undo()) {
         return;
     }
+    game_replay_record_undo();
     data.available = 0;
     city_finance_process_construction(-data.building_cost);
     if (data.type == BUILDING_CLEAR_LAND) {
@@ -205,6 +213,7 @@ void game_undo_perform(void)
             if (data.buildings[i].id) {
                 building *b = building_get(data.buildings[i].id);
                 memcpy(b, &data.buildings[i], sizeof(building));
+                building_add_to_index(b);
                 add_building_to_terrain(b);
             }
         }
@@ -241,11 +250,14 @@ void game_undo_perform(void)
                     building_warehouses_add_resource(RESOURCE_MARBLE, 2);
                 }
                 b->state = BUILDING_STATE_UNDO;
+                building_count_building_changed(b->id);
             }
         }
     }
     map_routing_update_land();
     map_routing_update_walls();
+    // the restored terrain may contain a fountain range that is no longer current
+    map_water_supply_clear();
     data.num_buildings = 0;
 }
 
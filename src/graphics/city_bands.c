@@ -0,0 +1,69 @@
+#include "city_bands.h"
+
+#include "city/view.h"
+#include "game/state.h"
+#include "graphics/graphics.h"
+#include "graphics/screen.h"
+#include "graphics/window.h"
+#include "map/grid.h"
+#include "widget/city_with_overlay.h"
+#include "widget/city_without_overlay.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define TOP_MENU_HEIGHT 24
+#define TILE_X_SIZE 60
+#define TILE_Y_SIZE 30
+
+void graphics_city_bands_size(int *width, int *height)
+{
+    *width = map_grid_width() * TILE_X_SIZE;
+    *height = map_grid_height() * TILE_Y_SIZE + TILE_Y_SIZE;
+}
+
+int graphics_draw_city_bands(int overlay,
+    int (*handle_band)(const color_t *pixels, int stride, void *user_data), void *user_data)
+{
+    int city_width_pixels = map_grid_width() * TILE_X_SIZE;
+    int city_height_pixels = map_grid_height() * TILE_Y_SIZE;
+    int canvas_width = city_width_pixels + (city_view_is_sidebar_collapsed() ? 40 : 160);
+    int canvas_height = TOP_MENU_HEIGHT + CITY_BAND_HEIGHT;
+    color_t *canvas = (color_t *) malloc((size_t) canvas_width * canvas_height * sizeof(color_t));
+    if (!canvas) {
+        return 0;
+    }
+    memset(canvas, 0, (size_t) canvas_width * canvas_height * sizeof(color_t));
+
+    int original_overlay = game_state_overlay();
+    game_state_show_overlay_for_drawing(overlay);
+    pixel_offset original_camera_pixels;
+    city_view_get_camera_in_pixels(&original_camera_pixels.x, &original_camera_pixels.y);
+    graphics_set_custom_canvas(canvas, canvas_width, canvas_height);
+    city_view_set_viewport(canvas_width, canvas_height);
+    graphics_set_clip_rectangle(0, TOP_MENU_HEIGHT, city_width_pixels, CITY_BAND_HEIGHT);
+
+    int base_width = (GRID_SIZE * TILE_X_SIZE - city_width_pixels) / 2 + TILE_X_SIZE;
+    int max_height = (GRID_SIZE * TILE_Y_SIZE + city_height_pixels) / 2;
+    int min_height = max_height - city_height_pixels - TILE_Y_SIZE;
+    map_tile dummy_tile = { 0, 0, 0 };
+    const color_t *band = &canvas[TOP_MENU_HEIGHT * canvas_width];
+    int ok = 1;
+    for (int y = min_height; y < max_height && ok; y += CITY_BAND_HEIGHT) {
+        city_view_set_camera_from_pixel_position(base_width, y);
+        if (overlay != OVERLAY_NONE) {
+            city_with_overlay_draw(&dummy_tile);
+        } else {
+            city_without_overlay_draw(0, 0, &dummy_tile);
+        }
+        ok = handle_band(band, canvas_width, user_data);
+    }
+
+    graphics_restore_screen_canvas();
+    free(canvas);
+    city_view_set_viewport(screen_width(), screen_height());
+    city_view_set_camera_from_pixel_position(original_camera_pixels.x, original_camera_pixels.y);
+    game_state_show_overlay_for_drawing(original_overlay);
+    window_invalidate();
+    return ok;
+}
@@ -0,0 +1,32 @@
+#ifndef GRAPHICS_CITY_BANDS_H
+#define GRAPHICS_CITY_BANDS_H
+
+#include "graphics/color.h"
+
+/**
+ * @file
+ * Off-screen drawing of the whole city at full size, one band at a time.
+ */
+
+#define CITY_BAND_HEIGHT 30
+
+/**
+ * Gets the size of the whole city at full size
+ * @param width Set to the width in pixels
+ * @param height Set to the height in pixels, always a multiple of CITY_BAND_HEIGHT
+ */
+void graphics_city_bands_size(int *width, int *height);
+
+/**
+ * Draws the whole city off-screen from top to bottom and hands over every band.
+ * The screen is not touched and the camera and overlay are restored afterwards.
+ * @param overlay Overlay to draw the city with, OVERLAY_NONE for the plain city
+ * @param handle_band Gets the pixels of a band: CITY_BAND_HEIGHT rows as wide as the city,
+ *                    stride pixels apart. Returns 0 to stop drawing.
+ * @param user_data Passed to handle_band
+ * @return 1 if all bands were drawn and handled, 0 otherwise
+ */
+int graphics_draw_city_bands(int overlay,
+    int (*handle_band)(const color_t *pixels, int stride, void *user_data), void *user_data);
+
+#endif // GRAPHICS_CITY_BANDS_H
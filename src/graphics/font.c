@@ -125,6 +125,11 @@ static struct {
     const int *font_mapping;
     const font_definition *font_definitions;
     int multibyte;
+    struct {
+        int is_valid;
+        int letters_version;
+        font_glyph_metrics metrics;
+    } glyphs[FONT_TYPES_MAX];
 } data;
 
 int image_y_offset_default(uint8_t c, int image_height, int line_height)
@@ -299,6 +304,9 @@ static int image_y_offset_cyrillic_small_black(uint8_t c, int image_height, int
 void font_set_encoding(encoding_type encoding)
 {
     data.multibyte = 0;
+    for (int i = 0; i < FONT_TYPES_MAX; i++) {
+        data.glyphs[i].is_valid = 0;
+    }
     if (encoding == ENCODING_EASTERN_EUROPE) {
         data.font_mapping = CHAR_TO_FONT_IMAGE_EASTERN;
         data.font_definitions = DEFINITIONS_EASTERN;
@@ -342,3 +350,31 @@ int font_letter_id(const font_definition *def, const uint8_t *str, int *num_byte
         return data.font_mapping[*str] + def->image_offset - 1;
     }
 }
+
+static void calculate_glyph_metrics(font_t font, font_glyph_metrics *metrics)
+{
+    const font_definition *def = &data.font_definitions[font];
+    for (int c = 0; c < 256; c++) {
+        if (data.multibyte && c >= 0x80) {
+            metrics->letter_id[c] = FONT_LETTER_MULTIBYTE;
+            metrics->width[c] = 0;
+        } else if (!data.font_mapping[c]) {
+            metrics->letter_id[c] = FONT_LETTER_NONE;
+            metrics->width[c] = 0;
+        } else {
+            metrics->letter_id[c] = data.font_mapping[c] + def->image_offset - 1;
+            metrics->width[c] = image_letter(metrics->letter_id[c])->width;
+        }
+    }
+}
+
+const font_glyph_metrics *font_glyph_metrics_for(font_t font)
+{
+    int letters_version = image_letters_version();
+    if (!data.glyphs[font].is_valid || data.glyphs[font].letters_version != letters_version) {
+        calculate_glyph_metrics(font, &data.glyphs[font].metrics);
+        data.glyphs[font].letters_version = letters_version;
+        data.glyphs[font].is_valid = 1;
+    }
+    return &data.glyphs[font].metrics;
+}
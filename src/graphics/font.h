@@ -39,6 +39,21 @@ typedef struct {
     int (*image_y_offset)(uint8_t c, int image_height, int line_height);
 } font_definition;
 
+#define FONT_LETTER_NONE -1
+#define FONT_LETTER_MULTIBYTE -2
+
+/**
+ * Letters of a font for all single-byte characters, so that text can be measured
+ * and drawn without looking up every character
+ */
+typedef struct {
+    /** Letter ID, FONT_LETTER_NONE if the character has no letter, or
+     * FONT_LETTER_MULTIBYTE if it starts a multibyte character */
+    int letter_id[256];
+    /** Width of the letter image, 0 if the character has no single-byte letter */
+    int width[256];
+} font_glyph_metrics;
+
 /**
  * Sets the encoding for font drawing functions
  * @param encoding Encoding to use
@@ -61,4 +76,12 @@ const font_definition *font_definition_for(font_t font);
  */
 int font_letter_id(const font_definition *def, const uint8_t *str, int *num_bytes);
 
+/**
+ * Gets the letters of all single-byte characters for the specified font.
+ * The table is rebuilt when the encoding changes or the letter images are reloaded.
+ * @param font Font
+ * @return Glyph metrics
+ */
+const font_glyph_metrics *font_glyph_metrics_for(font_t font);
+
 #endif // GRAPHICS_FONT_H
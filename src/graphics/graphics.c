@@ -12,7 +12,7 @@ static struct {
     color_t *pixels;
     int width;
     int height;
-} canvas = {NULL, 0, 0};
+} canvas = {NULL, 0, 0}, screen_canvas = {NULL, 0, 0};
 
 static struct {
     int x_start;
@@ -52,6 +52,27 @@ const void *graphics_canvas(void)
     return canvas.pixels;
 }
 
+void graphics_set_custom_canvas(color_t *pixels, int width, int height)
+{
+    if (!screen_canvas.pixels) {
+        screen_canvas = canvas;
+    }
+    canvas.pixels = pixels;
+    canvas.width = width;
+    canvas.height = height;
+    graphics_set_clip_rectangle(0, 0, width, height);
+}
+
+void graphics_restore_screen_canvas(void)
+{
+    if (!screen_canvas.pixels) {
+        return;
+    }
+    canvas = screen_canvas;
+    screen_canvas.pixels = NULL;
+    graphics_reset_clip_rectangle();
+}
+
 static void translate_clip(int dx, int dy)
 {
     clip_rectangle.x_start -= dx;
@@ -28,6 +28,19 @@ typedef struct {
 void graphics_init_canvas(int width, int height);
 const void *graphics_canvas(void);
 
+/**
+ * Redirects all drawing to the given pixel buffer, without changing the screen
+ * @param pixels Buffer of width * height pixels
+ * @param width Width of the buffer
+ * @param height Height of the buffer
+ */
+void graphics_set_custom_canvas(color_t *pixels, int width, int height);
+
+/**
+ * Draws to the screen again after graphics_set_custom_canvas()
+ */
+void graphics_restore_screen_canvas(void);
+
 void graphics_in_dialog(void);
 void graphics_reset_dialog(void);
 
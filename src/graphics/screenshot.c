@@ -1,15 +1,15 @@
 #include "screenshot.h"
 
-#include "city/view.h"
 #include "core/buffer.h"
 #include "core/config.h"
 #include "core/file.h"
 #include "core/log.h"
+#include "game/state.h"
+#include "game/system.h"
+#include "graphics/city_bands.h"
 #include "graphics/screen.h"
 #include "graphics/graphics.h"
 #include "graphics/window.h"
-#include "map/grid.h"
-#include "widget/city_without_overlay.h"
 
 #include "png/png.h"
 
@@ -18,11 +18,8 @@
 #include <string.h>
 #include <time.h>
 
-#define TOP_MENU_HEIGHT 24
-#define TILE_X_SIZE 60
-#define TILE_Y_SIZE 30
-#define IMAGE_HEIGHT_CHUNK TILE_Y_SIZE
 #define IMAGE_BYTES_PER_PIXEL 3
+#define MAX_QUEUED_BANDS 4
 
 enum {
     FULL_CITY_SCREENSHOT = 0,
@@ -50,6 +47,22 @@ static struct {
     png_infop info_ptr;
 } image;
 
+/**
+ * Bands of the full city screenshot that are drawn but not yet written. The game thread
+ * draws the bands and the writer thread compresses them, so drawing the next band and
+ * compressing the previous ones overlap.
+ */
+static struct {
+    color_t *bands[MAX_QUEUED_BANDS];
+    int has_band[MAX_QUEUED_BANDS];
+    int head;
+    int tail;
+    void *free_slots;
+    void *filled_slots;
+    void *writer;
+    int error;
+} queue;
+
 static void image_free(void)
 {
     image.width = 0;
@@ -216,20 +229,105 @@ void graphics_save_screenshot(int full_city)
     image_free();
 }
 
+static int write_queued_bands(void *unused)
+{
+    while (1) {
+        system_wait_semaphore(queue.filled_slots);
+        int slot = queue.tail;
+        queue.tail = (queue.tail + 1) % MAX_QUEUED_BANDS;
+        if (!queue.has_band[slot]) {
+            return 0;
+        }
+        if (!queue.error && !image_write_rows(queue.bands[slot], image.width)) {
+            queue.error = 1;
+        }
+        system_post_semaphore(queue.free_slots);
+    }
+}
+
+static void queue_free(void)
+{
+    for (int i = 0; i < MAX_QUEUED_BANDS; i++) {
+        free(queue.bands[i]);
+    }
+    system_destroy_semaphore(queue.free_slots);
+    system_destroy_semaphore(queue.filled_slots);
+    memset(&queue, 0, sizeof(queue));
+}
+
+/**
+ * Starts the writer thread; when that is not possible the bands are written on the game thread
+ */
+static void queue_start(void)
+{
+    memset(&queue, 0, sizeof(queue));
+    for (int i = 0; i < MAX_QUEUED_BANDS; i++) {
+        queue.bands[i] = (color_t *) malloc((size_t) image.width * image.rows_in_memory * sizeof(color_t));
+        if (!queue.bands[i]) {
+            queue_free();
+            return;
+        }
+    }
+    queue.free_slots = system_create_semaphore(MAX_QUEUED_BANDS);
+    queue.filled_slots = system_create_semaphore(0);
+    if (queue.free_slots && queue.filled_slots) {
+        queue.writer = system_create_thread(write_queued_bands, 0);
+    }
+    if (!queue.writer) {
+        queue_free();
+    }
+}
+
+static void queue_put(const color_t *canvas, int canvas_width)
+{
+    system_wait_semaphore(queue.free_slots);
+    int slot = queue.head;
+    queue.head = (queue.head + 1) % MAX_QUEUED_BANDS;
+    queue.has_band[slot] = canvas != 0;
+    if (canvas) {
+        for (int y = 0; y < image.rows_in_memory; y++) {
+            memcpy(&queue.bands[slot][y * image.width], &canvas[y * canvas_width], image.width * sizeof(color_t));
+        }
+    }
+    system_post_semaphore(queue.filled_slots);
+}
+
+static int write_band(const color_t *canvas, int canvas_width, void *unused)
+{
+    if (!queue.writer) {
+        return image_write_rows(canvas, canvas_width);
+    }
+    if (queue.error) {
+        return 0;
+    }
+    queue_put(canvas, canvas_width);
+    return 1;
+}
+
+/**
+ * Waits until the writer thread has written all bands
+ * @return 1 if all bands were written
+ */
+static int queue_finish(void)
+{
+    if (!queue.writer) {
+        return 1;
+    }
+    queue_put(0, 0);
+    system_wait_thread(queue.writer);
+    int ok = !queue.error;
+    queue_free();
+    return ok;
+}
+
 static void full_city_screenshot(void)
 {
     if (!window_is(WINDOW_CITY) && !window_is(WINDOW_CITY_MILITARY)) {
         return;
     }
-    pixel_offset original_camera_pixels;
-    city_view_get_camera_in_pixels(&original_camera_pixels.x, &original_camera_pixels.y);
-    int width = screen_width();
-    int height = screen_height();
-
-    int city_width_pixels = map_grid_width() * TILE_X_SIZE;
-    int city_height_pixels = map_grid_height() * TILE_Y_SIZE;
-
-    if (!image_create(city_width_pixels, city_height_pixels + TILE_Y_SIZE, IMAGE_HEIGHT_CHUNK)) {
+    int width, height;
+    graphics_city_bands_size(&width, &height);
+    if (!image_create(width, height, CITY_BAND_HEIGHT)) {
         log_error("Unable to set memory for full city screenshot", 0, 0);
         return;
     }
@@ -239,35 +337,18 @@ static void full_city_screenshot(void)
         image_free();
         return;
     }
-
-    int canvas_width = city_width_pixels + (city_view_is_sidebar_collapsed() ? 40 : 160);
-    screen_set_resolution(canvas_width, TOP_MENU_HEIGHT + IMAGE_HEIGHT_CHUNK);
-    graphics_set_clip_rectangle(0, TOP_MENU_HEIGHT, city_width_pixels, IMAGE_HEIGHT_CHUNK);
-
-    int base_width = (GRID_SIZE * TILE_X_SIZE - city_width_pixels) / 2 + TILE_X_SIZE;
-    int max_height = (GRID_SIZE * TILE_Y_SIZE + city_height_pixels) / 2;
-    int min_height = max_height - city_height_pixels - TILE_Y_SIZE;
-    map_tile dummy_tile = { 0, 0, 0 };
-    int error = 0;
-    int current_height = image_set_loop_height_limits(min_height, max_height);
-    int size;
-    const color_t *canvas = (color_t *) graphics_canvas() + TOP_MENU_HEIGHT * canvas_width;
-    while ((size = image_request_rows())) {
-        city_view_set_camera_from_pixel_position(base_width, current_height);
-        city_without_overlay_draw(0, 0, &dummy_tile);
-        if (!image_write_rows(canvas, canvas_width)) {
-            log_error("Error writing image", 0, 0);
-            error = 1;
-            break;
-        }
-        current_height += size;
+    // the bands are drawn on the game thread: the canvas, clip rectangle, camera and the
+    // draw context of the city widget are all shared, so only the compression is moved away
+    queue_start();
+    int ok = graphics_draw_city_bands(OVERLAY_NONE, write_band, 0);
+    if (!queue_finish()) {
+        ok = 0;
     }
-    graphics_reset_clip_rectangle();
-    screen_set_resolution(width, height);
-    city_view_set_camera_from_pixel_position(original_camera_pixels.x, original_camera_pixels.y);
-    if (!error) {
+    if (ok) {
         image_finish();
         log_info("Saved full city screenshot:", filename, 0);
+    } else {
+        log_error("Error writing image", 0, 0);
     }
     image_free();
 }
@@ -38,6 +38,30 @@ static int get_ellipsis_width(font_t font)
     return ellipsis.width[font];
 }
 
+static int get_letter_id(const font_definition *def, const font_glyph_metrics *glyphs,
+                         const uint8_t *str, int *num_bytes)
+{
+    int letter_id = glyphs->letter_id[*str];
+    if (letter_id == FONT_LETTER_MULTIBYTE) {
+        return font_letter_id(def, str, num_bytes);
+    }
+    *num_bytes = 1;
+    return letter_id;
+}
+
+/**
+ * Returns the image width of the letter at the start of the string, or -1 if there is no letter
+ */
+static int get_letter_width(const font_definition *def, const font_glyph_metrics *glyphs,
+                            const uint8_t *str, int *num_bytes)
+{
+    int letter_id = get_letter_id(def, glyphs, str, num_bytes);
+    if (letter_id < 0) {
+        return -1;
+    }
+    return *num_bytes == 1 ? glyphs->width[*str] : image_letter(letter_id)->width;
+}
+
 void text_capture_cursor(int cursor_position, int offset_start, int offset_end)
 {
     input_cursor.capture = 1;
@@ -86,6 +110,7 @@ void text_draw_cursor(int x_offset, int y_offset, int is_insert)
 int text_get_width(const uint8_t *str, font_t font)
 {
     const font_definition *def = font_definition_for(font);
+    const font_glyph_metrics *glyphs = font_glyph_metrics_for(font);
     int maxlen = 10000;
     int width = 0;
     while (*str && maxlen > 0) {
@@ -93,9 +118,9 @@ int text_get_width(const uint8_t *str, font_t font)
         if (*str == ' ') {
             width += def->space_width;
         } else {
-            int letter_id = font_letter_id(def, str, &num_bytes);
-            if (letter_id >= 0) {
-                width += def->letter_spacing + image_letter(letter_id)->width;
+            int letter_width = get_letter_width(def, glyphs, str, &num_bytes);
+            if (letter_width >= 0) {
+                width += def->letter_spacing + letter_width;
             }
         }
         str += num_bytes;
@@ -107,6 +132,7 @@ int text_get_width(const uint8_t *str, font_t font)
 unsigned int text_get_max_length_for_width(const uint8_t *str, int length, font_t font, unsigned int requested_width, int invert)
 {
     const font_definition *def = font_definition_for(font);
+    const font_glyph_metrics *glyphs = font_glyph_metrics_for(font);
     length = (!length) ? string_length(str) : length;
     unsigned int maxlen = length;
     unsigned int width = 0;
@@ -121,9 +147,9 @@ unsigned int text_get_max_length_for_width(const uint8_t *str, int length, font_
         if (*str == ' ') {
             width += def->space_width;
         } else {
-            int letter_id = font_letter_id(def, str, &num_bytes);
-            if (letter_id >= 0) {
-                width += def->letter_spacing + image_letter(letter_id)->width;
+            int letter_width = get_letter_width(def, glyphs, str, &num_bytes);
+            if (letter_width >= 0) {
+                width += def->letter_spacing + letter_width;
             }
         }
         if (width > requested_width) {
@@ -139,6 +165,7 @@ void text_ellipsize(uint8_t *str, font_t font, int requested_width)
 {
     uint8_t *orig_str = str;
     const font_definition *def = font_definition_for(font);
+    const font_glyph_metrics *glyphs = font_glyph_metrics_for(font);
     int ellipsis_width = get_ellipsis_width(font);
     int maxlen = 10000;
     int width = 0;
@@ -148,9 +175,9 @@ void text_ellipsize(uint8_t *str, font_t font, int requested_width)
         if (*str == ' ') {
             width += def->space_width;
         } else {
-            int letter_id = font_letter_id(def, str, &num_bytes);
-            if (letter_id >= 0) {
-                width += def->letter_spacing + image_letter(letter_id)->width;
+            int letter_width = get_letter_width(def, glyphs, str, &num_bytes);
+            if (letter_width >= 0) {
+                width += def->letter_spacing + letter_width;
             }
         }
         if (ellipsis_width + width <= requested_width) {
@@ -170,6 +197,7 @@ void text_ellipsize(uint8_t *str, font_t font, int requested_width)
 static int get_word_width(const uint8_t *str, font_t font, int *out_num_chars)
 {
     const font_definition *def = font_definition_for(font);
+    const font_glyph_metrics *glyphs = font_glyph_metrics_for(font);
     int width = 0;
     int guard = 0;
     int word_char_seen = 0;
@@ -187,9 +215,9 @@ static int get_word_width(const uint8_t *str, font_t font, int *out_num_chars)
             }
         } else if (*str > ' ') {
             // normal char
-            int letter_id = font_letter_id(def, str, &num_bytes);
-            if (letter_id >= 0) {
-                width += 1 + image_letter(letter_id)->width;
+            int letter_width = get_letter_width(def, glyphs, str, &num_bytes);
+            if (letter_width >= 0) {
+                width += 1 + letter_width;
             }
             word_char_seen = 1;
             if (num_bytes > 1) {
@@ -216,6 +244,7 @@ void text_draw_centered(const uint8_t *str, int x, int y, int box_width, font_t
 int text_draw(const uint8_t *str, int x, int y, font_t font, color_t color)
 {
     const font_definition *def = font_definition_for(font);
+    const font_glyph_metrics *glyphs = font_glyph_metrics_for(font);
 
     int length = string_length(str);
     if (input_cursor.capture) {
@@ -228,7 +257,7 @@ int text_draw(const uint8_t *str, int x, int y, font_t font, color_t color)
         int num_bytes = 1;
 
         if (*str >= ' ') {
-            int letter_id = font_letter_id(def, str, &num_bytes);
+            int letter_id = get_letter_id(def, glyphs, str, &num_bytes);
             int width;
             if (*str == ' ' || *str == '_' || letter_id < 0) {
                 width = def->space_width_draw;
@@ -0,0 +1,321 @@
+#include "tile_export.h"
+
+#include "core/dir.h"
+#include "core/file.h"
+#include "core/log.h"
+#include "game/state.h"
+#include "graphics/city_bands.h"
+#include "graphics/window.h"
+
+#include "png/png.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define EXPORT_TILE_SIZE 256
+#define MAX_LEVELS 32
+
+/**
+ * The layers that are exported: the city itself and every overlay
+ */
+static const struct {
+    int overlay;
+    const char *name;
+} LAYERS[] = {
+    {OVERLAY_NONE, 0},
+    {OVERLAY_WATER, "water"},
+    {OVERLAY_RELIGION, "religion"},
+    {OVERLAY_FIRE, "fire"},
+    {OVERLAY_DAMAGE, "damage"},
+    {OVERLAY_CRIME, "crime"},
+    {OVERLAY_ENTERTAINMENT, "entertainment"},
+    {OVERLAY_THEATER, "theater"},
+    {OVERLAY_AMPHITHEATER, "amphitheater"},
+    {OVERLAY_COLOSSEUM, "colosseum"},
+    {OVERLAY_HIPPODROME, "hippodrome"},
+    {OVERLAY_EDUCATION, "education"},
+    {OVERLAY_SCHOOL, "school"},
+    {OVERLAY_LIBRARY, "library"},
+    {OVERLAY_ACADEMY, "academy"},
+    {OVERLAY_BARBER, "barber"},
+    {OVERLAY_BATHHOUSE, "bathhouse"},
+    {OVERLAY_CLINIC, "clinic"},
+    {OVERLAY_HOSPITAL, "hospital"},
+    {OVERLAY_TAX_INCOME, "tax income"},
+    {OVERLAY_FOOD_STOCKS, "food stocks"},
+    {OVERLAY_DESIRABILITY, "desirability"},
+    {OVERLAY_NATIVE, "native"},
+    {OVERLAY_PROBLEMS, "problems"}
+};
+
+#define NUM_LAYERS (sizeof(LAYERS) / sizeof(LAYERS[0]))
+
+/**
+ * Every zoom level keeps one row of tiles in memory. Level max_level is the city at full
+ * size, every lower level is half the size of the one above it. Rows of a level are
+ * combined in pairs into one row of the level below.
+ */
+typedef struct {
+    int width;
+    int height;
+    int rows_filled;
+    int tile_row;
+    int has_pending_row;
+    color_t *band;
+    color_t *pending_row;
+} zoom_level;
+
+static struct {
+    char name[FILE_NAME_MAX];
+    int max_level;
+    zoom_level levels[MAX_LEVELS];
+    uint8_t *png_row;
+    int error;
+} data;
+
+static void free_levels(void)
+{
+    for (int i = 0; i < MAX_LEVELS; i++) {
+        free(data.levels[i].band);
+        free(data.levels[i].pending_row);
+    }
+    memset(data.levels, 0, sizeof(data.levels));
+    free(data.png_row);
+    data.png_row = 0;
+}
+
+static int init_levels(int width, int height)
+{
+    data.max_level = 0;
+    while ((1 << data.max_level) < width || (1 << data.max_level) < height) {
+        data.max_level++;
+    }
+    for (int level = data.max_level; level >= 0; level--) {
+        int shift = data.max_level - level;
+        zoom_level *z = &data.levels[level];
+        z->width = ((width - 1) >> shift) + 1;
+        z->height = ((height - 1) >> shift) + 1;
+        z->band = (color_t *) malloc((size_t) z->width * EXPORT_TILE_SIZE * sizeof(color_t));
+        z->pending_row = (color_t *) malloc((size_t) z->width * sizeof(color_t));
+        if (!z->band || !z->pending_row) {
+            return 0;
+        }
+    }
+    data.png_row = (uint8_t *) malloc((size_t) EXPORT_TILE_SIZE * 3);
+    return data.png_row != 0;
+}
+
+static int create_level_directories(void)
+{
+    char path[FILE_NAME_MAX];
+    snprintf(path, FILE_NAME_MAX, "%s_files", data.name);
+    if (!dir_create(path)) {
+        return 0;
+    }
+    for (int level = 0; level <= data.max_level; level++) {
+        snprintf(path, FILE_NAME_MAX, "%s_files/%d", data.name, level);
+        if (!dir_create(path)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int write_tile(const char *filename, const color_t *pixels, int stride, int width, int height)
+{
+    FILE *fp = file_open(filename, "wb");
+    if (!fp) {
+        return 0;
+    }
+    png_structp png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, 0, 0, 0);
+    png_infop info_ptr = png_ptr ? png_create_info_struct(png_ptr) : 0;
+    if (!info_ptr || setjmp(png_jmpbuf(png_ptr))) {
+        png_destroy_write_struct(&png_ptr, &info_ptr);
+        file_close(fp);
+        return 0;
+    }
+    png_set_compression_level(png_ptr, 3);
+    png_init_io(png_ptr, fp);
+    png_set_IHDR(png_ptr, info_ptr, width, height, 8, PNG_COLOR_TYPE_RGB,
+        PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(png_ptr, info_ptr);
+    for (int y = 0; y < height; y++) {
+        const color_t *input = &pixels[y * stride];
+        uint8_t *pixel = data.png_row;
+        for (int x = 0; x < width; x++) {
+            *(pixel + 0) = (uint8_t) ((input[x] & 0xff0000) >> 16);
+            *(pixel + 1) = (uint8_t) ((input[x] & 0x00ff00) >> 8);
+            *(pixel + 2) = (uint8_t) ((input[x] & 0x0000ff) >> 0);
+            pixel += 3;
+        }
+        png_write_row(png_ptr, data.png_row);
+    }
+    png_write_end(png_ptr, info_ptr);
+    png_destroy_write_struct(&png_ptr, &info_ptr);
+    file_close(fp);
+    return 1;
+}
+
+static void flush_band(int level)
+{
+    zoom_level *z = &data.levels[level];
+    if (!z->rows_filled) {
+        return;
+    }
+    char filename[FILE_NAME_MAX];
+    for (int x = 0, column = 0; x < z->width && !data.error; x += EXPORT_TILE_SIZE, column++) {
+        int width = z->width - x < EXPORT_TILE_SIZE ? z->width - x : EXPORT_TILE_SIZE;
+        snprintf(filename, FILE_NAME_MAX, "%s_files/%d/%d_%d.png", data.name, level, column, z->tile_row);
+        if (!write_tile(filename, &z->band[x], z->width, width, z->rows_filled)) {
+            log_error("Unable to write tile:", filename, 0);
+            data.error = 1;
+        }
+    }
+    z->rows_filled = 0;
+    z->tile_row++;
+}
+
+static color_t average_color(color_t c1, color_t c2, color_t c3, color_t c4)
+{
+    color_t r = (((c1 >> 16) & 0xff) + ((c2 >> 16) & 0xff) + ((c3 >> 16) & 0xff) + ((c4 >> 16) & 0xff)) / 4;
+    color_t g = (((c1 >> 8) & 0xff) + ((c2 >> 8) & 0xff) + ((c3 >> 8) & 0xff) + ((c4 >> 8) & 0xff)) / 4;
+    color_t b = ((c1 & 0xff) + (c2 & 0xff) + (c3 & 0xff) + (c4 & 0xff)) / 4;
+    return (r << 16) | (g << 8) | b;
+}
+
+static void add_row(int level, const color_t *row);
+
+static void add_half_size_row(int level, const color_t *row1, const color_t *row2)
+{
+    zoom_level *z = &data.levels[level];
+    int source_width = data.levels[level + 1].width;
+    // the band row is free: combine directly into it
+    color_t *target = &z->band[z->rows_filled * z->width];
+    for (int x = 0; x < z->width; x++) {
+        int x1 = 2 * x;
+        int x2 = x1 + 1 < source_width ? x1 + 1 : x1;
+        target[x] = average_color(row1[x1], row1[x2], row2[x1], row2[x2]);
+    }
+    add_row(level, 0);
+}
+
+/**
+ * Adds a row to the band of the level; a null row means it was already written to the band
+ */
+static void add_row(int level, const color_t *row)
+{
+    zoom_level *z = &data.levels[level];
+    color_t *band_row = &z->band[z->rows_filled * z->width];
+    if (row) {
+        memcpy(band_row, row, z->width * sizeof(color_t));
+    }
+    if (level > 0) {
+        if (z->has_pending_row) {
+            add_half_size_row(level - 1, z->pending_row, band_row);
+            z->has_pending_row = 0;
+        } else {
+            memcpy(z->pending_row, band_row, z->width * sizeof(color_t));
+            z->has_pending_row = 1;
+        }
+    }
+    z->rows_filled++;
+    if (z->rows_filled == EXPORT_TILE_SIZE) {
+        flush_band(level);
+    }
+}
+
+static void finish_levels(void)
+{
+    for (int level = data.max_level; level >= 0; level--) {
+        zoom_level *z = &data.levels[level];
+        if (level > 0 && z->has_pending_row) {
+            add_half_size_row(level - 1, z->pending_row, z->pending_row);
+            z->has_pending_row = 0;
+        }
+        flush_band(level);
+    }
+}
+
+static int write_index(int width, int height)
+{
+    char filename[FILE_NAME_MAX];
+    snprintf(filename, FILE_NAME_MAX, "%s.dzi", data.name);
+    FILE *fp = file_open(filename, "w");
+    if (!fp) {
+        return 0;
+    }
+    fprintf(fp, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    fprintf(fp, "<Image xmlns=\"http://schemas.microsoft.com/deepzoom/2008\" "
+        "TileSize=\"%d\" Overlap=\"0\" Format=\"png\">\n", EXPORT_TILE_SIZE);
+    fprintf(fp, "    <Size Width=\"%d\" Height=\"%d\"/>\n", width, height);
+    fprintf(fp, "</Image>\n");
+    file_close(fp);
+    return 1;
+}
+
+static void generate_name(const char *date, const char *layer)
+{
+    if (layer) {
+        snprintf(data.name, FILE_NAME_MAX, "city tiles %s %s", date, layer);
+    } else {
+        snprintf(data.name, FILE_NAME_MAX, "city tiles %s", date);
+    }
+}
+
+static int add_band(const color_t *pixels, int stride, void *unused)
+{
+    for (int row = 0; row < CITY_BAND_HEIGHT && !data.error; row++) {
+        add_row(data.max_level, &pixels[row * stride]);
+    }
+    return !data.error;
+}
+
+static int export_layer(const char *date, int layer, int width, int height)
+{
+    data.error = 0;
+    generate_name(date, LAYERS[layer].name);
+    if (!init_levels(width, height)) {
+        log_error("Unable to set memory for city tiles", 0, 0);
+        free_levels();
+        return 0;
+    }
+    if (!create_level_directories()) {
+        log_error("Unable to create directories for city tiles:", data.name, 0);
+        free_levels();
+        return 0;
+    }
+    if (!graphics_draw_city_bands(LAYERS[layer].overlay, add_band, 0)) {
+        data.error = 1;
+    }
+    if (!data.error) {
+        finish_levels();
+    }
+    free_levels();
+
+    if (data.error || !write_index(width, height)) {
+        log_error("Error exporting city tiles:", data.name, 0);
+        return 0;
+    }
+    log_info("Exported city tiles:", data.name, 0);
+    return 1;
+}
+
+void graphics_export_city_tiles(void)
+{
+    if (!window_is(WINDOW_CITY) && !window_is(WINDOW_CITY_MILITARY)) {
+        return;
+    }
+    int width, height;
+    graphics_city_bands_size(&width, &height);
+    char date[FILE_NAME_MAX];
+    time_t curtime = time(NULL);
+    strftime(date, FILE_NAME_MAX, "%Y-%m-%d %H.%M.%S", localtime(&curtime));
+
+    for (int layer = 0; layer < NUM_LAYERS; layer++) {
+        if (!export_layer(date, layer, width, height)) {
+            break;
+        }
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef GRAPHICS_TILE_EXPORT_H
+#define GRAPHICS_TILE_EXPORT_H
+
+/**
+ * @file
+ * Export of the whole city as a Deep Zoom tile pyramid for external map viewers.
+ */
+
+/**
+ * Exports the city as Deep Zoom images: one for the city itself and one for every overlay,
+ * each a .dzi index file and a directory with PNG tiles for every zoom level. The city is
+ * drawn band by band, so memory use does not depend on the height of the map. The overlay
+ * that was shown is shown again afterwards.
+ */
+void graphics_export_city_tiles(void);
+
+#endif // GRAPHICS_TILE_EXPORT_H
@@ -5,11 +5,29 @@
 #include "core/smacker.h"
 #include "core/time.h"
 #include "game/settings.h"
+#include "game/system.h"
 #include "graphics/graphics.h"
 #include "sound/device.h"
 #include "sound/music.h"
 #include "sound/speech.h"
 
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_DECODED_FRAMES 4
+
+/**
+ * A frame that is decoded and converted to the colors of the canvas
+ */
+typedef struct {
+    color_t *pixels;
+    int has_video;
+    uint8_t *audio;
+    int audio_len;
+    int audio_size;
+    int is_ok;
+} decoded_frame;
+
 static struct {
     int is_playing;
     int is_ended;
@@ -29,10 +47,162 @@ static struct {
         int channels;
         int rate;
     } audio;
+    /**
+     * Ring of decoded frames: the one being shown is held by video_draw, the decoder
+     * thread fills the others in order ahead of it
+     */
+    struct {
+        decoded_frame frames[MAX_DECODED_FRAMES];
+        int current;
+        int next_decode;
+        void *free_frames;
+        void *decoded_frames;
+        void *decoder;
+        int stop;
+    } ahead;
 } data;
 
+static void draw_line(color_t *pixel, const unsigned char *line, const uint32_t *pal, int width)
+{
+    for (int x = 0; x < width; x++) {
+        pixel[x] = pal[line[x]];
+    }
+}
+
+static void convert_frame(decoded_frame *f)
+{
+    const unsigned char *frame = smacker_get_frame_video(data.s);
+    const uint32_t *pal = smacker_get_frame_palette(data.s);
+    f->has_video = frame && pal;
+    if (!f->has_video) {
+        return;
+    }
+    int width = data.video.width;
+    int height = data.video.y_scale == SMACKER_Y_SCALE_NONE ? data.video.height : data.video.height / 2;
+    for (int y = 0; y < height; y++) {
+        draw_line(&f->pixels[y * width], &frame[y * width], pal, width);
+    }
+}
+
+static void copy_audio(decoded_frame *f)
+{
+    f->audio_len = 0;
+    if (!data.audio.has_audio) {
+        return;
+    }
+    int audio_len = smacker_get_frame_audio_size(data.s, 0);
+    if (audio_len <= 0) {
+        return;
+    }
+    if (audio_len > f->audio_size) {
+        uint8_t *audio = (uint8_t *) realloc(f->audio, audio_len);
+        if (!audio) {
+            return;
+        }
+        f->audio = audio;
+        f->audio_size = audio_len;
+    }
+    memcpy(f->audio, smacker_get_frame_audio(data.s, 0), audio_len);
+    f->audio_len = audio_len;
+}
+
+static void decode_frame(decoded_frame *f)
+{
+    f->is_ok = smacker_next_frame(data.s) == SMACKER_FRAME_OK;
+    if (f->is_ok) {
+        convert_frame(f);
+        copy_audio(f);
+    }
+}
+
+static int decode_ahead(void *unused)
+{
+    while (1) {
+        system_wait_semaphore(data.ahead.free_frames);
+        if (data.ahead.stop) {
+            return 0;
+        }
+        decoded_frame *f = &data.ahead.frames[data.ahead.next_decode];
+        data.ahead.next_decode = (data.ahead.next_decode + 1) % MAX_DECODED_FRAMES;
+        decode_frame(f);
+        system_post_semaphore(data.ahead.decoded_frames);
+        if (!f->is_ok) {
+            return 0;
+        }
+    }
+}
+
+/**
+ * Starts the decoder thread; without it, video_draw decodes the frames itself
+ */
+static void start_decoder(void)
+{
+    data.ahead.stop = 0;
+    data.ahead.next_decode = (data.ahead.current + 1) % MAX_DECODED_FRAMES;
+    data.ahead.free_frames = system_create_semaphore(MAX_DECODED_FRAMES - 1);
+    data.ahead.decoded_frames = system_create_semaphore(0);
+    if (data.ahead.free_frames && data.ahead.decoded_frames) {
+        data.ahead.decoder = system_create_thread(decode_ahead, 0);
+    }
+}
+
+static void stop_decoder(void)
+{
+    if (data.ahead.decoder) {
+        data.ahead.stop = 1;
+        system_post_semaphore(data.ahead.free_frames);
+        system_wait_thread(data.ahead.decoder);
+        data.ahead.decoder = 0;
+    }
+    system_destroy_semaphore(data.ahead.free_frames);
+    system_destroy_semaphore(data.ahead.decoded_frames);
+    data.ahead.free_frames = 0;
+    data.ahead.decoded_frames = 0;
+}
+
+static void free_frames(void)
+{
+    for (int i = 0; i < MAX_DECODED_FRAMES; i++) {
+        free(data.ahead.frames[i].pixels);
+        free(data.ahead.frames[i].audio);
+    }
+    memset(data.ahead.frames, 0, sizeof(data.ahead.frames));
+}
+
+static int allocate_frames(void)
+{
+    free_frames();
+    for (int i = 0; i < MAX_DECODED_FRAMES; i++) {
+        data.ahead.frames[i].pixels = (color_t *) malloc((size_t) data.video.width * data.video.height * sizeof(color_t));
+        if (!data.ahead.frames[i].pixels) {
+            free_frames();
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Moves on to the next decoded frame, waiting for the decoder thread when it is not ready yet
+ */
+static decoded_frame *next_frame(void)
+{
+    int next = (data.ahead.current + 1) % MAX_DECODED_FRAMES;
+    if (data.ahead.decoder) {
+        system_wait_semaphore(data.ahead.decoded_frames);
+        // the frame that was shown can be decoded into again
+        system_post_semaphore(data.ahead.free_frames);
+    } else {
+        decode_frame(&data.ahead.frames[next]);
+    }
+    data.ahead.current = next;
+    return &data.ahead.frames[next];
+}
+
 static void close_smk(void)
 {
+    stop_decoder();
+    free_frames();
     if (data.s) {
         smacker_close(data.s);
         data.s = 0;
@@ -74,10 +244,14 @@ static int load_smk(const char *filename)
         }
     }
 
-    if (smacker_first_frame(data.s) != SMACKER_FRAME_OK) {
+    if (smacker_first_frame(data.s) != SMACKER_FRAME_OK || !allocate_frames()) {
         close_smk();
         return 0;
     }
+    data.ahead.current = 0;
+    data.ahead.frames[0].is_ok = 1;
+    convert_frame(&data.ahead.frames[0]);
+    copy_audio(&data.ahead.frames[0]);
     return 1;
 }
 
@@ -112,15 +286,14 @@ void video_init(void)
 {
     data.video.start_render_millis = time_get_millis();
 
-    if (data.audio.has_audio) {
-        int audio_len = smacker_get_frame_audio_size(data.s, 0);
-        if (audio_len > 0) {
-            sound_device_use_custom_music_player(
-                data.audio.bitdepth, data.audio.channels, data.audio.rate,
-                smacker_get_frame_audio(data.s, 0), audio_len
-            );
-        }
+    const decoded_frame *first = &data.ahead.frames[0];
+    if (data.audio.has_audio && first->audio_len > 0) {
+        sound_device_use_custom_music_player(
+            data.audio.bitdepth, data.audio.channels, data.audio.rate,
+            first->audio, first->audio_len
+        );
     }
+    start_decoder();
 }
 
 int video_is_finished(void)
@@ -156,8 +329,10 @@ void video_draw(int x_offset, int y_offset)
 
     int frame_no = (now_millis - data.video.start_render_millis) * 1000 / data.video.micros_per_frame;
     int draw_frame = data.video.current_frame == 0;
+    const decoded_frame *frame = &data.ahead.frames[data.ahead.current];
     while (frame_no > data.video.current_frame) {
-        if (smacker_next_frame(data.s) != SMACKER_FRAME_OK) {
+        frame = next_frame();
+        if (!frame->is_ok) {
             close_smk();
             data.is_ended = 1;
             data.is_playing = 0;
@@ -167,31 +342,21 @@ void video_draw(int x_offset, int y_offset)
         data.video.current_frame++;
         draw_frame = 1;
 
-        if (data.audio.has_audio) {
-            int audio_len = smacker_get_frame_audio_size(data.s, 0);
-            if (audio_len > 0) {
-                sound_device_write_custom_music_data(smacker_get_frame_audio(data.s, 0), audio_len);
-            }
+        if (frame->audio_len > 0) {
+            sound_device_write_custom_music_data(frame->audio, frame->audio_len);
         }
     }
-    if (!draw_frame) {
+    if (!draw_frame || !frame->has_video) {
         return;
     }
     const clip_info *clip = graphics_get_clip_info(x_offset, y_offset, data.video.width, data.video.height);
     if (!clip->is_visible) {
         return;
     }
-    const unsigned char *frame = smacker_get_frame_video(data.s);
-    const uint32_t *pal = smacker_get_frame_palette(data.s);
-    if (frame && pal) {
-        for (int y = clip->clipped_pixels_top; y < clip->visible_pixels_y; y++) {
-            color_t *pixel = graphics_get_pixel(x_offset + clip->clipped_pixels_left, y + y_offset + clip->clipped_pixels_top);
-            int video_y = data.video.y_scale == SMACKER_Y_SCALE_NONE ? y : y / 2;
-            const unsigned char *line = frame + (video_y * data.video.width);
-            for (int x = clip->clipped_pixels_left; x < clip->visible_pixels_x; x++) {
-                *pixel = pal[line[x]];
-                ++pixel;
-            }
-        }
+    int width = clip->visible_pixels_x - clip->clipped_pixels_left;
+    for (int y = clip->clipped_pixels_top; y < clip->visible_pixels_y; y++) {
+        color_t *pixel = graphics_get_pixel(x_offset + clip->clipped_pixels_left, y + y_offset + clip->clipped_pixels_top);
+        int video_y = data.video.y_scale == SMACKER_Y_SCALE_NONE ? y : y / 2;
+        memcpy(pixel, &frame->pixels[video_y * data.video.width + clip->clipped_pixels_left], width * sizeof(color_t));
     }
 }
@@ -7,10 +7,13 @@
 #include "city/warning.h"
 #include "figure/formation.h"
 #include "game/orientation.h"
+#include "game/rewind.h"
 #include "game/settings.h"
 #include "game/state.h"
 #include "game/system.h"
+#include "game/time.h"
 #include "graphics/screenshot.h"
+#include "graphics/tile_export.h"
 #include "graphics/video.h"
 #include "graphics/window.h"
 #include "input/scroll.h"
@@ -78,6 +81,14 @@ static void toggle_pause(void)
     }
 }
 
+static void toggle_turbo(void)
+{
+    exit_military_command();
+    if (window_is(WINDOW_CITY)) {
+        game_state_toggle_turbo();
+    }
+}
+
 static void show_advisor(advisor_type advisor)
 {
     exit_military_command();
@@ -146,6 +157,23 @@ static void cheat_money(void)
     }
 }
 
+static void rewind_day(void)
+{
+    exit_military_command();
+    if (window_is(WINDOW_CITY)) {
+        // at the very start of a day, go back to the start of the previous one, if there is one
+        int days = game_time_tick() > 0 ? 1 : 2;
+        int available = game_rewind_days_available();
+        if (days > available) {
+            days = available;
+        }
+        if (game_rewind_go_back(days)) {
+            city_warning_clear_all();
+            window_invalidate();
+        }
+    }
+}
+
 static void editor_toggle_battle_info(void)
 {
     if (window_is(WINDOW_EDITOR_EMPIRE)) {
@@ -180,6 +208,12 @@ void hotkey_character(int c, int with_ctrl, int with_alt)
             case 'v':
                 cheat_victory();
                 break;
+            case 'r':
+                rewind_day();
+                break;
+            case 'f':
+                toggle_turbo();
+                break;
 
             // Azerty keyboards need alt gr for these keys
             case '[': case '5':
@@ -400,6 +434,11 @@ void hotkey_func(int f_number, int with_any_modifier, int with_ctrl)
         case 7: system_resize(640, 480); break;
         case 8: system_resize(800, 600); break;
         case 9: system_resize(1024, 768); break;
+        case 11:
+            if (with_ctrl) {
+                graphics_export_city_tiles();
+            }
+            break;
         case 12: take_screenshot(with_ctrl); break;
     }
 }
@@ -3,11 +3,14 @@
 #include "building/building.h"
 #include "core/config.h"
 #include "map/grid.h"
+#include "map/house_service.h"
+#include "map/water_supply.h"
 
 static grid_u16 buildings_grid;
 static grid_u8 damage_grid;
 static grid_u8 rubble_type_grid;
 static grid_u8 highlight_grid;
+static unsigned int changes;
 
 int map_building_at(int grid_offset)
 {
@@ -17,9 +20,21 @@ int map_building_at(int grid_offset)
     return buildings_grid.items[grid_offset];
 }
 
+unsigned int map_building_changes(void)
+{
+    return changes;
+}
+
 void map_building_set(int grid_offset, int building_id)
 {
-    buildings_grid.items[grid_offset] = building_id;
+    int old_building_id = buildings_grid.items[grid_offset];
+    if (old_building_id != building_id) {
+        buildings_grid.items[grid_offset] = building_id;
+        changes++;
+        map_house_service_invalidate(grid_offset);
+        map_water_supply_building_changed(old_building_id);
+        map_water_supply_building_changed(building_id);
+    }
 }
 
 void map_building_damage_clear(int grid_offset)
@@ -65,8 +80,10 @@ void map_set_rubble_building_type(int grid_offset, building_type type)
 void map_building_clear(void)
 {
     map_grid_clear_u16(buildings_grid.items);
+    changes++;
     map_grid_clear_u8(damage_grid.items);
     map_grid_clear_u8(rubble_type_grid.items);
+    map_house_service_clear();
 }
 
 void map_clear_highlights(void)
@@ -83,7 +100,9 @@ void map_building_save_state(buffer *buildings, buffer *damage)
 void map_building_load_state(buffer *buildings, buffer *damage)
 {
     map_grid_load_state_u16(buildings_grid.items, buildings);
+    changes++;
     map_grid_load_state_u8(damage_grid.items, damage);
+    map_house_service_clear();
 }
 
 int map_building_is_reservoir(int x, int y)
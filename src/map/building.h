@@ -13,6 +13,11 @@ int map_building_at(int grid_offset);
 
 void map_building_set(int grid_offset, int building_id);
 
+/**
+ * Returns a counter that is increased whenever the building on any tile changes
+ */
+unsigned int map_building_changes(void);
+
 /**
  * Increases building damage by 1
  * @param grid_offset Map offset
@@ -3,20 +3,65 @@
 #include "building/building.h"
 #include "building/model.h"
 #include "core/calc.h"
+#include "core/log.h"
 #include "map/data.h"
 #include "map/grid.h"
 #include "map/property.h"
 #include "map/ring.h"
 #include "map/terrain.h"
 
+#include <string.h>
+
+#define MAX_CLAMPED_SUM 100
+
+typedef enum {
+    SOURCE_NONE = 0,
+    SOURCE_PLAZA = 1,
+    SOURCE_EARTHQUAKE = 2,
+    SOURCE_GARDEN = 3,
+    SOURCE_RUBBLE = 4
+} terrain_source;
+
+typedef struct {
+    int active;
+    int x;
+    int y;
+    int size;
+    int value;
+    int step;
+    int step_size;
+    int range;
+} desirability_source;
+
+typedef void (*tile_function)(int grid_offset, int desirability);
+
 static grid_i8 desirability_grid;
 
+/**
+ * The desirability grid is clamped after every addition, which makes the result depend on
+ * the order of the sources. To update it incrementally, the unclamped sum is kept as well
+ * as the total of positive and negative contributions: as long as both totals stay within
+ * the clamping bounds, no partial sum can have been clamped and the grid equals the sum.
+ */
+static struct {
+    int is_valid;
+    int needs_reclamp;
+    int max_source_id;
+    desirability_source buildings[MAX_BUILDINGS];
+    grid_u8 terrain;
+    grid_i16 sum;
+    grid_u16 positive;
+    grid_u16 negative;
+} data;
+
 void map_desirability_clear(void)
 {
     map_grid_clear_i8(desirability_grid.items);
+    data.is_valid = 0;
 }
 
-static void add_desirability_at_distance(int x, int y, int size, int distance, int desirability)
+static void add_desirability_at_distance(int x, int y, int size, int distance, int desirability,
+    tile_function apply)
 {
     int partially_outside_map = 0;
     if (x - distance < -1 || x + distance + size - 1 > map_data.width) {
@@ -33,98 +78,274 @@ static void add_desirability_at_distance(int x, int y, int size, int distance, i
         for (int i = start; i < end; i++) {
             const ring_tile *tile = map_ring_tile(i);
             if (map_ring_is_inside_map(x + tile->x, y + tile->y)) {
-                desirability_grid.items[base_offset + tile->grid_offset] =
-                    calc_bound(desirability_grid.items[base_offset + tile->grid_offset] + desirability, -100, 100);
+                apply(base_offset + tile->grid_offset, desirability);
             }
         }
     } else {
         for (int i = start; i < end; i++) {
             const ring_tile *tile = map_ring_tile(i);
-            desirability_grid.items[base_offset + tile->grid_offset] =
-                calc_bound(desirability_grid.items[base_offset + tile->grid_offset] + desirability, -100, 100);
+            apply(base_offset + tile->grid_offset, desirability);
         }
     }
 }
 
-static void add_to_terrain(int x, int y, int size, int desirability, int step, int step_size, int range)
+static void add_to_terrain(const desirability_source *source, tile_function apply)
 {
-    if (size > 0) {
+    if (source->active && source->size > 0) {
+        int range = source->range;
         if (range > 6) range = 6;
+        int desirability = source->value;
         int tiles_within_step = 0;
         int distance = 1;
         while (range > 0) {
-            add_desirability_at_distance(x, y, size, distance, desirability);
+            add_desirability_at_distance(source->x, source->y, source->size, distance, desirability, apply);
             distance++;
             range--;
             tiles_within_step++;
-            if (tiles_within_step >= step) {
-                desirability += step_size;
+            if (tiles_within_step >= source->step) {
+                desirability += source->step_size;
                 tiles_within_step = 0;
             }
         }
     }
 }
 
-static void update_buildings(void)
+static void clamp_to_tile(int grid_offset, int desirability)
 {
-    int max_id = building_get_highest_id();
-    for (int i = 1; i <= max_id; i++) {
-        building *b = building_get(i);
-        if (b->state == BUILDING_STATE_IN_USE) {
-            const model_building *model = model_get_building(b->type);
-            add_to_terrain(
-                b->x, b->y, b->size,
-                model->desirability_value,
-                model->desirability_step,
-                model->desirability_step_size,
-                model->desirability_range);
+    desirability_grid.items[grid_offset] =
+        calc_bound(desirability_grid.items[grid_offset] + desirability, -MAX_CLAMPED_SUM, MAX_CLAMPED_SUM);
+}
+
+static void add_to_sum(int grid_offset, int desirability)
+{
+    data.sum.items[grid_offset] += desirability;
+    if (desirability > 0) {
+        data.positive.items[grid_offset] += desirability;
+    } else {
+        data.negative.items[grid_offset] -= desirability;
+    }
+}
+
+static void add_to_tile(int grid_offset, int desirability)
+{
+    clamp_to_tile(grid_offset, desirability);
+    add_to_sum(grid_offset, desirability);
+}
+
+static void update_clamped_tile(int grid_offset)
+{
+    if (data.positive.items[grid_offset] <= MAX_CLAMPED_SUM && data.negative.items[grid_offset] <= MAX_CLAMPED_SUM) {
+        desirability_grid.items[grid_offset] = (int8_t) data.sum.items[grid_offset];
+    } else {
+        data.needs_reclamp = 1;
+    }
+}
+
+static void add_incremental(int grid_offset, int desirability)
+{
+    add_to_sum(grid_offset, desirability);
+    update_clamped_tile(grid_offset);
+}
+
+static void remove_incremental(int grid_offset, int desirability)
+{
+    data.sum.items[grid_offset] -= desirability;
+    if (desirability > 0) {
+        data.positive.items[grid_offset] -= desirability;
+    } else {
+        data.negative.items[grid_offset] += desirability;
+    }
+    update_clamped_tile(grid_offset);
+}
+
+static void set_source(desirability_source *source, int x, int y, int size, const model_building *model)
+{
+    source->active = 1;
+    source->x = x;
+    source->y = y;
+    source->size = size;
+    source->value = model->desirability_value;
+    source->step = model->desirability_step;
+    source->step_size = model->desirability_step_size;
+    source->range = model->desirability_range;
+}
+
+static int same_source(const desirability_source *a, const desirability_source *b)
+{
+    if (!a->active || !b->active) {
+        return a->active == b->active;
+    }
+    return a->x == b->x && a->y == b->y && a->size == b->size && a->value == b->value &&
+        a->step == b->step && a->step_size == b->step_size && a->range == b->range;
+}
+
+static void get_building_source(int building_id, desirability_source *source)
+{
+    building *b = building_get(building_id);
+    if (b->state == BUILDING_STATE_IN_USE) {
+        set_source(source, b->x, b->y, b->size, model_get_building(b->type));
+    } else {
+        source->active = 0;
+    }
+}
+
+static terrain_source get_terrain_source_type(int grid_offset)
+{
+    int terrain = map_terrain_get(grid_offset);
+    if (map_property_is_plaza_or_earthquake(grid_offset)) {
+        if (terrain & TERRAIN_ROAD) {
+            return SOURCE_PLAZA;
+        } else if (terrain & TERRAIN_ROCK) {
+            // earthquake fault line: slight negative
+            return SOURCE_EARTHQUAKE;
+        } else {
+            // invalid plaza/earthquake flag
+            map_property_clear_plaza_or_earthquake(grid_offset);
+            return SOURCE_NONE;
         }
+    } else if (terrain & TERRAIN_GARDEN) {
+        return SOURCE_GARDEN;
+    } else if (terrain & TERRAIN_RUBBLE) {
+        return SOURCE_RUBBLE;
     }
+    return SOURCE_NONE;
 }
 
-static void update_terrain(void)
+static void get_terrain_source(terrain_source type, int x, int y, desirability_source *source)
 {
+    static const model_building rubble = {0, -2, 1, 1, 2};
+    switch (type) {
+        case SOURCE_PLAZA:
+            set_source(source, x, y, 1, model_get_building(BUILDING_PLAZA));
+            break;
+        case SOURCE_EARTHQUAKE:
+            set_source(source, x, y, 1, model_get_building(BUILDING_HOUSE_VACANT_LOT));
+            break;
+        case SOURCE_GARDEN:
+            set_source(source, x, y, 1, model_get_building(BUILDING_GARDENS));
+            break;
+        case SOURCE_RUBBLE:
+            set_source(source, x, y, 1, &rubble);
+            break;
+        default:
+            source->active = 0;
+            break;
+    }
+}
+
+static void apply_terrain_sources(tile_function apply)
+{
+    int grid_offset = map_data.start_offset;
+    for (int y = 0; y < map_data.height; y++, grid_offset += map_data.border_size) {
+        for (int x = 0; x < map_data.width; x++, grid_offset++) {
+            if (data.terrain.items[grid_offset]) {
+                desirability_source source;
+                get_terrain_source(data.terrain.items[grid_offset], x, y, &source);
+                add_to_terrain(&source, apply);
+            }
+        }
+    }
+}
+
+static void reclamp(void)
+{
+    map_grid_clear_i8(desirability_grid.items);
+    for (int i = 1; i <= data.max_source_id; i++) {
+        add_to_terrain(&data.buildings[i], clamp_to_tile);
+    }
+    apply_terrain_sources(clamp_to_tile);
+}
+
+static void update_full(void)
+{
+    map_grid_clear_i16(data.sum.items);
+    map_grid_clear_u16(data.positive.items);
+    map_grid_clear_u16(data.negative.items);
+    map_grid_clear_i8(desirability_grid.items);
+
+    data.max_source_id = building_get_highest_id();
+    for (int i = 1; i <= data.max_source_id; i++) {
+        get_building_source(i, &data.buildings[i]);
+        add_to_terrain(&data.buildings[i], add_to_tile);
+    }
     int grid_offset = map_data.start_offset;
     for (int y = 0; y < map_data.height; y++, grid_offset += map_data.border_size) {
         for (int x = 0; x < map_data.width; x++, grid_offset++) {
-            int terrain = map_terrain_get(grid_offset);
-            if (map_property_is_plaza_or_earthquake(grid_offset)) {
-                int type;
-                if (terrain & TERRAIN_ROAD) {
-                    type = BUILDING_PLAZA;
-                } else if (terrain & TERRAIN_ROCK) {
-                    // earthquake fault line: slight negative
-                    type = BUILDING_HOUSE_VACANT_LOT;
-                } else {
-                    // invalid plaza/earthquake flag
-                    map_property_clear_plaza_or_earthquake(grid_offset);
-                    continue;
-                }
-                const model_building *model = model_get_building(type);
-                add_to_terrain(x, y, 1,
-                    model->desirability_value,
-                    model->desirability_step,
-                    model->desirability_step_size,
-                    model->desirability_range);
-            } else if (terrain & TERRAIN_GARDEN) {
-                const model_building *model = model_get_building(BUILDING_GARDENS);
-                add_to_terrain(x, y, 1,
-                    model->desirability_value,
-                    model->desirability_step,
-                    model->desirability_step_size,
-                    model->desirability_range);
-            } else if (terrain & TERRAIN_RUBBLE) {
-                add_to_terrain(x, y, 1, -2, 1, 1, 2);
+            data.terrain.items[grid_offset] = get_terrain_source_type(grid_offset);
+        }
+    }
+    apply_terrain_sources(add_to_tile);
+    data.is_valid = 1;
+}
+
+static void update_incremental(void)
+{
+    data.needs_reclamp = 0;
+    int max_id = building_get_highest_id();
+    int last_id = max_id > data.max_source_id ? max_id : data.max_source_id;
+    for (int i = 1; i <= last_id; i++) {
+        desirability_source source;
+        if (i <= max_id) {
+            get_building_source(i, &source);
+        } else {
+            source.active = 0;
+        }
+        if (!same_source(&source, &data.buildings[i])) {
+            add_to_terrain(&data.buildings[i], remove_incremental);
+            add_to_terrain(&source, add_incremental);
+            data.buildings[i] = source;
+        }
+    }
+    data.max_source_id = max_id;
+
+    int grid_offset = map_data.start_offset;
+    for (int y = 0; y < map_data.height; y++, grid_offset += map_data.border_size) {
+        for (int x = 0; x < map_data.width; x++, grid_offset++) {
+            terrain_source type = get_terrain_source_type(grid_offset);
+            if (type != data.terrain.items[grid_offset]) {
+                desirability_source source;
+                get_terrain_source(data.terrain.items[grid_offset], x, y, &source);
+                add_to_terrain(&source, remove_incremental);
+                get_terrain_source(type, x, y, &source);
+                add_to_terrain(&source, add_incremental);
+                data.terrain.items[grid_offset] = type;
             }
         }
     }
+    if (data.needs_reclamp) {
+        // a changed tile reached the clamping bounds: redo the clamping in the original order
+        reclamp();
+    }
+}
+
+#ifdef VERIFY_INCREMENTAL
+static void verify_incremental(void)
+{
+    static grid_i8 incremental;
+    memcpy(incremental.items, desirability_grid.items, sizeof(desirability_grid.items));
+    update_full();
+    int mismatches = 0;
+    for (int i = 0; i < GRID_SIZE * GRID_SIZE; i++) {
+        if (incremental.items[i] != desirability_grid.items[i]) {
+            mismatches++;
+        }
+    }
+    if (mismatches) {
+        log_error("Incremental desirability differs from full update, tiles:", 0, mismatches);
+    }
 }
+#endif
 
 void map_desirability_update(void)
 {
-    map_desirability_clear();
-    update_buildings();
-    update_terrain();
+    if (!data.is_valid) {
+        update_full();
+        return;
+    }
+    update_incremental();
+#ifdef VERIFY_INCREMENTAL
+    verify_incremental();
+#endif
 }
 
 int map_desirability_get(int grid_offset)
@@ -157,4 +378,5 @@ void map_desirability_save_state(buffer *buf)
 void map_desirability_load_state(buffer *buf)
 {
     map_grid_load_state_i8(desirability_grid.items, buf);
+    data.is_valid = 0;
 }
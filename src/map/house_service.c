@@ -0,0 +1,117 @@
+#include "house_service.h"
+
+#include "building/building.h"
+#include "core/log.h"
+#include "map/building.h"
+#include "map/grid.h"
+
+#include <string.h>
+
+#define SERVICE_RADIUS 2
+#define MAX_HOUSES_IN_RANGE ((2 * SERVICE_RADIUS + 1) * (2 * SERVICE_RADIUS + 1))
+
+/**
+ * A list is valid when its generation equals the current one. Changing a building tile
+ * resets the generation of the surrounding lists, creating a house starts a new
+ * generation: its id may still be on tiles of a building that was removed earlier.
+ */
+static struct {
+    uint32_t generation;
+    uint32_t tile_generation[GRID_SIZE * GRID_SIZE];
+    uint8_t num_houses[GRID_SIZE * GRID_SIZE];
+    uint16_t houses[GRID_SIZE * GRID_SIZE][MAX_HOUSES_IN_RANGE];
+} data = {1};
+
+void map_house_service_clear(void)
+{
+    data.generation++;
+    if (!data.generation) {
+        memset(data.tile_generation, 0, sizeof(data.tile_generation));
+        data.generation = 1;
+    }
+}
+
+void map_house_service_invalidate(int grid_offset)
+{
+    int x_min, y_min, x_max, y_max;
+    map_grid_get_area(map_grid_offset_to_x(grid_offset), map_grid_offset_to_y(grid_offset),
+        1, SERVICE_RADIUS, &x_min, &y_min, &x_max, &y_max);
+    for (int yy = y_min; yy <= y_max; yy++) {
+        int offset = map_grid_offset(x_min, yy);
+        for (int xx = x_min; xx <= x_max; xx++, offset++) {
+            data.tile_generation[offset] = 0;
+        }
+    }
+}
+
+static int may_be_house(int building_id)
+{
+    building *b = building_get(building_id);
+    return b->house_size || b->state != BUILDING_STATE_IN_USE;
+}
+
+static void find_houses(int x, int y, int grid_offset)
+{
+    int num_houses = 0;
+    int x_min, y_min, x_max, y_max;
+    map_grid_get_area(x, y, 1, SERVICE_RADIUS, &x_min, &y_min, &x_max, &y_max);
+    for (int yy = y_min; yy <= y_max; yy++) {
+        for (int xx = x_min; xx <= x_max; xx++) {
+            int building_id = map_building_at(map_grid_offset(xx, yy));
+            if (building_id && may_be_house(building_id)) {
+                data.houses[grid_offset][num_houses++] = building_id;
+            }
+        }
+    }
+    data.num_houses[grid_offset] = num_houses;
+    data.tile_generation[grid_offset] = data.generation;
+}
+
+#ifdef VERIFY_INCREMENTAL
+static void verify_houses(int x, int y, int grid_offset)
+{
+    int num_cached = data.num_houses[grid_offset];
+    uint16_t cached[MAX_HOUSES_IN_RANGE];
+    memcpy(cached, data.houses[grid_offset], sizeof(cached));
+    find_houses(x, y, grid_offset);
+    int index = 0;
+    int mismatch = 0;
+    for (int i = 0; i < num_cached; i++) {
+        if (!building_get(cached[i])->house_size) {
+            continue;
+        }
+        while (index < data.num_houses[grid_offset] &&
+            !building_get(data.houses[grid_offset][index])->house_size) {
+            index++;
+        }
+        if (index >= data.num_houses[grid_offset] || data.houses[grid_offset][index] != cached[i]) {
+            mismatch = 1;
+            break;
+        }
+        index++;
+    }
+    while (!mismatch && index < data.num_houses[grid_offset]) {
+        if (building_get(data.houses[grid_offset][index++])->house_size) {
+            mismatch = 1;
+        }
+    }
+    if (mismatch) {
+        log_error("Cached houses in service range differ from map, tile:", 0, grid_offset);
+    }
+}
+#endif
+
+int map_house_service_houses_in_range(int x, int y, const uint16_t **houses)
+{
+    int grid_offset = map_grid_offset(x, y);
+    if (data.tile_generation[grid_offset] != data.generation) {
+        find_houses(x, y, grid_offset);
+    }
+#ifdef VERIFY_INCREMENTAL
+    else {
+        verify_houses(x, y, grid_offset);
+    }
+#endif
+    *houses = data.houses[grid_offset];
+    return data.num_houses[grid_offset];
+}
@@ -0,0 +1,34 @@
+#ifndef MAP_HOUSE_SERVICE_H
+#define MAP_HOUSE_SERVICE_H
+
+#include <stdint.h>
+
+/**
+ * @file
+ * Per-tile lists of the houses that a service walker standing on the tile reaches.
+ */
+
+/**
+ * Invalidates all lists, for example when a map is loaded or a house is created
+ */
+void map_house_service_clear(void);
+
+/**
+ * Invalidates the lists of the tiles within service range of the given tile;
+ * called when the building on the tile changes
+ * @param grid_offset Changed tile
+ */
+void map_house_service_invalidate(int grid_offset);
+
+/**
+ * Returns the houses within service range of the given tile: one entry per house tile,
+ * in the order in which the tiles are visited. Callers still need to check the house
+ * size and population, since houses may have been removed without their tiles changing.
+ * @param x X position of the walker
+ * @param y Y position of the walker
+ * @param houses Set to the list of building ids
+ * @return Number of entries in the list
+ */
+int map_house_service_houses_in_range(int x, int y, const uint16_t **houses);
+
+#endif // MAP_HOUSE_SERVICE_H
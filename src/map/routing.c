@@ -1,6 +1,8 @@
 #include "routing.h"
 
 #include "building/building.h"
+#include "city/view.h"
+#include "core/log.h"
 #include "map/building.h"
 #include "map/figure.h"
 #include "map/grid.h"
@@ -8,6 +10,8 @@
 #include "map/routing_data.h"
 #include "map/terrain.h"
 
+#include <string.h>
+
 #define MAX_QUEUE GRID_SIZE * GRID_SIZE
 #define GUARD 50000
 
@@ -28,6 +32,20 @@ static struct {
 
 static grid_u8 water_drag;
 
+/**
+ * Distances from the start of the road or aqueduct being dragged. Every mouse move routes
+ * from the same start over the map as it was when the drag started, so the distances are
+ * copied from here instead of being calculated again. Whether a road and an aqueduct may
+ * cross depends on the view orientation, so it is part of the key.
+ */
+static struct {
+    int is_valid;
+    routed_building_type type;
+    int source_offset;
+    int orientation;
+    grid_i16 distances;
+} building_distances;
+
 static struct {
     int through_building_id;
 } state;
@@ -315,6 +333,26 @@ static int map_can_place_initial_road_or_aqueduct(int grid_offset, int is_aquedu
     }
 }
 
+#ifdef VERIFY_INCREMENTAL
+static void verify_building_distances(routed_building_type type, int source_offset)
+{
+    if (type == ROUTED_BUILDING_ROAD) {
+        route_queue(source_offset, -1, callback_calc_distance_build_road);
+    } else {
+        route_queue(source_offset, -1, callback_calc_distance_build_aqueduct);
+    }
+    int mismatches = 0;
+    for (int i = 0; i < GRID_SIZE * GRID_SIZE; i++) {
+        if (building_distances.distances.items[i] != routing_distance.items[i]) {
+            mismatches++;
+        }
+    }
+    if (mismatches) {
+        log_error("Cached building distances differ from routing, tiles:", 0, mismatches);
+    }
+}
+#endif
+
 int map_routing_calculate_distances_for_building(routed_building_type type, int x, int y)
 {
     if (type == ROUTED_BUILDING_WALL) {
@@ -331,14 +369,33 @@ int map_routing_calculate_distances_for_building(routed_building_type type, int
         return 0;
     }
     ++stats.total_routes_calculated;
+    if (building_distances.is_valid && building_distances.type == type &&
+        building_distances.source_offset == source_offset &&
+        building_distances.orientation == city_view_orientation()) {
+#ifdef VERIFY_INCREMENTAL
+        verify_building_distances(type, source_offset);
+#endif
+        memcpy(routing_distance.items, building_distances.distances.items, sizeof(routing_distance.items));
+        return 1;
+    }
     if (type == ROUTED_BUILDING_ROAD) {
         route_queue(source_offset, -1, callback_calc_distance_build_road);
     } else {
         route_queue(source_offset, -1, callback_calc_distance_build_aqueduct);
     }
+    memcpy(building_distances.distances.items, routing_distance.items, sizeof(routing_distance.items));
+    building_distances.type = type;
+    building_distances.source_offset = source_offset;
+    building_distances.orientation = city_view_orientation();
+    building_distances.is_valid = 1;
     return 1;
 }
 
+void map_routing_clear_building_distances(void)
+{
+    building_distances.is_valid = 0;
+}
+
 static int callback_delete_wall_aqueduct(int next_offset, int dist)
 {
     if (terrain_land_citizen.items[next_offset] < CITIZEN_0_ROAD) {
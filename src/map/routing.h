@@ -16,6 +16,12 @@ void map_routing_calculate_distances_water_flotsam(int x, int y);
 
 int map_routing_calculate_distances_for_building(routed_building_type type, int x, int y);
 
+/**
+ * Forgets the road and aqueduct distances kept for the current drag, so that the next
+ * building route is calculated again. Called when a drag starts and when land routing changes.
+ */
+void map_routing_clear_building_distances(void);
+
 void map_routing_delete_first_wall_or_aqueduct(int x, int y);
 
 int map_routing_distance(int grid_offset);
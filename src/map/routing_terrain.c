@@ -9,6 +9,7 @@
 #include "map/image.h"
 #include "map/property.h"
 #include "map/random.h"
+#include "map/routing.h"
 #include "map/routing_data.h"
 #include "map/sprite.h"
 #include "map/terrain.h"
@@ -111,6 +112,7 @@ static int get_land_type_citizen_aqueduct(int grid_offset)
 
 void map_routing_update_land_citizen(void)
 {
+    map_routing_clear_building_distances();
     map_grid_init_i8(terrain_land_citizen.items, -1);
     int grid_offset = map_data.start_offset;
     for (int y = 0; y < map_data.height; y++, grid_offset += map_data.border_size) {
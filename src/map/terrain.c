@@ -3,9 +3,11 @@
 #include "map/grid.h"
 #include "map/ring.h"
 #include "map/routing.h"
+#include "map/water_supply.h"
 
 static grid_u16 terrain_grid;
 static grid_u16 terrain_grid_backup;
+static unsigned int changes;
 
 int map_terrain_is(int grid_offset, int terrain)
 {
@@ -17,18 +19,41 @@ int map_terrain_get(int grid_offset)
     return terrain_grid.items[grid_offset];
 }
 
+unsigned int map_terrain_changes(void)
+{
+    return changes;
+}
+
 void map_terrain_set(int grid_offset, int terrain)
 {
+    if ((terrain_grid.items[grid_offset] ^ terrain) & TERRAIN_AQUEDUCT) {
+        map_water_supply_aqueducts_changed();
+    }
+    if (terrain_grid.items[grid_offset] != terrain) {
+        changes++;
+    }
     terrain_grid.items[grid_offset] = terrain;
 }
 
 void map_terrain_add(int grid_offset, int terrain)
 {
+    if (terrain & ~terrain_grid.items[grid_offset] & TERRAIN_AQUEDUCT) {
+        map_water_supply_aqueducts_changed();
+    }
+    if (terrain & ~terrain_grid.items[grid_offset]) {
+        changes++;
+    }
     terrain_grid.items[grid_offset] |= terrain;
 }
 
 void map_terrain_remove(int grid_offset, int terrain)
 {
+    if (terrain & terrain_grid.items[grid_offset] & TERRAIN_AQUEDUCT) {
+        map_water_supply_aqueducts_changed();
+    }
+    if (terrain & terrain_grid.items[grid_offset]) {
+        changes++;
+    }
     terrain_grid.items[grid_offset] &= ~terrain;
 }
 
@@ -58,6 +83,10 @@ void map_terrain_remove_with_radius(int x, int y, int size, int radius, int terr
 
 void map_terrain_remove_all(int terrain)
 {
+    if (terrain & TERRAIN_AQUEDUCT) {
+        map_water_supply_aqueducts_changed();
+    }
+    changes++;
     map_grid_and_u16(terrain_grid.items, ~terrain);
 }
 
@@ -333,11 +362,15 @@ void map_terrain_backup(void)
 void map_terrain_restore(void)
 {
     map_grid_copy_u16(terrain_grid_backup.items, terrain_grid.items);
+    map_water_supply_aqueducts_changed();
+    changes++;
 }
 
 void map_terrain_clear(void)
 {
     map_grid_clear_u16(terrain_grid.items);
+    map_water_supply_aqueducts_changed();
+    changes++;
 }
 
 void map_terrain_init_outside_map(void)
@@ -346,6 +379,7 @@ void map_terrain_init_outside_map(void)
     map_grid_size(&map_width, &map_height);
     int y_start = (GRID_SIZE - map_height) / 2;
     int x_start = (GRID_SIZE - map_width) / 2;
+    changes++;
     for (int y = 0; y < GRID_SIZE; y++) {
         int y_outside_map = y < y_start || y >= y_start + map_height;
         for (int x = 0; x < GRID_SIZE; x++) {
@@ -364,4 +398,6 @@ void map_terrain_save_state(buffer *buf)
 void map_terrain_load_state(buffer *buf)
 {
     map_grid_load_state_u16(terrain_grid.items, buf);
+    map_water_supply_aqueducts_changed();
+    changes++;
 }
@@ -34,6 +34,11 @@ int map_terrain_is(int grid_offset, int terrain);
 
 int map_terrain_get(int grid_offset);
 
+/**
+ * Returns a counter that is increased whenever the terrain of any tile changes
+ */
+unsigned int map_terrain_changes(void);
+
 void map_terrain_set(int grid_offset, int terrain);
 
 void map_terrain_add(int grid_offset, int terrain);
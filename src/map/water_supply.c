@@ -1,8 +1,10 @@
 #include "water_supply.h"
 
 #include "building/building.h"
+#include "building/count.h"
 #include "building/list.h"
 #include "core/image.h"
+#include "core/log.h"
 #include "map/aqueduct.h"
 #include "map/building_tiles.h"
 #include "map/data.h"
@@ -26,6 +28,77 @@ static struct {
     int tail;
 } queue;
 
+static const struct {
+    int connector;
+    int edge;
+} RESERVOIR_CONNECTORS[] = {
+    {-GRID_SIZE + 1, 1},
+    {GRID_SIZE + 3, GRID_SIZE + 2},
+    {3 * GRID_SIZE + 1, 2 * GRID_SIZE + 1},
+    {GRID_SIZE - 1, GRID_SIZE}
+};
+
+/**
+ * Aqueduct tiles are grouped into connected components, which are only searched
+ * again after the terrain reported a change in the aqueduct layout. Water is then
+ * spread per component instead of per tile, and only tiles whose image or water
+ * state differs from the result of the update are written.
+ */
+static struct {
+    int is_valid;
+    int layout_changed;
+    grid_u16 component;
+    int tiles[GRID_SIZE * GRID_SIZE];
+    int num_tiles;
+    struct {
+        int first_tile;
+        int num_tiles;
+        int has_water;
+    } components[GRID_SIZE * GRID_SIZE];
+    int num_components;
+    int reservoirs[MAX_BUILDINGS];
+    int num_reservoirs;
+    struct {
+        int component;
+        int building_id;
+    } links[4 * MAX_BUILDINGS];
+    int num_links;
+} aqueducts;
+
+#define WELL_RADIUS 2
+
+static const building_type WELL_TYPES[] = {BUILDING_WELL};
+static const building_type FOUNTAIN_TYPES[] = {BUILDING_FOUNTAIN};
+static const building_type RESERVOIR_TYPES[] = {BUILDING_RESERVOIR};
+
+typedef struct {
+    int building_id;
+    int x;
+    int y;
+    int radius;
+} water_source;
+
+/**
+ * House water access only changes when the fountain range or the well coverage of a
+ * tile changes, when the building on a tile changes or when a building comes into use.
+ * Fountains and wells are compared with the previous update to find the tiles whose
+ * access changed; the other changes are reported by the code that makes them.
+ * Only the buildings marked that way are checked again.
+ */
+static struct {
+    int is_valid;
+    grid_u8 wells_in_range;
+    water_source wells[MAX_BUILDINGS];
+    int num_wells;
+    water_source fountains[MAX_BUILDINGS];
+    int num_fountains;
+    int fountains_valid;
+    water_source sources[MAX_BUILDINGS];
+    int changed[MAX_BUILDINGS];
+    int num_changed;
+    uint8_t is_changed[MAX_BUILDINGS];
+} houses;
+
 static void mark_well_access(int well_id, int radius)
 {
     building *well = building_get(well_id);
@@ -42,7 +115,7 @@ static void mark_well_access(int well_id, int radius)
     }
 }
 
-void map_water_supply_update_houses(void)
+static void update_houses_full(void)
 {
     building_list_small_clear();
     for (int i = 1; i < MAX_BUILDINGS; i++) {
@@ -64,8 +137,214 @@ void map_water_supply_update_houses(void)
     int total_wells = building_list_small_size();
     const int *wells = building_list_small_items();
     for (int i = 0; i < total_wells; i++) {
-        mark_well_access(wells[i], 2);
+        mark_well_access(wells[i], WELL_RADIUS);
+    }
+}
+
+static void mark_changed(int building_id)
+{
+    if (building_id && !houses.is_changed[building_id]) {
+        houses.is_changed[building_id] = 1;
+        houses.changed[houses.num_changed++] = building_id;
+    }
+}
+
+static void clear_changed(void)
+{
+    for (int i = 0; i < houses.num_changed; i++) {
+        houses.is_changed[houses.changed[i]] = 0;
+    }
+    houses.num_changed = 0;
+}
+
+static void mark_area_changed(const water_source *source)
+{
+    int x_min, y_min, x_max, y_max;
+    map_grid_get_area(source->x, source->y, 1, source->radius, &x_min, &y_min, &x_max, &y_max);
+    for (int yy = y_min; yy <= y_max; yy++) {
+        for (int xx = x_min; xx <= x_max; xx++) {
+            mark_changed(map_building_at(map_grid_offset(xx, yy)));
+        }
+    }
+}
+
+static void change_well_range(const water_source *well, int delta)
+{
+    int x_min, y_min, x_max, y_max;
+    map_grid_get_area(well->x, well->y, 1, well->radius, &x_min, &y_min, &x_max, &y_max);
+    for (int yy = y_min; yy <= y_max; yy++) {
+        for (int xx = x_min; xx <= x_max; xx++) {
+            houses.wells_in_range.items[map_grid_offset(xx, yy)] += delta;
+        }
+    }
+    mark_area_changed(well);
+}
+
+static void change_fountain_range(const water_source *fountain, int delta)
+{
+    // the fountain range itself is set by the reservoir update
+    mark_area_changed(fountain);
+}
+
+/**
+ * Calls the callback with -1 for every source that is only in the old list and with 1 for
+ * every source that is only in the new one; both lists are sorted by building id
+ */
+static void compare_sources(const water_source *old, int num_old, const water_source *current, int num_current,
+    void (*changed)(const water_source *source, int delta))
+{
+    int i = 0;
+    int j = 0;
+    while (i < num_old || j < num_current) {
+        if (j >= num_current || (i < num_old && old[i].building_id < current[j].building_id)) {
+            changed(&old[i++], -1);
+        } else if (i >= num_old || current[j].building_id < old[i].building_id) {
+            changed(&current[j++], 1);
+        } else {
+            if (memcmp(&old[i], &current[j], sizeof(water_source)) != 0) {
+                changed(&old[i], -1);
+                changed(&current[j], 1);
+            }
+            i++;
+            j++;
+        }
+    }
+}
+
+static void update_wells(void)
+{
+    // the list of wells is part of the saved game
+    building_list_small_clear();
+    int num_wells = 0;
+    for (int i = building_next_of_types(0, WELL_TYPES, 1); i; i = building_next_of_types(i, WELL_TYPES, 1)) {
+        building *b = building_get(i);
+        if (b->state != BUILDING_STATE_IN_USE) {
+            continue;
+        }
+        building_list_small_add(i);
+        water_source *well = &houses.sources[num_wells++];
+        well->building_id = i;
+        well->x = b->x;
+        well->y = b->y;
+        well->radius = WELL_RADIUS;
     }
+    compare_sources(houses.wells, houses.num_wells, houses.sources, num_wells, change_well_range);
+    memcpy(houses.wells, houses.sources, num_wells * sizeof(water_source));
+    houses.num_wells = num_wells;
+}
+
+static void update_fountain_ranges(int num_fountains)
+{
+    if (houses.fountains_valid) {
+        compare_sources(houses.fountains, houses.num_fountains, houses.sources, num_fountains,
+            change_fountain_range);
+    } else {
+        // the fountain range before this update is unknown
+        houses.is_valid = 0;
+        houses.fountains_valid = 1;
+    }
+    memcpy(houses.fountains, houses.sources, num_fountains * sizeof(water_source));
+    houses.num_fountains = num_fountains;
+}
+
+static int has_tile_in_well_range(building *b)
+{
+    for (int yy = b->y; yy < b->y + b->size; yy++) {
+        for (int xx = b->x; xx < b->x + b->size; xx++) {
+            if (!map_grid_is_inside(xx, yy, 1)) {
+                continue;
+            }
+            int grid_offset = map_grid_offset(xx, yy);
+            if (houses.wells_in_range.items[grid_offset] && map_building_at(grid_offset) == b->id) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static void update_building_access(int building_id)
+{
+    building *b = building_get(building_id);
+    if (b->state == BUILDING_STATE_IN_USE && b->house_size) {
+        b->has_water_access = map_terrain_exists_tile_in_area_with_type(
+            b->x, b->y, b->size, TERRAIN_FOUNTAIN_RANGE);
+        b->has_well_access = has_tile_in_well_range(b);
+    } else if (has_tile_in_well_range(b)) {
+        // the full update marks any building in range of a well, but only resets houses
+        b->has_well_access = 1;
+    }
+}
+
+static void initialize_houses(void)
+{
+    map_grid_clear_u8(houses.wells_in_range.items);
+    houses.num_wells = 0;
+    update_wells();
+    clear_changed();
+    houses.is_valid = 1;
+}
+
+static void update_houses_incremental(void)
+{
+    update_wells();
+    for (int i = 0; i < houses.num_changed; i++) {
+        update_building_access(houses.changed[i]);
+    }
+    clear_changed();
+}
+
+#ifdef VERIFY_INCREMENTAL
+static void verify_houses(void)
+{
+    static uint8_t access[MAX_BUILDINGS][2];
+    for (int i = 1; i < MAX_BUILDINGS; i++) {
+        building *b = building_get(i);
+        access[i][0] = b->has_water_access;
+        access[i][1] = b->has_well_access;
+    }
+    update_houses_full();
+    int mismatches = 0;
+    for (int i = 1; i < MAX_BUILDINGS; i++) {
+        building *b = building_get(i);
+        if (access[i][0] != b->has_water_access || access[i][1] != b->has_well_access) {
+            mismatches++;
+        }
+    }
+    if (mismatches) {
+        log_error("Incremental house water access differs from full update, buildings:", 0, mismatches);
+    }
+}
+#endif
+
+void map_water_supply_clear(void)
+{
+    houses.is_valid = 0;
+    houses.fountains_valid = 0;
+    aqueducts.is_valid = 0;
+}
+
+void map_water_supply_building_changed(int building_id)
+{
+    mark_changed(building_id);
+}
+
+void map_water_supply_aqueducts_changed(void)
+{
+    aqueducts.layout_changed = 1;
+}
+
+void map_water_supply_update_houses(void)
+{
+    if (!houses.is_valid) {
+        update_houses_full();
+        initialize_houses();
+        return;
+    }
+    update_houses_incremental();
+#ifdef VERIFY_INCREMENTAL
+    verify_houses();
+#endif
 }
 
 static void set_all_aqueducts_to_no_water(void)
@@ -141,16 +420,15 @@ static void fill_aqueducts_from_offset(int grid_offset)
     } while (next_offset > -1);
 }
 
-void map_water_supply_update_reservoir_fountain(void)
+static void mark_reservoirs_next_to_water(void)
 {
-    map_terrain_remove_all(TERRAIN_FOUNTAIN_RANGE | TERRAIN_RESERVOIR_RANGE);
-    // reservoirs
-    set_all_aqueducts_to_no_water();
     building_list_large_clear(1);
-    // mark reservoirs next to water
-    for (int i = 1; i < MAX_BUILDINGS; i++) {
+    aqueducts.num_reservoirs = 0;
+    for (int i = building_next_of_types(0, RESERVOIR_TYPES, 1); i; i = building_next_of_types(i, RESERVOIR_TYPES, 1)) {
         building *b = building_get(i);
-        if (b->state == BUILDING_STATE_IN_USE && b->type == BUILDING_RESERVOIR) {
+        // reservoirs that are not in use can still receive water from an aqueduct
+        aqueducts.reservoirs[aqueducts.num_reservoirs++] = i;
+        if (b->state == BUILDING_STATE_IN_USE) {
             building_list_large_add(i);
             if (map_terrain_exists_tile_in_area_with_type(b->x - 1, b->y - 1, 5, TERRAIN_WATER)) {
                 b->has_water_access = 2;
@@ -159,11 +437,16 @@ void map_water_supply_update_reservoir_fountain(void)
             }
         }
     }
+}
+
+static void update_aqueducts_full(void)
+{
+    set_all_aqueducts_to_no_water();
+    mark_reservoirs_next_to_water();
     int total_reservoirs = building_list_large_size();
     const int *reservoirs = building_list_large_items();
     // fill reservoirs from full ones
     int changed = 1;
-    static const int CONNECTOR_OFFSETS[] = {-161, 165, 487, 161};
     while (changed == 1) {
         changed = 0;
         for (int i = 0; i < total_reservoirs; i++) {
@@ -172,11 +455,214 @@ void map_water_supply_update_reservoir_fountain(void)
                 b->has_water_access = 1;
                 changed = 1;
                 for (int d = 0; d < 4; d++) {
-                    fill_aqueducts_from_offset(b->grid_offset + CONNECTOR_OFFSETS[d]);
+                    fill_aqueducts_from_offset(b->grid_offset + RESERVOIR_CONNECTORS[d].connector);
                 }
             }
         }
     }
+}
+
+static void add_component_tile(int grid_offset)
+{
+    aqueducts.component.items[grid_offset] = aqueducts.num_components;
+    aqueducts.tiles[aqueducts.num_tiles++] = grid_offset;
+}
+
+static void find_component(int start_offset)
+{
+    aqueducts.num_components++;
+    int first_tile = aqueducts.num_tiles;
+    aqueducts.components[aqueducts.num_components].first_tile = first_tile;
+    add_component_tile(start_offset);
+    for (int t = first_tile; t < aqueducts.num_tiles; t++) {
+        int grid_offset = aqueducts.tiles[t];
+        for (int i = 0; i < 4; i++) {
+            int new_offset = grid_offset + ADJACENT_OFFSETS[i];
+            if (!aqueducts.component.items[new_offset] && map_terrain_is(new_offset, TERRAIN_AQUEDUCT)) {
+                add_component_tile(new_offset);
+            }
+        }
+    }
+    aqueducts.components[aqueducts.num_components].num_tiles = aqueducts.num_tiles - first_tile;
+}
+
+static void find_components(void)
+{
+    map_grid_clear_u16(aqueducts.component.items);
+    aqueducts.num_components = 0;
+    aqueducts.num_tiles = 0;
+    int grid_offset = map_data.start_offset;
+    for (int y = 0; y < map_data.height; y++, grid_offset += map_data.border_size) {
+        for (int x = 0; x < map_data.width; x++, grid_offset++) {
+            if (!aqueducts.component.items[grid_offset] && map_terrain_is(grid_offset, TERRAIN_AQUEDUCT)) {
+                find_component(grid_offset);
+            }
+        }
+    }
+    aqueducts.is_valid = 1;
+    aqueducts.layout_changed = 0;
+}
+
+static void find_reservoir_links(void)
+{
+    aqueducts.num_links = 0;
+    for (int i = 0; i < aqueducts.num_reservoirs; i++) {
+        building *reservoir = building_get(aqueducts.reservoirs[i]);
+        if (!map_grid_is_inside(reservoir->x, reservoir->y, 3)) {
+            continue;
+        }
+        for (int d = 0; d < 4; d++) {
+            int connector_offset = reservoir->grid_offset + RESERVOIR_CONNECTORS[d].connector;
+            int component = aqueducts.component.items[connector_offset];
+            if (!component) {
+                continue;
+            }
+            int edge_offset = reservoir->grid_offset + RESERVOIR_CONNECTORS[d].edge;
+            building *b = building_get(map_building_at(edge_offset));
+            int xy = map_property_multi_tile_xy(edge_offset);
+            if (b->id && b->type == BUILDING_RESERVOIR &&
+                xy != EDGE_X0Y0 && xy != EDGE_X2Y0 && xy != EDGE_X0Y2 && xy != EDGE_X2Y2) {
+                aqueducts.links[aqueducts.num_links].component = component;
+                aqueducts.links[aqueducts.num_links].building_id = b->id;
+                aqueducts.num_links++;
+            }
+        }
+    }
+}
+
+static void fill_component_from_offset(int grid_offset)
+{
+    int component = aqueducts.component.items[grid_offset];
+    if (!component || aqueducts.components[component].has_water) {
+        return;
+    }
+    aqueducts.components[component].has_water = 1;
+    for (int i = 0; i < aqueducts.num_links; i++) {
+        if (aqueducts.links[i].component == component) {
+            building *b = building_get(aqueducts.links[i].building_id);
+            if (!b->has_water_access) {
+                b->has_water_access = 2;
+            }
+        }
+    }
+}
+
+static void set_component_images(int component)
+{
+    int image_without_water = image_group(GROUP_BUILDING_AQUEDUCT) + 15;
+    int has_water = aqueducts.components[component].has_water;
+    int first_tile = aqueducts.components[component].first_tile;
+    int last_tile = first_tile + aqueducts.components[component].num_tiles;
+    for (int t = first_tile; t < last_tile; t++) {
+        int grid_offset = aqueducts.tiles[t];
+        // same result as first drying all aqueducts and then filling the connected ones
+        int image_id = map_image_at(grid_offset);
+        int new_image_id = image_id < image_without_water ? image_id + 15 : image_id;
+        if (has_water && new_image_id >= image_without_water) {
+            new_image_id -= 15;
+        }
+        if (new_image_id != image_id) {
+            map_image_set(grid_offset, new_image_id);
+        }
+        if (map_aqueduct_at(grid_offset) != has_water) {
+            map_aqueduct_set(grid_offset, has_water);
+        }
+    }
+}
+
+static void update_aqueducts_incremental(void)
+{
+    if (!aqueducts.is_valid) {
+        update_aqueducts_full();
+        find_components();
+        return;
+    }
+    if (aqueducts.layout_changed) {
+        find_components();
+    }
+    mark_reservoirs_next_to_water();
+    find_reservoir_links();
+    for (int c = 1; c <= aqueducts.num_components; c++) {
+        aqueducts.components[c].has_water = 0;
+    }
+    int total_reservoirs = building_list_large_size();
+    const int *reservoirs = building_list_large_items();
+    int changed = 1;
+    while (changed == 1) {
+        changed = 0;
+        for (int i = 0; i < total_reservoirs; i++) {
+            building *b = building_get(reservoirs[i]);
+            if (b->has_water_access == 2) {
+                b->has_water_access = 1;
+                changed = 1;
+                for (int d = 0; d < 4; d++) {
+                    fill_component_from_offset(b->grid_offset + RESERVOIR_CONNECTORS[d].connector);
+                }
+            }
+        }
+    }
+    for (int c = 1; c <= aqueducts.num_components; c++) {
+        set_component_images(c);
+    }
+}
+
+#ifdef VERIFY_INCREMENTAL
+static void verify_aqueducts(void)
+{
+    static uint16_t images[GRID_SIZE * GRID_SIZE];
+    static uint8_t values[GRID_SIZE * GRID_SIZE];
+    static uint8_t access[MAX_BUILDINGS];
+    for (int i = 0; i < GRID_SIZE * GRID_SIZE; i++) {
+        images[i] = map_image_at(i);
+        values[i] = map_aqueduct_at(i);
+    }
+    for (int i = 1; i < MAX_BUILDINGS; i++) {
+        access[i] = building_get(i)->has_water_access;
+    }
+    update_aqueducts_incremental();
+    for (int i = 0; i < GRID_SIZE * GRID_SIZE; i++) {
+        int image_id = map_image_at(i);
+        int value = map_aqueduct_at(i);
+        map_image_set(i, images[i]);
+        map_aqueduct_set(i, values[i]);
+        images[i] = image_id;
+        values[i] = value;
+    }
+    for (int i = 1; i < MAX_BUILDINGS; i++) {
+        building *b = building_get(i);
+        int value = b->has_water_access;
+        b->has_water_access = access[i];
+        access[i] = value;
+    }
+    update_aqueducts_full();
+    int mismatches = 0;
+    for (int i = 0; i < GRID_SIZE * GRID_SIZE; i++) {
+        if (images[i] != map_image_at(i) || values[i] != map_aqueduct_at(i)) {
+            mismatches++;
+        }
+    }
+    for (int i = 1; i < MAX_BUILDINGS; i++) {
+        if (access[i] != building_get(i)->has_water_access) {
+            mismatches++;
+        }
+    }
+    if (mismatches) {
+        log_error("Incremental aqueduct water differs from full update, tiles and buildings:", 0, mismatches);
+    }
+}
+#endif
+
+void map_water_supply_update_reservoir_fountain(void)
+{
+    map_terrain_remove_all(TERRAIN_FOUNTAIN_RANGE | TERRAIN_RESERVOIR_RANGE);
+    // reservoirs
+#ifdef VERIFY_INCREMENTAL
+    verify_aqueducts();
+#else
+    update_aqueducts_incremental();
+#endif
+    int total_reservoirs = building_list_large_size();
+    const int *reservoirs = building_list_large_items();
     // mark reservoir ranges
     for (int i = 0; i < total_reservoirs; i++) {
         building *b = building_get(reservoirs[i]);
@@ -184,10 +670,14 @@ void map_water_supply_update_reservoir_fountain(void)
             map_terrain_add_with_radius(b->x, b->y, 3, 10, TERRAIN_RESERVOIR_RANGE);
         }
     }
+    for (int i = building_next_of_types(0, RESERVOIR_TYPES, 1); i; i = building_next_of_types(i, RESERVOIR_TYPES, 1)) {
+        building_count_building_changed(i);
+    }
     // fountains
-    for (int i = 1; i < MAX_BUILDINGS; i++) {
+    int num_fountains = 0;
+    for (int i = building_next_of_types(0, FOUNTAIN_TYPES, 1); i; i = building_next_of_types(i, FOUNTAIN_TYPES, 1)) {
         building *b = building_get(i);
-        if (b->state != BUILDING_STATE_IN_USE || b->type != BUILDING_FOUNTAIN) {
+        if (b->state != BUILDING_STATE_IN_USE) {
             continue;
         }
         int des = map_desirability_get(b->grid_offset);
@@ -204,13 +694,18 @@ void map_water_supply_update_reservoir_fountain(void)
         map_building_tiles_add(i, b->x, b->y, 1, image_id, TERRAIN_BUILDING);
         if (map_terrain_is(b->grid_offset, TERRAIN_RESERVOIR_RANGE) && b->num_workers) {
             b->has_water_access = 1;
-            map_terrain_add_with_radius(b->x, b->y, 1,
-                scenario_property_climate() == CLIMATE_DESERT ? 3 : 4,
-                TERRAIN_FOUNTAIN_RANGE);
+            water_source *fountain = &houses.sources[num_fountains++];
+            fountain->building_id = i;
+            fountain->x = b->x;
+            fountain->y = b->y;
+            fountain->radius = scenario_property_climate() == CLIMATE_DESERT ? 3 : 4;
+            map_terrain_add_with_radius(b->x, b->y, 1, fountain->radius, TERRAIN_FOUNTAIN_RANGE);
         } else {
             b->has_water_access = 0;
         }
+        building_count_building_changed(i);
     }
+    update_fountain_ranges(num_fountains);
 }
 
 int map_water_supply_is_well_unnecessary(int well_id, int radius)
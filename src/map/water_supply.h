@@ -1,6 +1,20 @@
 #ifndef MAP_WATER_SUPPLY_H
 #define MAP_WATER_SUPPLY_H
 
+void map_water_supply_clear(void);
+
+/**
+ * Marks a building to have its water access checked in the next house update;
+ * called when the building on a tile changes or when a building comes into use
+ * @param building_id Building, 0 is ignored
+ */
+void map_water_supply_building_changed(int building_id);
+
+/**
+ * Marks the aqueduct network to be searched again; called when the aqueduct terrain changes
+ */
+void map_water_supply_aqueducts_changed(void);
+
 void map_water_supply_update_houses(void);
 void map_water_supply_update_reservoir_fountain(void);
 
@@ -4,6 +4,9 @@
 
 #define CURSOR_SCALE_ERROR_MESSAGE "Option --cursor-scale must be followed by a scale value of 1, 1.5 or 2"
 #define DISPLAY_SCALE_ERROR_MESSAGE "Option --display-scale must be followed by a scale value between 0.5 and 5"
+#define FIGURE_THREADS_ERROR_MESSAGE "Option --figure-threads must be followed by a number of threads between 0 and 8"
+#define RECORD_REPLAY_ERROR_MESSAGE "Option --record-replay must be followed by a file name"
+#define REWIND_DAYS_ERROR_MESSAGE "Option --rewind-days must be followed by a number of days between 0 and 100"
 #define UNKNOWN_OPTION_ERROR_MESSAGE "Option %s not recognized"
 
 static int parse_decimal_as_percentage(const char *str)
@@ -52,6 +55,9 @@ int platform_parse_arguments(int argc, char **argv, julius_args *output_args)
     output_args->data_directory = 0;
     output_args->display_scale_percentage = 100;
     output_args->cursor_scale_percentage = 100;
+    output_args->rewind_days = 0;
+    output_args->record_replay_file = 0;
+    output_args->figure_threads = 0;
 
     for (int i = 1; i < argc; i++) {
         // we ignore "-psn" arguments, this is needed to launch the app
@@ -88,6 +94,44 @@ int platform_parse_arguments(int argc, char **argv, julius_args *output_args)
                 SDL_Log(CURSOR_SCALE_ERROR_MESSAGE);
                 ok = 0;
             }
+        } else if (SDL_strcmp(argv[i], "--rewind-days") == 0) {
+            if (i + 1 < argc) {
+                char *end;
+                long days = SDL_strtol(argv[i + 1], &end, 10);
+                i++;
+                if (*end || days < 0 || days > 100) {
+                    SDL_Log(REWIND_DAYS_ERROR_MESSAGE);
+                    ok = 0;
+                } else {
+                    output_args->rewind_days = (int) days;
+                }
+            } else {
+                SDL_Log(REWIND_DAYS_ERROR_MESSAGE);
+                ok = 0;
+            }
+        } else if (SDL_strcmp(argv[i], "--record-replay") == 0) {
+            if (i + 1 < argc) {
+                output_args->record_replay_file = argv[i + 1];
+                i++;
+            } else {
+                SDL_Log(RECORD_REPLAY_ERROR_MESSAGE);
+                ok = 0;
+            }
+        } else if (SDL_strcmp(argv[i], "--figure-threads") == 0) {
+            if (i + 1 < argc) {
+                char *end;
+                long threads = SDL_strtol(argv[i + 1], &end, 10);
+                i++;
+                if (*end || threads < 0 || threads > 8) {
+                    SDL_Log(FIGURE_THREADS_ERROR_MESSAGE);
+                    ok = 0;
+                } else {
+                    output_args->figure_threads = (int) threads;
+                }
+            } else {
+                SDL_Log(FIGURE_THREADS_ERROR_MESSAGE);
+                ok = 0;
+            }
         } else if (SDL_strcmp(argv[i], "--help") == 0) {
             ok = 0;
         } else if (SDL_strncmp(argv[i], "--", 2) == 0) {
@@ -105,6 +149,13 @@ int platform_parse_arguments(int argc, char **argv, julius_args *output_args)
         SDL_Log("          Scales the display by a factor of NUMBER. Number can be between 0.5 and 5");
         SDL_Log("--cursor-scale NUMBER");
         SDL_Log("          Scales the mouse cursor by a factor of NUMBER. Number can be 1, 1.5 or 2");
+        SDL_Log("--rewind-days NUMBER");
+        SDL_Log("          Keeps the last NUMBER game days in memory, Alt+R rewinds one day. Number can be 0 to 100");
+        SDL_Log("--record-replay FILE");
+        SDL_Log("          Records all commands given in the city to FILE, for playback with the autopilot test tool");
+        SDL_Log("--figure-threads NUMBER");
+        SDL_Log("          Works out the movement of missiles, animals, flotsam and roaming walkers ahead");
+        SDL_Log("          on NUMBER threads before the figures act. Number can be 0 (default, off) to 8");
         SDL_Log("The last argument, if present, is interpreted as data directory for the Caesar 3 installation");
     }
     return ok;
@@ -5,6 +5,9 @@ typedef struct {
     const char *data_directory;
     int display_scale_percentage;
     int cursor_scale_percentage;
+    int rewind_days;
+    const char *record_replay_file;
+    int figure_threads;
 } julius_args;
 
 int platform_parse_arguments(int argc, char **argv, julius_args *output_args);
@@ -5,7 +5,12 @@
 #include "core/file.h"
 #include "core/lang.h"
 #include "core/time.h"
+#include "figure/intent.h"
 #include "game/game.h"
+#include "game/replay.h"
+#include "game/rewind.h"
+#include "game/state.h"
+#include "graphics/window.h"
 #include "input/mouse.h"
 #include "platform/arguments.h"
 #include "platform/cursor.h"
@@ -45,7 +50,6 @@
 #endif
 
 #ifdef DRAW_FPS
-#include "graphics/window.h"
 #include "graphics/graphics.h"
 #include "graphics/text.h"
 #endif
@@ -146,6 +150,53 @@ void system_set_fullscreen(int fullscreen)
     post_event(fullscreen ? USER_EVENT_FULLSCREEN : USER_EVENT_WINDOWED);
 }
 
+void *system_create_thread(int (*function)(void *data), void *data)
+{
+    return SDL_CreateThread(function, "julius worker", data);
+}
+
+void system_wait_thread(void *thread)
+{
+    SDL_WaitThread(thread, NULL);
+}
+
+void *system_create_semaphore(int value)
+{
+    return SDL_CreateSemaphore(value);
+}
+
+void system_wait_semaphore(void *semaphore)
+{
+    SDL_SemWait(semaphore);
+}
+
+void system_post_semaphore(void *semaphore)
+{
+    SDL_SemPost(semaphore);
+}
+
+void system_destroy_semaphore(void *semaphore)
+{
+    if (semaphore) {
+        SDL_DestroySemaphore(semaphore);
+    }
+}
+
+#define TURBO_FRAME_BUDGET_MILLIS 30
+
+static void run_game(void)
+{
+    Uint32 frame_start = SDL_GetTicks();
+    time_set_millis(frame_start);
+    int ticks = game_run();
+    // in turbo mode, keep simulating without drawing until the frame budget is spent
+    while (ticks > 0 && game_state_is_turbo() && !window_is_invalid() &&
+        SDL_GetTicks() - frame_start < TURBO_FRAME_BUDGET_MILLIS) {
+        time_set_millis(SDL_GetTicks());
+        ticks = game_run();
+    }
+}
+
 #ifdef DRAW_FPS
 static struct {
     int frame_count;
@@ -156,9 +207,8 @@ static struct {
 static void run_and_draw(void)
 {
     time_millis time_before_run = SDL_GetTicks();
-    time_set_millis(time_before_run);
 
-    game_run();
+    run_game();
     Uint32 time_between_run_and_draw = SDL_GetTicks();
     game_draw();
     Uint32 time_after_draw = SDL_GetTicks();
@@ -183,9 +233,7 @@ static void run_and_draw(void)
 #else
 static void run_and_draw(void)
 {
-    time_set_millis(SDL_GetTicks());
-
-    game_run();
+    run_game();
     game_draw();
 
     platform_screen_render();
@@ -484,6 +532,9 @@ static void setup(const julius_args *args)
         SDL_Log("Exiting: game init failed");
         exit(2);
     }
+    game_rewind_set_max_days(args->rewind_days);
+    game_replay_set_record_file(args->record_replay_file);
+    figure_intent_set_threads(args->figure_threads);
 }
 
 static void teardown(void)
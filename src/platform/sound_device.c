@@ -20,15 +20,27 @@
 #define USE_SDL_AUDIOSTREAM 
 #endif
 
+enum {
+    CHUNK_NOT_LOADED = 0,
+    CHUNK_LOADING = 1,
+    CHUNK_LOADED = 2
+};
+
 typedef struct {
     const char *filename;
     Mix_Chunk *chunk;
+    int chunk_is_preloaded;
+    Mix_Chunk *preloaded_chunk;
+    SDL_atomic_t preload_state;
 } sound_channel;
 
 static struct {
     int initialized;
     Mix_Music *music;
     sound_channel channels[MAX_CHANNELS];
+    int num_channels;
+    SDL_Thread *preload_thread;
+    SDL_atomic_t stop_preloading;
 } data;
 
 static struct {
@@ -61,12 +73,38 @@ void sound_device_open(void)
     }
 }
 
+static void stop_preloading(void)
+{
+    if (data.preload_thread) {
+        SDL_AtomicSet(&data.stop_preloading, 1);
+        SDL_WaitThread(data.preload_thread, NULL);
+        data.preload_thread = 0;
+    }
+}
+
+/**
+ * Frees the preloaded chunks; the preload thread must be stopped and the channels halted
+ */
+static void free_preloaded_chunks(void)
+{
+    for (int i = 0; i < MAX_CHANNELS; i++) {
+        sound_channel *ch = &data.channels[i];
+        if (SDL_AtomicGet(&ch->preload_state) == CHUNK_LOADED && ch->preloaded_chunk) {
+            Mix_FreeChunk(ch->preloaded_chunk);
+        }
+        ch->preloaded_chunk = 0;
+        SDL_AtomicSet(&ch->preload_state, CHUNK_NOT_LOADED);
+    }
+}
+
 void sound_device_close(void)
 {
     if (data.initialized) {
+        stop_preloading();
         for (int i = 0; i < MAX_CHANNELS; i++) {
             sound_device_stop_channel(i);
         }
+        free_preloaded_chunks();
         Mix_CloseAudio();
         data.initialized = 0;
     }
@@ -87,10 +125,38 @@ static Mix_Chunk *load_chunk(const char *filename)
     }
 }
 
+/**
+ * Loads the chunk of the channel, unless the preload thread got to it first.
+ * The thread that moves the state from "not loaded" to "loading" does the loading.
+ */
+static Mix_Chunk *preload_channel(sound_channel *channel)
+{
+    if (SDL_AtomicCAS(&channel->preload_state, CHUNK_NOT_LOADED, CHUNK_LOADING)) {
+        channel->preloaded_chunk = load_chunk(channel->filename);
+        SDL_AtomicSet(&channel->preload_state, CHUNK_LOADED);
+    }
+    while (SDL_AtomicGet(&channel->preload_state) != CHUNK_LOADED) {
+        // the other thread is loading this file: it will be done soon
+        SDL_Delay(1);
+    }
+    return channel->preloaded_chunk;
+}
+
+static int preload_channels(void *dummy)
+{
+    for (int i = 0; i < data.num_channels && !SDL_AtomicGet(&data.stop_preloading); i++) {
+        if (data.channels[i].filename) {
+            preload_channel(&data.channels[i]);
+        }
+    }
+    return 0;
+}
+
 static int load_channel(sound_channel *channel)
 {
     if (!channel->chunk && channel->filename) {
-        channel->chunk = load_chunk(channel->filename);
+        channel->chunk = preload_channel(channel);
+        channel->chunk_is_preloaded = 1;
     }
     return channel->chunk ? 1 : 0;
 }
@@ -101,12 +167,23 @@ void sound_device_init_channels(int num_channels, char filenames[][CHANNEL_FILEN
         if (num_channels > MAX_CHANNELS) {
             num_channels = MAX_CHANNELS;
         }
+        stop_preloading();
+        for (int i = 0; i < MAX_CHANNELS; i++) {
+            sound_device_stop_channel(i);
+        }
+        free_preloaded_chunks();
         Mix_AllocateChannels(num_channels);
         log_info("Loading audio files", 0, 0);
         for (int i = 0; i < num_channels; i++) {
-            data.channels[i].chunk = 0;
             data.channels[i].filename = filenames[i][0] ? filenames[i] : 0;
         }
+        // decode the sound files in the background, so they are ready when first played
+        data.num_channels = num_channels;
+        SDL_AtomicSet(&data.stop_preloading, 0);
+        data.preload_thread = SDL_CreateThread(preload_channels, "sound preload", NULL);
+        if (!data.preload_thread) {
+            log_info("Unable to preload audio files, loading them when played", 0, 0);
+        }
     }
 }
 
@@ -164,6 +241,7 @@ void sound_device_play_file_on_channel(const char *filename, int channel, int vo
     if (data.initialized) {
         sound_device_stop_channel(channel);
         data.channels[channel].chunk = load_chunk(filename);
+        data.channels[channel].chunk_is_preloaded = 0;
         if (data.channels[channel].chunk) {
             sound_device_set_channel_volume(channel, volume_pct);
             Mix_PlayChannel(channel, data.channels[channel].chunk, 0);
@@ -211,8 +289,12 @@ void sound_device_stop_channel(int channel)
         sound_channel *ch = &data.channels[channel];
         if (ch->chunk) {
             Mix_HaltChannel(channel);
-            Mix_FreeChunk(ch->chunk);
+            // a preloaded chunk is kept for the next time the channel is played
+            if (!ch->chunk_is_preloaded) {
+                Mix_FreeChunk(ch->chunk);
+            }
             ch->chunk = 0;
+            ch->chunk_is_preloaded = 0;
         }
     }
 }
@@ -437,6 +437,14 @@ void scenario_load_state(buffer *buf)
     scenario.is_saved = 1;
 }
 
+void scenario_load_map_info(buffer *buf, int *width, int *height, int *grid_start)
+{
+    buffer_set(buf, 388);
+    *width = buffer_read_i32(buf);
+    *height = buffer_read_i32(buf);
+    *grid_start = buffer_read_i32(buf);
+}
+
 void scenario_settings_init(void)
 {
     scenario.settings.campaign_mission = 0;
@@ -13,6 +13,15 @@ void scenario_save_state(buffer *buf);
 
 void scenario_load_state(buffer *buf);
 
+/**
+ * Reads the map size from scenario data, without changing the current scenario
+ * @param buf Scenario data piece of a saved game
+ * @param width Set to the map width
+ * @param height Set to the map height
+ * @param grid_start Set to the grid offset of the top left map tile
+ */
+void scenario_load_map_info(buffer *buf, int *width, int *height, int *grid_start);
+
 void scenario_settings_save_state(buffer *part1, buffer *part2, buffer *part3, buffer *player_name, buffer *scenario_name);
 
 void scenario_settings_load_state(buffer *part1, buffer *part2, buffer *part3, buffer *player_name, buffer *scenario_name);
@@ -1,8 +1,12 @@
 #include "city.h"
 
 #include "city/figures.h"
+#include "city/view.h"
 #include "core/time.h"
 #include "game/settings.h"
+#include "map/building.h"
+#include "map/property.h"
+#include "map/terrain.h"
 #include "sound/channel.h"
 #include "sound/device.h"
 
@@ -13,6 +17,9 @@
 // for compatibility with the original game:
 #define CITY_CHANNEL_OFFSET 15
 
+#define SIDE_MARGIN_PIXELS 100
+#define FAR_VOLUME_PERCENT 40
+
 enum {
     SOUND_CHANNEL_CITY_HOUSE_SLUM = 30,
     SOUND_CHANNEL_CITY_HOUSE_POOR = 34,
@@ -85,6 +92,7 @@ typedef struct {
     int total_views;
     int views_threshold;
     int direction_views[5];
+    int distance_views; // sum of the distances of the views, not saved
     int channel;
     int times_played;
     time_millis last_played_time;
@@ -114,6 +122,16 @@ static const int BUILDING_TYPE_TO_CHANNEL_ID[] = {
 
 static time_millis last_update_time;
 
+static struct {
+    int left_x_max;
+    int right_x_min;
+    int center_x;
+    int center_y;
+    int half_width;
+    int half_height;
+    int entertainment_shut_off;
+} view;
+
 void sound_city_init(void)
 {
     last_update_time = time_get_millis();
@@ -198,67 +216,111 @@ void sound_city_set_volume(int percentage)
     }
 }
 
-void sound_city_mark_building_view(building *b, int direction)
+static void clear_views(city_channel *ch)
 {
-    if (b->state == BUILDING_STATE_UNUSED) {
-        return;
-    }
-    int type = b->type;
-    int channel = BUILDING_TYPE_TO_CHANNEL_ID[type];
-    if (!channel) {
-        return;
+    for (int d = 0; d < 5; d++) {
+        ch->direction_views[d] = 0;
     }
-    if (type == BUILDING_THEATER || type == BUILDING_AMPHITHEATER ||
-        type == BUILDING_GLADIATOR_SCHOOL || type == BUILDING_HIPPODROME) {
-        // entertainment is shut off when caesar invades
-        if (b->num_workers <= 0 || city_figures_imperial_soldiers() > 0) {
-            return;
-        }
+    ch->distance_views = 0;
+}
+
+static void mark_view(int channel, int x, int y)
+{
+    int direction;
+    if (x < view.left_x_max) {
+        direction = SOUND_DIRECTION_LEFT;
+    } else if (x > view.right_x_min) {
+        direction = SOUND_DIRECTION_RIGHT;
+    } else {
+        direction = SOUND_DIRECTION_CENTER;
     }
+    int dx = (x > view.center_x ? x - view.center_x : view.center_x - x) * 100 / view.half_width;
+    int dy = (y > view.center_y ? y - view.center_y : view.center_y - y) * 100 / view.half_height;
+    int distance = dx > dy ? dx : dy;
 
     channels[channel].available = 1;
     ++channels[channel].total_views;
     ++channels[channel].direction_views[direction];
+    channels[channel].distance_views += distance > 100 ? 100 : distance;
+}
+
+static void mark_tile_view(int x, int y, int grid_offset)
+{
+    if (!map_property_is_draw_tile(grid_offset)) {
+        return;
+    }
+    int building_id = map_building_at(grid_offset);
+    if (building_id) {
+        const building *b = building_get(building_id);
+        int channel = BUILDING_TYPE_TO_CHANNEL_ID[b->type];
+        if (channel && b->state != BUILDING_STATE_UNUSED) {
+            int is_entertainment = b->type == BUILDING_THEATER || b->type == BUILDING_AMPHITHEATER ||
+                b->type == BUILDING_GLADIATOR_SCHOOL || b->type == BUILDING_HIPPODROME;
+            if (!is_entertainment || (b->num_workers > 0 && !view.entertainment_shut_off)) {
+                mark_view(channel, x, y);
+            }
+        }
+    }
+    if (map_terrain_is(grid_offset, TERRAIN_GARDEN)) {
+        mark_view(BUILDING_TYPE_TO_CHANNEL_ID[BUILDING_GARDENS], x, y);
+    }
+}
+
+void sound_city_mark_views(void)
+{
+    int x, y, width, height;
+    city_view_get_viewport(&x, &y, &width, &height);
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    view.left_x_max = x + SIDE_MARGIN_PIXELS;
+    view.right_x_min = x + width - SIDE_MARGIN_PIXELS;
+    view.half_width = width / 2 > 0 ? width / 2 : 1;
+    view.half_height = height / 2 > 0 ? height / 2 : 1;
+    view.center_x = x + view.half_width;
+    view.center_y = y + view.half_height;
+    // entertainment is shut off when caesar invades
+    view.entertainment_shut_off = city_figures_imperial_soldiers() > 0;
+    city_view_foreach_valid_map_tile(mark_tile_view, 0, 0);
 }
 
 void sound_city_decay_views(void)
 {
     for (int i = 0; i < MAX_CHANNELS; i++) {
-        for (int d = 0; d < 5; d++) {
-            channels[i].direction_views[d] = 0;
-        }
+        clear_views(&channels[i]);
         channels[i].total_views /= 2;
     }
 }
 
-static void play_channel(int channel, int direction)
+/**
+ * Pans the sound towards the side of the screen where its buildings were seen:
+ * buildings in the center count for both sides. The further the buildings are
+ * from the center of the screen on average, the softer the sound.
+ */
+static void play_channel(const city_channel *ch)
 {
-    channel += CITY_CHANNEL_OFFSET;
+    const int *direction_views = ch->direction_views;
+    int channel = ch->channel + CITY_CHANNEL_OFFSET;
     if (!setting_sound(SOUND_CITY)->enabled) {
         return;
     }
     if (sound_device_is_channel_playing(channel)) {
         return;
     }
-    int left_pan;
-    int right_pan;
-    switch (direction) {
-        case SOUND_DIRECTION_CENTER:
-            left_pan = right_pan = 100;
-            break;
-        case SOUND_DIRECTION_LEFT:
-            left_pan = 100;
-            right_pan = 0;
-            break;
-        case SOUND_DIRECTION_RIGHT:
-            left_pan = 0;
-            right_pan = 100;
-            break;
-        default:
-            left_pan = right_pan = 0;
-            break;
+    int left_views = direction_views[SOUND_DIRECTION_LEFT] + direction_views[SOUND_DIRECTION_CENTER];
+    int right_views = direction_views[SOUND_DIRECTION_RIGHT] + direction_views[SOUND_DIRECTION_CENTER];
+    int left_pan = 100;
+    int right_pan = 100;
+    if (left_views > right_views) {
+        right_pan = 100 * right_views / left_views;
+    } else if (right_views > left_views) {
+        left_pan = 100 * left_views / right_views;
     }
-    sound_device_play_channel_panned(channel, setting_sound(SOUND_CITY)->volume, left_pan, right_pan);
+    int views = direction_views[SOUND_DIRECTION_LEFT] + direction_views[SOUND_DIRECTION_CENTER] +
+        direction_views[SOUND_DIRECTION_RIGHT];
+    int distance = views ? ch->distance_views / views : 0;
+    int volume = setting_sound(SOUND_CITY)->volume * (100 - distance * (100 - FAR_VOLUME_PERCENT) / 100) / 100;
+    sound_device_play_channel_panned(channel, volume, left_pan, right_pan);
 }
 
 void sound_city_play(void)
@@ -275,9 +337,7 @@ void sound_city_play(void)
             }
         } else {
             channels[i].total_views = 0;
-            for (int d = 0; d < 5; d++) {
-                channels[i].direction_views[d] = 0;
-            }
+            clear_views(&channels[i]);
         }
     }
 
@@ -300,25 +360,11 @@ void sound_city_play(void)
     }
     
     // always only one channel available... use it
-    int channel = channels[max_sound_id].channel;
-    int direction;
-    if (channels[max_sound_id].direction_views[SOUND_DIRECTION_CENTER] > 10) {
-        direction = SOUND_DIRECTION_CENTER;
-    } else if (channels[max_sound_id].direction_views[SOUND_DIRECTION_LEFT] > 10) {
-        direction = SOUND_DIRECTION_LEFT;
-    } else if (channels[max_sound_id].direction_views[SOUND_DIRECTION_RIGHT] > 10) {
-        direction = SOUND_DIRECTION_RIGHT;
-    } else {
-        direction = SOUND_DIRECTION_CENTER;
-    }
-
-    play_channel(channel, direction);
+    play_channel(&channels[max_sound_id]);
     last_update_time = now;
     channels[max_sound_id].last_played_time = now;
     channels[max_sound_id].total_views = 0;
-    for (int d = 0; d < 5; d++) {
-        channels[max_sound_id].direction_views[d] = 0;
-    }
+    clear_views(&channels[max_sound_id]);
     channels[max_sound_id].times_played++;
 }
 
@@ -359,6 +405,7 @@ void sound_city_load_state(buffer *buf)
         for (int d = 0; d < 5; d++) {
             ch->direction_views[d] = buffer_read_i32(buf);
         }
+        ch->distance_views = 0;
         buffer_skip(buf, 4); // current channel
         buffer_skip(buf, 4); // num channels
         ch->channel = buffer_read_i32(buf);
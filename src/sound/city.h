@@ -14,7 +14,10 @@ void sound_city_init(void);
 
 void sound_city_set_volume(int percentage);
 
-void sound_city_mark_building_view(building *b, int direction);
+/**
+ * Gathers the buildings and gardens on screen that make a sound, once per drawn frame
+ */
+void sound_city_mark_views(void);
 
 void sound_city_decay_views(void);
 
@@ -43,6 +43,7 @@ void widget_city_draw(void)
     if (game_state_overlay()) {
         city_with_overlay_draw(&data.current_tile);
     } else {
+        sound_city_mark_views();
         city_without_overlay_draw(0, 0, &data.current_tile);
     }
 
@@ -53,6 +54,7 @@ void widget_city_draw_for_figure(int figure_id, pixel_coordinate *coord)
 {
     set_city_clip_rectangle();
 
+    sound_city_mark_views();
     city_without_overlay_draw(figure_id, coord, &data.current_tile);
 
     graphics_reset_clip_rectangle();
@@ -84,7 +84,8 @@ static void draw_scenario_list(void)
         } else if (!data.focus_button_id && data.selected_item == i + data.scroll_position) {
             font = FONT_NORMAL_WHITE;
         }
-        strcpy(file, data.scenarios->files[i + data.scroll_position]);
+        strncpy(file, data.scenarios->files[i + data.scroll_position], FILE_NAME_MAX - 1);
+        file[FILE_NAME_MAX - 1] = 0;
         encoding_from_utf8(file, displayable_file, FILE_NAME_MAX);
         file_remove_extension(displayable_file);
         text_ellipsize(displayable_file, font, 240);
@@ -263,7 +264,8 @@ static void button_select_item(int index, int param2)
         return;
     }
     data.selected_item = data.scroll_position + index;
-    strcpy(data.selected_scenario_filename, data.scenarios->files[data.selected_item]);
+    strncpy(data.selected_scenario_filename, data.scenarios->files[data.selected_item], FILE_NAME_MAX - 1);
+    data.selected_scenario_filename[FILE_NAME_MAX - 1] = 0;
     game_file_load_scenario_data(data.selected_scenario_filename);
     encoding_from_utf8(data.selected_scenario_filename, data.selected_scenario_display, FILE_NAME_MAX);
     file_remove_extension(data.selected_scenario_display);
@@ -10,6 +10,7 @@
 #include "core/time.h"
 #include "game/file.h"
 #include "game/file_editor.h"
+#include "game/file_io.h"
 #include "graphics/generic_button.h"
 #include "graphics/graphics.h"
 #include "graphics/image.h"
@@ -19,6 +20,7 @@
 #include "graphics/text.h"
 #include "graphics/window.h"
 #include "input/keyboard.h"
+#include "map/terrain.h"
 #include "window/city.h"
 #include "window/editor/map.h"
 
@@ -49,6 +51,8 @@ static generic_button file_buttons[] = {
     {160, 304, 288, 16, button_select_file, button_none, 11, 0},
 };
 
+#define MAX_SAVED_GAME_INFO 8
+
 static const time_millis NOT_EXIST_MESSAGE_TIMEOUT = 500;
 static const int MAX_FILE_WINDOW_TEXT_WIDTH = 18 * 16;
 
@@ -70,6 +74,24 @@ static struct {
     char selected_file[FILE_NAME_MAX];
 } data;
 
+/**
+ * Overviews of the saved games that were pointed at since the dialog was opened,
+ * so that moving the mouse over the list does not read the same file every frame
+ */
+typedef struct {
+    char filename[FILE_NAME_MAX];
+    int is_valid;
+    saved_game_info info;
+} saved_game_info_entry;
+
+static struct {
+    saved_game_info_entry entries[MAX_SAVED_GAME_INFO];
+    int num_entries;
+    int next_entry;
+    const saved_game_info_entry *thumbnail_entry;
+    color_t thumbnail[SAVED_GAME_THUMBNAIL_SIZE * SAVED_GAME_THUMBNAIL_SIZE];
+} info_cache;
+
 file_type_data saved_game_data = {"sav"};
 file_type_data scenario_data = {"map"};
 
@@ -90,6 +112,9 @@ static void init(file_type type, file_dialog_type dialog_type)
     data.scroll_position = 0;
 
     data.file_list = dir_find_files_with_extension(data.file_data->extension);
+    info_cache.num_entries = 0;
+    info_cache.next_entry = 0;
+    info_cache.thumbnail_entry = 0;
 
     strncpy(data.selected_file, data.file_data->last_loaded_file, FILE_NAME_MAX);
     keyboard_start_capture(data.typed_name, FILE_NAME_MAX, 0, MAX_FILE_WINDOW_TEXT_WIDTH, FONT_NORMAL_WHITE);
@@ -111,12 +136,107 @@ static void draw_scrollbar_dot(void)
     }
 }
 
+static const saved_game_info_entry *get_saved_game_info(const char *filename)
+{
+    for (int i = 0; i < info_cache.num_entries; i++) {
+        if (strcmp(info_cache.entries[i].filename, filename) == 0) {
+            return &info_cache.entries[i];
+        }
+    }
+    saved_game_info_entry *entry = &info_cache.entries[info_cache.next_entry];
+    info_cache.next_entry = (info_cache.next_entry + 1) % MAX_SAVED_GAME_INFO;
+    if (info_cache.num_entries < MAX_SAVED_GAME_INFO) {
+        info_cache.num_entries++;
+    }
+    if (info_cache.thumbnail_entry == entry) {
+        info_cache.thumbnail_entry = 0;
+    }
+    strncpy(entry->filename, filename, FILE_NAME_MAX - 1);
+    entry->filename[FILE_NAME_MAX - 1] = 0;
+    entry->is_valid = file_exists(filename) && game_file_io_read_saved_game_info(filename, &entry->info);
+    return entry;
+}
+
+static color_t thumbnail_color(uint16_t terrain)
+{
+    if (terrain & TERRAIN_WATER) {
+        return 0x3a5e8c;
+    } else if (terrain & TERRAIN_WALL_OR_GATEHOUSE) {
+        return 0xb5ad9c;
+    } else if (terrain & (TERRAIN_BUILDING | TERRAIN_AQUEDUCT)) {
+        return 0xc66b4a;
+    } else if (terrain & TERRAIN_ROAD) {
+        return 0x9c8c6b;
+    } else if (terrain & (TERRAIN_TREE | TERRAIN_SHRUB)) {
+        return 0x395a29;
+    } else if (terrain & TERRAIN_ROCK) {
+        return 0x7b7363;
+    } else if (terrain & TERRAIN_MEADOW) {
+        return 0x9ca552;
+    } else {
+        return 0x6b8c42;
+    }
+}
+
+static void draw_thumbnail(const saved_game_info_entry *entry, int x, int y)
+{
+    const saved_game_info *info = &entry->info;
+    if (info_cache.thumbnail_entry != entry) {
+        int num_pixels = info->thumbnail_width * info->thumbnail_height;
+        for (int i = 0; i < num_pixels; i++) {
+            info_cache.thumbnail[i] = thumbnail_color(info->thumbnail_terrain[i]);
+        }
+        info_cache.thumbnail_entry = entry;
+    }
+    graphics_draw_from_buffer(x + (SAVED_GAME_THUMBNAIL_SIZE - info->thumbnail_width) / 2,
+        y + (SAVED_GAME_THUMBNAIL_SIZE - info->thumbnail_height) / 2,
+        info->thumbnail_width, info->thumbnail_height, info_cache.thumbnail);
+}
+
+static void draw_saved_game_info(void)
+{
+    inner_panel_draw(144, 368, 20, 6);
+
+    const char *filename = data.selected_file;
+    int focus_index = data.focus_button_id - 1;
+    if (focus_index >= 0 && data.scroll_position + focus_index < data.file_list->num_files) {
+        filename = data.file_list->files[data.scroll_position + focus_index];
+    }
+    const saved_game_info_entry *entry = get_saved_game_info(filename);
+    if (!entry->is_valid) {
+        return;
+    }
+    const saved_game_info *info = &entry->info;
+    draw_thumbnail(entry, 152, 380);
+
+    uint8_t name[SAVED_GAME_NAME_LENGTH];
+    string_copy(info->scenario_name, name, SAVED_GAME_NAME_LENGTH);
+    text_ellipsize(name, FONT_NORMAL_WHITE, 224);
+    text_draw(name, 232, 380, FONT_NORMAL_WHITE, 0);
+
+    int width = lang_text_draw(25, info->month, 232, 396, FONT_NORMAL_GREEN);
+    lang_text_draw_year(info->year, 232 + width, 396, FONT_NORMAL_GREEN);
+
+    width = lang_text_draw(6, 0, 232, 412, FONT_NORMAL_GREEN);
+    text_draw_number(info->treasury, '@', " ", 232 + width, 412, FONT_NORMAL_GREEN);
+    width = lang_text_draw(6, 1, 344, 412, FONT_NORMAL_GREEN);
+    text_draw_number(info->population, '@', " ", 344 + width, 412, FONT_NORMAL_GREEN);
+
+    for (int i = 0; i < 4; i++) {
+        int x = i % 2 ? 344 : 232;
+        int y = i < 2 ? 428 : 444;
+        width = lang_text_draw(53, i + 1, x, y, FONT_NORMAL_GREEN);
+        text_draw_number(info->ratings[i], '@', " ", x + width, y, FONT_NORMAL_GREEN);
+    }
+}
+
 static void draw_foreground(void)
 {
     graphics_in_dialog();
     uint8_t file[FILE_NAME_MAX];
 
-    outer_panel_draw(128, 40, 24, 21);
+    int show_info = data.type == FILE_TYPE_SAVED_GAME;
+    outer_panel_draw(128, 40, 24, show_info ? 27 : 21);
     inner_panel_draw(144, 80, 20, 2);
     inner_panel_draw(144, 120, 20, 13);
 
@@ -147,6 +267,9 @@ static void draw_foreground(void)
     text_draw(data.typed_name, 160, 90, FONT_NORMAL_WHITE, 0);
     text_draw_cursor(160, 91, keyboard_is_insert());
     draw_scrollbar_dot();
+    if (show_info) {
+        draw_saved_game_info();
+    }
 
     graphics_reset_dialog();
 }
@@ -1,11 +1,15 @@
 #include "sav_compare.h"
 
 #include <stdio.h>
+#include <string.h>
 
 int main(int argc, char **argv)
 {
+    if (argc == 4 && strcmp(argv[1], "--json") == 0) {
+        return compare_files_json(argv[2], argv[3]);
+    }
     if (argc != 3) {
-        printf("Usage: %s FILE1 FILE2\n", argv[0]);
+        printf("Usage: %s [--json] FILE1 FILE2\n", argv[0]);
         return 1;
     }
     return compare_files(argv[1], argv[2]);
@@ -1,8 +1,16 @@
+#include "building/construction.h"
 #include "core/backtrace.h"
 #include "core/time.h"
+#include "figure/intent.h"
 #include "game/file.h"
 #include "game/game.h"
+#include "game/orientation.h"
+#include "game/replay.h"
+#include "game/rewind.h"
 #include "game/settings.h"
+#include "game/state.h"
+#include "game/undo.h"
+#include "map/grid.h"
 
 #ifdef _MSC_VER
 #include <direct.h>
@@ -15,6 +23,7 @@
 #include <signal.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "sav_compare.h"
 
 static void handler(int sig)
@@ -34,7 +43,8 @@ static void run_ticks(int ticks)
     }
 }
 
-static int run_autopilot(const char *input_saved_game, const char *output_saved_game, int ticks_to_run)
+static int run_autopilot(const char *input_saved_game, const char *output_saved_game, int ticks_to_run,
+    const char *replay_file)
 {
     printf("Running autopilot: %s --> %s in %d ticks\n", input_saved_game, output_saved_game, ticks_to_run);
     signal(SIGSEGV, handler);
@@ -58,7 +68,18 @@ static int run_autopilot(const char *input_saved_game, const char *output_saved_
         }
         return 3;
     }
+    if (replay_file) {
+        if (!game_replay_start_playback(replay_file)) {
+            printf("Unable to load replay from %s\n", replay_file);
+            return 4;
+        }
+        if (!ticks_to_run) {
+            ticks_to_run = game_replay_end_tick();
+        }
+        printf("Playing replay %s for %d ticks\n", replay_file, ticks_to_run);
+    }
     run_ticks(ticks_to_run);
+    game_replay_finish_playback();
     printf("Saving game to %s\n", output_saved_game);
     game_file_write_saved_game(output_saved_game);
     printf("Done\n");
@@ -68,9 +89,134 @@ static int run_autopilot(const char *input_saved_game, const char *output_saved_
     return 0;
 }
 
+typedef enum {
+    ACTION_BUILD,
+    ACTION_UNDO,
+    ACTION_ROTATE,
+    ACTION_OVERLAY,
+    ACTION_SPEED_UP,
+    ACTION_SPEED_DOWN,
+    ACTION_REWIND
+} player_action_type;
+
+typedef struct {
+    int tick;
+    player_action_type type;
+    int params[5];
+} player_action;
+
+/**
+ * What a player does while the replay is recorded, done through the same functions the
+ * user interface calls. A game day takes 50 ticks, so the rewind goes back into the actions
+ * before it. The speed goes back to normal right away: animations follow the clock, and the
+ * clock has to run the same as during playback for the saved games to be the same.
+ */
+static const player_action PLAYER_ACTIONS[] = {
+    {97, ACTION_BUILD, {BUILDING_ROAD, 23, 27, 27, 29}},
+    {194, ACTION_BUILD, {BUILDING_HOUSE_VACANT_LOT, 26, 34, 30, 36}},
+    {250, ACTION_SPEED_DOWN},
+    {250, ACTION_SPEED_UP},
+    {300, ACTION_OVERLAY, {OVERLAY_WATER}},
+    {400, ACTION_ROTATE},
+    {450, ACTION_BUILD, {BUILDING_ROAD, 29, 41, 33, 43}},
+    {460, ACTION_UNDO},
+    {520, ACTION_BUILD, {BUILDING_HOUSE_VACANT_LOT, 32, 48, 36, 50}},
+    {600, ACTION_OVERLAY, {OVERLAY_NONE}},
+    {650, ACTION_REWIND, {2}},
+    {700, ACTION_BUILD, {BUILDING_ROAD, 35, 55, 39, 57}},
+    {800, ACTION_BUILD, {BUILDING_HOUSE_VACANT_LOT, 38, 62, 42, 64}}
+};
+
+#define NUM_PLAYER_ACTIONS (sizeof(PLAYER_ACTIONS) / sizeof(player_action))
+
+static void perform_action(const player_action *action)
+{
+    const int *p = action->params;
+    switch (action->type) {
+        case ACTION_BUILD:
+            building_construction_set_type(p[0]);
+            building_construction_start(p[1], p[2], map_grid_offset(p[1], p[2]));
+            building_construction_update(p[3], p[4], map_grid_offset(p[3], p[4]));
+            building_construction_place();
+            building_construction_clear_type();
+            break;
+        case ACTION_UNDO:
+            game_undo_perform();
+            break;
+        case ACTION_ROTATE:
+            game_orientation_rotate_left();
+            break;
+        case ACTION_OVERLAY:
+            game_state_set_overlay(p[0]);
+            break;
+        case ACTION_SPEED_UP:
+            setting_increase_game_speed();
+            break;
+        case ACTION_SPEED_DOWN:
+            setting_decrease_game_speed();
+            break;
+        case ACTION_REWIND:
+            game_rewind_go_back(p[0]);
+            break;
+    }
+}
+
+static void run_player_actions(int ticks)
+{
+    setting_reset_speeds(100, setting_scroll_speed());
+    time_millis now = 0;
+    time_set_millis(now);
+    unsigned int next_action = 0;
+    while (game_replay_ticks() < ticks) {
+        while (next_action < NUM_PLAYER_ACTIONS && PLAYER_ACTIONS[next_action].tick <= game_replay_ticks()) {
+            perform_action(&PLAYER_ACTIONS[next_action++]);
+        }
+        now += 2;
+        time_set_millis(now);
+        game_run();
+    }
+}
+
+/**
+ * Records a replay of the player actions on top of a saved game. The replay is written to
+ * replay_file, the saved games at its start and end to replay_file.sav and replay_file-end.sav.
+ */
+static int record_replay(const char *input_saved_game, const char *replay_file, int ticks)
+{
+    printf("Recording replay %s on %s for %d ticks\n", replay_file, input_saved_game, ticks);
+    signal(SIGSEGV, handler);
+    if (!game_pre_init() || !game_init()) {
+        printf("Unable to initialize the game\n");
+        return 1;
+    }
+    game_rewind_set_max_days(10);
+    game_replay_set_record_file(replay_file);
+    if (!game_file_load_saved_game(input_saved_game) || !game_replay_start_file()) {
+        printf("Unable to load saved game %s\n", input_saved_game);
+        return 3;
+    }
+    run_player_actions(ticks);
+    game_replay_set_record_file(0);
+    game_exit();
+    return 0;
+}
+
 int main(int argc, char **argv)
 {
-    if (argc != 5) {
+    if (argc == 5 && strcmp(argv[1], "--record") == 0) {
+        return record_replay(argv[3], argv[2], atoi(argv[4]));
+    }
+    if (argc > 2 && strcmp(argv[1], "--figure-threads") == 0) {
+        figure_intent_set_threads(atoi(argv[2]));
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc > 2 && strcmp(argv[1], "--min-figures-per-thread") == 0) {
+        figure_intent_set_min_figures_per_thread(atoi(argv[2]));
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc != 5 && argc != 6) {
         printf("Incorrect number of arguments (%d)\n", argc);
         return -1;
     }
@@ -78,7 +224,8 @@ int main(int argc, char **argv)
     const char *output = argv[2];
     const char *expected = argv[3];
     int ticks = atoi(argv[4]);
-    if (run_autopilot(input, output, ticks) == 0) {
+    const char *replay = argc == 6 ? argv[5] : 0;
+    if (run_autopilot(input, output, ticks, replay) == 0) {
         return compare_files(expected, output);
     } else {
         return 1;
@@ -6,31 +6,256 @@
 #define SAVEGAME_PARTS 300
 #define COMPRESS_BUFFER_SIZE 600000
 #define UNCOMPRESSED 0x80000000
+#define GRID_SIZE 162
+#define BUILDING_TYPE_HOUSE_MIN 10
+#define BUILDING_TYPE_HOUSE_MAX 29
 
 struct game_file_part {
     int compressed;
     int length_in_bytes;
     char name[100];
     int record_length;
+    int is_grid;
+};
+
+struct record_field {
+    int offset;
+    int size;
+    const char *name;
+};
+
+enum {
+    DIFF_OFFSET,
+    DIFF_TILE,
+    DIFF_RECORD
+};
+
+struct difference {
+    int part;
+    int kind;
+    int record;
+    int record_type;
+    int part_offset;
+    int offset;
+    const char *field;
+    unsigned int value1;
+    unsigned int value2;
+};
+
+static const struct record_field building_fields[] = {
+    {0, 1, "state"},
+    {1, 1, "faction_id"},
+    {2, 1, "unknown_value"},
+    {3, 1, "size"},
+    {4, 1, "house_is_merged"},
+    {5, 1, "house_size"},
+    {6, 1, "x"},
+    {7, 1, "y"},
+    {8, 2, "grid_offset"},
+    {10, 2, "type"},
+    {12, 2, "subtype"},
+    {14, 1, "road_network_id"},
+    {16, 2, "created_sequence"},
+    {18, 2, "houses_covered"},
+    {20, 2, "percentage_houses_covered"},
+    {22, 2, "house_population"},
+    {24, 2, "house_population_room"},
+    {26, 2, "distance_from_entry"},
+    {28, 2, "house_highest_population"},
+    {30, 2, "house_unreachable_ticks"},
+    {32, 1, "road_access_x"},
+    {33, 1, "road_access_y"},
+    {34, 2, "figure_id"},
+    {36, 2, "figure_id2"},
+    {38, 2, "immigrant_figure_id"},
+    {40, 2, "figure_id4"},
+    {42, 1, "figure_spawn_delay"},
+    {44, 1, "figure_roam_direction"},
+    {45, 1, "has_water_access"},
+    {48, 2, "prev_part_building_id"},
+    {50, 2, "next_part_building_id"},
+    {52, 2, "loads_stored"},
+    {55, 1, "has_well_access"},
+    {56, 2, "num_workers"},
+    {58, 1, "labor_category"},
+    {59, 1, "output_resource_id"},
+    {60, 1, "has_road_access"},
+    {61, 1, "house_criminal_active"},
+    {62, 2, "damage_risk"},
+    {64, 2, "fire_risk"},
+    {66, 2, "fire_duration"},
+    {68, 1, "fire_proof"},
+    {69, 1, "house_figure_generation_delay"},
+    {70, 1, "house_tax_coverage"},
+    {72, 2, "formation_id"},
+    {74, 42, "data"},
+    {116, 4, "tax_income_or_storage"},
+    {120, 1, "house_days_without_food"},
+    {121, 1, "ruin_has_plague"},
+    {122, 1, "desirability"},
+    {123, 1, "is_deleted"},
+    {124, 1, "is_adjacent_to_water"},
+    {125, 1, "storage_id"},
+    {126, 1, "sentiment"},
+    {127, 1, "show_on_problem_overlay"},
+    {0, 0, 0}
+};
+
+static const struct record_field house_fields[] = {
+    {74, 2, "data.house.inventory[0]"},
+    {76, 2, "data.house.inventory[1]"},
+    {78, 2, "data.house.inventory[2]"},
+    {80, 2, "data.house.inventory[3]"},
+    {82, 2, "data.house.inventory[4]"},
+    {84, 2, "data.house.inventory[5]"},
+    {86, 2, "data.house.inventory[6]"},
+    {88, 2, "data.house.inventory[7]"},
+    {90, 1, "data.house.theater"},
+    {91, 1, "data.house.amphitheater_actor"},
+    {92, 1, "data.house.amphitheater_gladiator"},
+    {93, 1, "data.house.colosseum_gladiator"},
+    {94, 1, "data.house.colosseum_lion"},
+    {95, 1, "data.house.hippodrome"},
+    {96, 1, "data.house.school"},
+    {97, 1, "data.house.library"},
+    {98, 1, "data.house.academy"},
+    {99, 1, "data.house.barber"},
+    {100, 1, "data.house.clinic"},
+    {101, 1, "data.house.bathhouse"},
+    {102, 1, "data.house.hospital"},
+    {103, 1, "data.house.temple_ceres"},
+    {104, 1, "data.house.temple_neptune"},
+    {105, 1, "data.house.temple_mercury"},
+    {106, 1, "data.house.temple_mars"},
+    {107, 1, "data.house.temple_venus"},
+    {108, 1, "data.house.no_space_to_expand"},
+    {109, 1, "data.house.num_foods"},
+    {110, 1, "data.house.entertainment"},
+    {111, 1, "data.house.education"},
+    {112, 1, "data.house.health"},
+    {113, 1, "data.house.num_gods"},
+    {114, 1, "data.house.devolve_delay"},
+    {115, 1, "data.house.evolve_text_id"},
+    {0, 0, 0}
+};
+
+static const struct record_field figure_fields[] = {
+    {0, 1, "alternative_location_index"},
+    {1, 1, "image_offset"},
+    {2, 1, "is_enemy_image"},
+    {3, 1, "flotsam_visible"},
+    {4, 2, "image_id"},
+    {6, 2, "cart_image_id"},
+    {8, 2, "next_figure_id_on_same_tile"},
+    {10, 1, "type"},
+    {11, 1, "resource_id"},
+    {12, 1, "use_cross_country"},
+    {13, 1, "is_friendly"},
+    {14, 1, "state"},
+    {15, 1, "faction_id"},
+    {16, 1, "action_state_before_attack"},
+    {17, 1, "direction"},
+    {18, 1, "previous_tile_direction"},
+    {19, 1, "attack_direction"},
+    {20, 1, "x"},
+    {21, 1, "y"},
+    {22, 1, "previous_tile_x"},
+    {23, 1, "previous_tile_y"},
+    {24, 1, "missile_damage"},
+    {25, 1, "damage"},
+    {26, 2, "grid_offset"},
+    {28, 1, "destination_x"},
+    {29, 1, "destination_y"},
+    {30, 2, "destination_grid_offset"},
+    {32, 1, "source_x"},
+    {33, 1, "source_y"},
+    {34, 1, "formation_position_x"},
+    {35, 1, "formation_position_y"},
+    {36, 2, "__unused_24"},
+    {38, 2, "wait_ticks"},
+    {40, 1, "action_state"},
+    {41, 1, "progress_on_tile"},
+    {42, 2, "routing_path_id"},
+    {44, 2, "routing_path_current_tile"},
+    {46, 2, "routing_path_length"},
+    {48, 1, "in_building_wait_ticks"},
+    {49, 1, "is_on_road"},
+    {50, 2, "max_roam_length"},
+    {52, 2, "roam_length"},
+    {54, 1, "roam_choose_destination"},
+    {55, 1, "roam_random_counter"},
+    {56, 1, "roam_turn_direction"},
+    {57, 1, "roam_ticks_until_next_turn"},
+    {58, 2, "cross_country_x"},
+    {60, 2, "cross_country_y"},
+    {62, 2, "cc_destination_x"},
+    {64, 2, "cc_destination_y"},
+    {66, 2, "cc_delta_x"},
+    {68, 2, "cc_delta_y"},
+    {70, 2, "cc_delta_xy"},
+    {72, 1, "cc_direction"},
+    {73, 1, "speed_multiplier"},
+    {74, 2, "building_id"},
+    {76, 2, "immigrant_building_id"},
+    {78, 2, "destination_building_id"},
+    {80, 2, "formation_id"},
+    {82, 1, "index_in_formation"},
+    {83, 1, "formation_at_rest"},
+    {84, 1, "migrant_num_people"},
+    {85, 1, "is_ghost"},
+    {86, 1, "min_max_seen"},
+    {87, 1, "__unused_57"},
+    {88, 2, "leading_figure_id"},
+    {90, 1, "attack_image_offset"},
+    {91, 1, "wait_ticks_missile"},
+    {92, 1, "x_offset_cart"},
+    {93, 1, "y_offset_cart"},
+    {94, 1, "empire_city_id"},
+    {95, 1, "trader_amount_bought"},
+    {96, 2, "name"},
+    {98, 1, "terrain_usage"},
+    {99, 1, "loads_sold_or_carrying"},
+    {100, 1, "is_boat"},
+    {101, 1, "height_adjusted_ticks"},
+    {102, 1, "current_height"},
+    {103, 1, "target_height"},
+    {104, 1, "collecting_item_id"},
+    {105, 1, "trade_ship_failed_dock_attempts"},
+    {106, 1, "phrase_sequence_exact"},
+    {107, 1, "phrase_id"},
+    {108, 1, "phrase_sequence_city"},
+    {109, 1, "trader_id"},
+    {110, 1, "wait_ticks_next_target"},
+    {111, 1, "__unused_6f"},
+    {112, 2, "target_figure_id"},
+    {114, 2, "targeted_by_figure_id"},
+    {116, 2, "created_sequence"},
+    {118, 2, "target_figure_created_sequence"},
+    {120, 1, "figures_on_same_tile_index"},
+    {121, 1, "num_attackers"},
+    {122, 2, "attacker_id1"},
+    {124, 2, "attacker_id2"},
+    {126, 2, "opponent_id"},
+    {0, 0, 0}
 };
 
 static struct game_file_part save_game_parts[] = {
     {0, 4, "scenario_campaign_mission"},
     {0, 4, "file_version"},
-    {1, 52488, "image_grid", 2},
-    {1, 26244, "edge_grid"},
-    {1, 52488, "building_grid", 2},
-    {1, 52488, "terrain_grid", 2},
-    {1, 26244, "aqueduct_grid"},
-    {1, 52488, "figure_grid", 2},
-    {1, 26244, "bitfields_grid"},
-    {1, 26244, "sprite_grid"},
-    {0, 26244, "random_grid"},
-    {1, 26244, "desirability_grid"},
-    {1, 26244, "elevation_grid"},
-    {1, 26244, "building_damage_grid"},
-    {1, 26244, "aqueduct_backup_grid"},
-    {1, 26244, "sprite_backup_grid"},
+    {1, 52488, "image_grid", 2, 1},
+    {1, 26244, "edge_grid", 0, 1},
+    {1, 52488, "building_grid", 2, 1},
+    {1, 52488, "terrain_grid", 2, 1},
+    {1, 26244, "aqueduct_grid", 0, 1},
+    {1, 52488, "figure_grid", 2, 1},
+    {1, 26244, "bitfields_grid", 0, 1},
+    {1, 26244, "sprite_grid", 0, 1},
+    {0, 26244, "random_grid", 0, 1},
+    {1, 26244, "desirability_grid", 0, 1},
+    {1, 26244, "elevation_grid", 0, 1},
+    {1, 26244, "building_damage_grid", 0, 1},
+    {1, 26244, "aqueduct_backup_grid", 0, 1},
+    {1, 26244, "sprite_backup_grid", 0, 1},
     {1, 128000, "figures", 128},
     {1, 1200, "route_figures", 2},
     {1, 300000, "route_paths", 500},
@@ -236,6 +461,8 @@ static struct game_file_part save_game_parts[] = {
 static char compress_buffer[COMPRESS_BUFFER_SIZE];
 static unsigned char file1_data[1300000];
 static unsigned char file2_data[1300000];
+static int output_json;
+static int num_differences;
 
 static unsigned int to_uint(const unsigned char *buffer)
 {
@@ -293,30 +520,43 @@ static int read_compressed_chunk(FILE *fp, void *buffer, int bytes_to_read)
     return 1;
 }
 
-static int unpack(const char *filename, unsigned char *buffer)
+static void print_json_string(const char *str)
 {
-    FILE *fp = fopen(filename, "rb");
-    if (!fp) {
-        printf("Unable to open file %s\n", filename);
-        return 0;
-    }
-    int offset = 0;
-    for (int i = 0; save_game_parts[i].length_in_bytes; i++) {
-        int result = 0;
-        if (save_game_parts[i].compressed) {
-            result = read_compressed_chunk(fp, &buffer[offset], save_game_parts[i].length_in_bytes);
-        } else {
-            result = fread(&buffer[offset], 1, save_game_parts[i].length_in_bytes, fp) == save_game_parts[i].length_in_bytes;
+    putchar('"');
+    for (; *str; str++) {
+        if (*str == '"' || *str == '\\') {
+            putchar('\\');
         }
-        offset += save_game_parts[i].length_in_bytes;
-        if (!result) {
-            printf("Error while loading file %s\n", filename);
-            fclose(fp);
-            return 0;
+        putchar(*str);
+    }
+    putchar('"');
+}
+
+static void report_error(const char *message, const char *filename, int part)
+{
+    if (output_json) {
+        printf(", \"error\": ");
+        print_json_string(message);
+        printf(", \"error_file\": ");
+        print_json_string(filename);
+        if (part >= 0) {
+            printf(", \"error_part\": ");
+            print_json_string(save_game_parts[part].name);
         }
+    } else if (part >= 0) {
+        printf("%s %s at part %d [%s]\n", message, filename, part, save_game_parts[part].name);
+    } else {
+        printf("%s %s\n", message, filename);
+    }
+}
+
+static int read_part(FILE *fp, int index, unsigned char *buffer)
+{
+    if (save_game_parts[index].compressed) {
+        return read_compressed_chunk(fp, buffer, save_game_parts[index].length_in_bytes);
+    } else {
+        return fread(buffer, 1, save_game_parts[index].length_in_bytes, fp) == save_game_parts[index].length_in_bytes;
     }
-    fclose(fp);
-    return offset;
 }
 
 static int has_adjacent_building_type(int part_offset, int building_type)
@@ -458,30 +698,119 @@ static int is_exception(int index, int global_offset, int part_offset)
     return 0;
 }
 
+static const struct record_field *find_field(const struct record_field *fields, int offset)
+{
+    for (int i = 0; fields[i].name; i++) {
+        if (offset >= fields[i].offset && offset < fields[i].offset + fields[i].size) {
+            return &fields[i];
+        }
+    }
+    return 0;
+}
+
+static const struct record_field *field_for(int index, const unsigned char *record, int offset)
+{
+    const struct record_field *field = 0;
+    if (index == index_of_part("buildings")) {
+        int type = to_ushort(&record[10]);
+        if (type >= BUILDING_TYPE_HOUSE_MIN && type <= BUILDING_TYPE_HOUSE_MAX) {
+            field = find_field(house_fields, offset);
+        }
+        if (!field) {
+            field = find_field(building_fields, offset);
+        }
+    } else if (index == index_of_part("figures")) {
+        field = find_field(figure_fields, offset);
+    }
+    return field;
+}
+
+static unsigned int read_value(const unsigned char *data, int size)
+{
+    switch (size) {
+        case 2: return to_ushort(data);
+        case 4: return to_uint(data);
+        default: return data[0];
+    }
+}
+
+static void report_difference(const struct difference *diff)
+{
+    const struct game_file_part *part = &save_game_parts[diff->part];
+    if (output_json) {
+        printf("%s\n    {\"part\": ", num_differences ? "," : "");
+        print_json_string(part->name);
+        if (diff->kind == DIFF_TILE) {
+            printf(", \"x\": %d, \"y\": %d, \"grid_offset\": %d", diff->record % GRID_SIZE, diff->record / GRID_SIZE, diff->record);
+        } else if (diff->kind == DIFF_RECORD) {
+            printf(", \"record\": %d, \"record_type\": %d", diff->record, diff->record_type);
+        }
+        printf(", \"offset\": %d", diff->offset);
+        if (diff->field) {
+            printf(", \"field\": ");
+            print_json_string(diff->field);
+        }
+        printf(", \"value1\": %u, \"value2\": %u}", diff->value1, diff->value2);
+    } else {
+        printf("Part %d [%s] (%d) ", diff->part, part->name, diff->part_offset);
+        if (diff->kind == DIFF_TILE) {
+            printf("tile (%d, %d) offset %d", diff->record % GRID_SIZE, diff->record / GRID_SIZE, diff->record);
+        } else if (diff->kind == DIFF_RECORD) {
+            printf("record %d offset 0x%X (type: %d)", diff->record, diff->offset, diff->record_type);
+            if (diff->field) {
+                printf(" [%s]", diff->field);
+            }
+        } else {
+            printf("offset %d", diff->offset);
+        }
+        printf(": %u <-> %u\n", diff->value1, diff->value2);
+    }
+    num_differences++;
+}
+
 static int compare_part(int index, int offset)
 {
     int different = 0;
-    int length = save_game_parts[index].length_in_bytes;
-    for (int i = 0; i < length; i++) {
-        if (file1_data[offset + i] != file2_data[offset + i] && !is_exception(index, offset + i, i)) {
-            different = 1;
-            printf("Part %d [%s] (%d) ", index, save_game_parts[index].name, i);
-            if (save_game_parts[index].record_length) {
-                printf("record %d offset 0x%X", i / save_game_parts[index].record_length, i % save_game_parts[index].record_length);
-                if (index == index_of_part("buildings")) {
-                    int record_length = save_game_parts[index].record_length;
-                    int type_offset = (i / record_length) * record_length + 10;
-                    printf(" (type: %d)", to_ushort(&file1_data[offset + type_offset]));
-                } else if (index == index_of_part("figures")) {
-                    int record_length = save_game_parts[index].record_length;
-                    int type_offset = (i / record_length) * record_length + 10;
-                    printf(" (type: %d)", file1_data[offset + type_offset]);
-                }
-            } else {
-                printf("offset %d", i);
+    const struct game_file_part *part = &save_game_parts[index];
+    for (int i = 0; i < part->length_in_bytes; i++) {
+        if (file1_data[offset + i] == file2_data[offset + i] || is_exception(index, offset + i, i)) {
+            continue;
+        }
+        different = 1;
+        struct difference diff = {index, DIFF_OFFSET, 0, 0, i, i, 0, file1_data[offset + i], file2_data[offset + i]};
+        int value_size = 1;
+        if (part->is_grid) {
+            value_size = part->record_length ? part->record_length : 1;
+            int start = i - i % value_size;
+            diff.kind = DIFF_TILE;
+            diff.record = i / value_size;
+            diff.offset = start;
+            diff.value1 = read_value(&file1_data[offset + start], value_size);
+            diff.value2 = read_value(&file2_data[offset + start], value_size);
+            i = start + value_size - 1;
+        } else if (part->record_length) {
+            int record_start = i - i % part->record_length;
+            const unsigned char *record = &file1_data[offset + record_start];
+            diff.kind = DIFF_RECORD;
+            diff.record = i / part->record_length;
+            diff.offset = i % part->record_length;
+            if (index == index_of_part("buildings")) {
+                diff.record_type = to_ushort(&record[10]);
+            } else if (index == index_of_part("figures")) {
+                diff.record_type = record[10];
+            }
+            const struct record_field *field = field_for(index, record, diff.offset);
+            if (field) {
+                int start = record_start + field->offset;
+                diff.field = field->name;
+                diff.offset = field->offset;
+                diff.value1 = read_value(&file1_data[offset + start], field->size);
+                diff.value2 = read_value(&file2_data[offset + start], field->size);
+                // report each field only once
+                i = start + field->size - 1;
             }
-            printf(": %d <-> %d\n", file1_data[offset + i], file2_data[offset + i]);
         }
+        report_difference(&diff);
     }
     return different;
 }
@@ -498,13 +827,18 @@ static void print_game_time(unsigned char *data)
     printf("%d.%u.%u.%u (%u)\n", year, month, day, tick, total_days);
 }
 
-static void compare_game_time(void)
+static int game_ticks(const unsigned char *data)
 {
     int offset_tick = 1200222;
     int offset_days = offset_tick + 16;
-    unsigned int ticks1 = to_uint(&file1_data[offset_tick]) + 50 * to_uint(&file1_data[offset_days]);
-    unsigned int ticks2 = to_uint(&file2_data[offset_tick]) + 50 * to_uint(&file2_data[offset_days]);
-    if (ticks1 != ticks2) {
+    return to_uint(&data[offset_tick]) + 50 * to_uint(&data[offset_days]);
+}
+
+static void compare_game_time(void)
+{
+    unsigned int ticks1 = game_ticks(file1_data);
+    unsigned int ticks2 = game_ticks(file2_data);
+    if (ticks1 != ticks2 && !output_json) {
         printf("WARN: ticks not in sync: %u <--> %u (%d)\n", ticks1, ticks2, ticks1 - ticks2);
         printf("File 1: ");
         print_game_time(file1_data);
@@ -525,14 +859,69 @@ static int compare(void)
     return different;
 }
 
-int compare_files(const char *file1, const char *file2)
+static int unpack_files(const char *file1, const char *file2)
 {
-    int length1 = unpack(file1, file1_data);
-    int length2 = unpack(file2, file2_data);
-    if (length1 && length1 == length2) {
-        return compare();
+    FILE *fp1 = fopen(file1, "rb");
+    FILE *fp2 = fopen(file2, "rb");
+    int ok = 1;
+    if (!fp1 || !fp2) {
+        report_error("Unable to open file", fp1 ? file2 : file1, -1);
+        ok = 0;
+    }
+    int offset = 0;
+    for (int i = 0; ok && save_game_parts[i].length_in_bytes; i++) {
+        if (!read_part(fp1, i, &file1_data[offset])) {
+            report_error("Error while loading file", file1, i);
+            ok = 0;
+        } else if (!read_part(fp2, i, &file2_data[offset])) {
+            report_error("Error while loading file", file2, i);
+            ok = 0;
+        }
+        offset += save_game_parts[i].length_in_bytes;
+    }
+    if (fp1) {
+        fclose(fp1);
+    }
+    if (fp2) {
+        fclose(fp2);
+    }
+    return ok;
+}
+
+static int compare_files_with_output(const char *file1, const char *file2, int json)
+{
+    output_json = json;
+    num_differences = 0;
+    if (output_json) {
+        printf("{\"file1\": ");
+        print_json_string(file1);
+        printf(", \"file2\": ");
+        print_json_string(file2);
+    }
+    int result;
+    if (!unpack_files(file1, file2)) {
+        result = 1;
     } else {
-        printf("WARN: lengths are different: %d <--> %d\n", length1, length2);
-        return 1;
+        if (output_json) {
+            printf(", \"ticks1\": %d, \"ticks2\": %d, \"differences\": [", game_ticks(file1_data), game_ticks(file2_data));
+        }
+        result = compare();
+        if (output_json) {
+            printf("%s]", num_differences ? "\n  " : "");
+        }
+    }
+    if (output_json) {
+        printf(", \"different\": %s}\n", result ? "true" : "false");
     }
+    return result;
+}
+
+int compare_files(const char *file1, const char *file2)
+{
+    return compare_files_with_output(file1, file2, 0);
+}
+
+int compare_files_json(const char *file1, const char *file2)
+{
+    return compare_files_with_output(file1, file2, 1);
 }
@@ -3,4 +3,6 @@
 
 int compare_files(const char *file1, const char *file2);
 
+int compare_files_json(const char *file1, const char *file2);
+
 #endif // SAV_COMPARE_H
@@ -0,0 +1,260 @@
+#include "city/finance.h"
+#include "city/population.h"
+#include "city/ratings.h"
+#include "building/figure.h"
+#include "core/backtrace.h"
+#include "core/file.h"
+#include "core/time.h"
+#include "figure/intent.h"
+#include "game/file.h"
+#include "game/game.h"
+#include "game/settings.h"
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TICKS_PER_YEAR (50 * 16 * 12)
+#define MAX_FILES 1000
+
+static struct {
+    int ticks;
+    int jobs;
+    int spawn_costs;
+    const char *output_dir;
+    char *files[MAX_FILES];
+    int num_files;
+} data = {TICKS_PER_YEAR, 1, 0, 0};
+
+static void handler(int sig)
+{
+    fprintf(stderr, "Oops, crashed with signal %d :(", sig);
+    backtrace_print();
+    exit(1);
+}
+
+static void usage(void)
+{
+    printf("Usage: julius-sim [--ticks N] [--jobs N] [--figure-threads N] [--spawn-costs] [--output-dir DIR] "
+        "FILE_OR_DIR...\n");
+    printf("Runs every saved game for N ticks (default: one year) and prints the time taken\n");
+    printf("and the state of the city afterwards. Directories are searched for .sav files,\n");
+    printf("except on Windows.\n");
+    printf("  --jobs N            Simulates N saved games at the same time in separate processes\n");
+    printf("  --figure-threads N  Works out figure intents ahead of the figure actions\n");
+    printf("  --spawn-costs       Prints how often buildings of each type spawned figures\n");
+    printf("  --output-dir DIR    Writes the resulting saved games to DIR\n");
+}
+
+static void add_file(const char *filename)
+{
+    if (data.num_files >= MAX_FILES) {
+        printf("Too many files, skipping %s\n", filename);
+        return;
+    }
+    data.files[data.num_files] = malloc(strlen(filename) + 1);
+    if (data.files[data.num_files]) {
+        strcpy(data.files[data.num_files], filename);
+        data.num_files++;
+    }
+}
+
+#ifdef _WIN32
+static void add_path(const char *path)
+{
+    // directories are not searched on Windows
+    add_file(path);
+}
+#else
+static void add_path(const char *path)
+{
+    DIR *dir = opendir(path);
+    if (!dir) {
+        add_file(path);
+        return;
+    }
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != 0) {
+        if (entry->d_name[0] == '.' || !file_has_extension(entry->d_name, "sav")) {
+            continue;
+        }
+        char filename[FILE_NAME_MAX];
+        if (strlen(path) + strlen(entry->d_name) + 2 > FILE_NAME_MAX) {
+            continue;
+        }
+        strcpy(filename, path);
+        strcat(filename, "/");
+        strcat(filename, entry->d_name);
+        add_file(filename);
+    }
+    closedir(dir);
+}
+#endif
+
+static int compare_filenames(const void *a, const void *b)
+{
+    return strcmp(*(char * const *) a, *(char * const *) b);
+}
+
+static const char *base_name(const char *filename)
+{
+    const char *name = filename;
+    for (const char *c = filename; *c; c++) {
+        if (*c == '/' || *c == '\\') {
+            name = c + 1;
+        }
+    }
+    return name;
+}
+
+static void print_spawn_costs(const char *filename)
+{
+    for (int type = 0; type < BUILDING_TYPE_MAX; type++) {
+        int visits, figures;
+        building_figure_get_spawn_cost(type, &visits, &figures);
+        if (visits) {
+            printf("%s: building type %d: %d spawn visits, %d figures spawned\n", filename, type, visits, figures);
+        }
+    }
+}
+
+static int simulate(const char *filename)
+{
+    if (!game_file_load_saved_game(filename)) {
+        printf("%s: unable to load saved game\n", filename);
+        return 1;
+    }
+    clock_t start = clock();
+    setting_reset_speeds(100, setting_scroll_speed());
+    time_set_millis(0);
+    for (int i = 1; i <= data.ticks; i++) {
+        time_set_millis(2 * i);
+        game_run();
+    }
+    int millis = (int) ((clock() - start) * 1000 / CLOCKS_PER_SEC);
+
+    if (data.output_dir) {
+        char output[FILE_NAME_MAX];
+        if (strlen(data.output_dir) + strlen(base_name(filename)) + 2 > FILE_NAME_MAX) {
+            printf("%s: output file name too long\n", filename);
+            return 1;
+        }
+        strcpy(output, data.output_dir);
+        strcat(output, "/");
+        strcat(output, base_name(filename));
+        if (!game_file_write_saved_game(output)) {
+            printf("%s: unable to write %s\n", filename, output);
+            return 1;
+        }
+    }
+    printf("%s: %d ticks in %d ms, population %d, treasury %d, "
+        "culture %d, prosperity %d, peace %d, favor %d\n",
+        filename, data.ticks, millis, city_population(), city_finance_treasury(),
+        city_rating_culture(), city_rating_prosperity(), city_rating_peace(), city_rating_favor());
+    if (data.spawn_costs) {
+        print_spawn_costs(filename);
+    }
+    fflush(stdout);
+    return 0;
+}
+
+#ifdef _WIN32
+static int simulate_all(void)
+{
+    int failed = 0;
+    for (int i = 0; i < data.num_files; i++) {
+        failed += simulate(data.files[i]);
+    }
+    return failed;
+}
+#else
+static int wait_for_job(void)
+{
+    int status;
+    if (wait(&status) < 0) {
+        return 0;
+    }
+    return !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+}
+
+static int simulate_all(void)
+{
+    int failed = 0;
+    int running = 0;
+    fflush(stdout);
+    for (int i = 0; i < data.num_files; i++) {
+        if (running >= data.jobs) {
+            failed += wait_for_job();
+            running--;
+        }
+        pid_t pid = fork();
+        if (pid == 0) {
+            _exit(simulate(data.files[i]));
+        } else if (pid < 0) {
+            // unable to start another process: simulate in this one
+            failed += simulate(data.files[i]);
+        } else {
+            running++;
+        }
+    }
+    while (running > 0) {
+        failed += wait_for_job();
+        running--;
+    }
+    return failed;
+}
+#endif
+
+static int parse_arguments(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            data.ticks = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+            data.jobs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--figure-threads") == 0 && i + 1 < argc) {
+            figure_intent_set_threads(atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--spawn-costs") == 0) {
+            data.spawn_costs = 1;
+        } else if (strcmp(argv[i], "--output-dir") == 0 && i + 1 < argc) {
+            data.output_dir = argv[++i];
+        } else if (strncmp(argv[i], "--", 2) == 0) {
+            return 0;
+        } else {
+            add_path(argv[i]);
+        }
+    }
+    return data.num_files > 0 && data.ticks > 0 && data.jobs > 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (!parse_arguments(argc, argv)) {
+        usage();
+        return -1;
+    }
+    signal(SIGSEGV, handler);
+    qsort(data.files, data.num_files, sizeof(char *), compare_filenames);
+
+    if (!game_pre_init()) {
+        printf("Unable to run Game_preInit\n");
+        return 1;
+    }
+    if (!game_init()) {
+        printf("Unable to run Game_init\n");
+        return 2;
+    }
+    int failed = simulate_all();
+    printf("Simulated %d saved games, %d failed\n", data.num_files, failed);
+
+    game_exit();
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+#include "game/system.h"
+
+#ifndef _WIN32
+
+// real threads, so the tests also cover the code that runs on worker threads
+#include <pthread.h>
+#include <stdlib.h>
+
+typedef struct {
+    pthread_t thread;
+    int (*function)(void *data);
+    void *data;
+} stub_thread;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int value;
+} stub_semaphore;
+
+static void *run_thread(void *arg)
+{
+    stub_thread *t = arg;
+    t->function(t->data);
+    return 0;
+}
+
+void *system_create_thread(int (*function)(void *data), void *data)
+{
+    stub_thread *t = malloc(sizeof(stub_thread));
+    if (!t) {
+        return 0;
+    }
+    t->function = function;
+    t->data = data;
+    if (pthread_create(&t->thread, 0, run_thread, t) != 0) {
+        free(t);
+        return 0;
+    }
+    return t;
+}
+
+void system_wait_thread(void *thread)
+{
+    stub_thread *t = thread;
+    pthread_join(t->thread, 0);
+    free(t);
+}
+
+void *system_create_semaphore(int value)
+{
+    stub_semaphore *s = malloc(sizeof(stub_semaphore));
+    if (!s) {
+        return 0;
+    }
+    pthread_mutex_init(&s->mutex, 0);
+    pthread_cond_init(&s->cond, 0);
+    s->value = value;
+    return s;
+}
+
+void system_wait_semaphore(void *semaphore)
+{
+    stub_semaphore *s = semaphore;
+    pthread_mutex_lock(&s->mutex);
+    while (s->value <= 0) {
+        pthread_cond_wait(&s->cond, &s->mutex);
+    }
+    s->value--;
+    pthread_mutex_unlock(&s->mutex);
+}
+
+void system_post_semaphore(void *semaphore)
+{
+    stub_semaphore *s = semaphore;
+    pthread_mutex_lock(&s->mutex);
+    s->value++;
+    pthread_cond_signal(&s->cond);
+    pthread_mutex_unlock(&s->mutex);
+}
+
+void system_destroy_semaphore(void *semaphore)
+{
+    stub_semaphore *s = semaphore;
+    if (!s) {
+        return;
+    }
+    pthread_cond_destroy(&s->cond);
+    pthread_mutex_destroy(&s->mutex);
+    free(s);
+}
+
+#else
+
+void *system_create_thread(int (*function)(void *data), void *data)
+{
+    return 0;
+}
+
+void system_wait_thread(void *thread)
+{}
+
+void *system_create_semaphore(int value)
+{
+    return 0;
+}
+
+void system_wait_semaphore(void *semaphore)
+{}
+
+void system_post_semaphore(void *semaphore)
+{}
+
+void system_destroy_semaphore(void *semaphore)
+{}
+
+#endif